@@ -0,0 +1,55 @@
+#ifndef __DALI_TOOLKIT_BENCHMARK_UTILS_H__
+#define __DALI_TOOLKIT_BENCHMARK_UTILS_H__
+
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <string>
+#include <time.h>
+
+namespace Benchmark
+{
+
+/**
+ * @brief Retrieves the time of a monotonic clock.
+ *
+ * @return The time in milliseconds.
+ */
+inline double GetTimeInMilliseconds()
+{
+  timespec time;
+  clock_gettime( CLOCK_MONOTONIC, &time );
+  return static_cast<double>( time.tv_sec ) * 1000.0 + static_cast<double>( time.tv_nsec ) / 1000000.0;
+}
+
+/**
+ * @brief Retrieves the name of a file without its path.
+ *
+ * @param[in] path The path of the file.
+ *
+ * @return The name of the file.
+ */
+inline std::string GetFileName( const std::string& path )
+{
+  const std::string::size_type position = path.rfind( '/' );
+  return ( std::string::npos == position ) ? path : path.substr( position + 1u );
+}
+
+} // namespace Benchmark
+
+#endif // __DALI_TOOLKIT_BENCHMARK_UTILS_H__
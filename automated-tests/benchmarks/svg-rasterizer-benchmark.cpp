@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// Compares the scalar and the vectorised span compositing of the svg rasterizer.
+//
+// Usage: svg-rasterizer-benchmark [-w width] [-n iterations] [file.svg ...]
+//
+// The svg files of the test resources are rasterized when no file is given.
+
+// EXTERNAL INCLUDES
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+// INTERNAL INCLUDES
+#include <dali-toolkit/third-party/nanosvg/nanosvg.h>
+#include <dali-toolkit/third-party/nanosvg/nanosvgrast.h>
+#include "benchmark-utils.h"
+
+namespace
+{
+
+const char* const DEFAULT_SVG_FILES[] =
+{
+  BENCHMARK_RESOURCE_DIR "/svg1.svg",
+};
+const unsigned int NUMBER_OF_DEFAULT_SVG_FILES = sizeof( DEFAULT_SVG_FILES ) / sizeof( DEFAULT_SVG_FILES[0] );
+
+const unsigned int DEFAULT_WIDTH = 512u;
+const unsigned int DEFAULT_NUMBER_OF_ITERATIONS = 50u;
+const float DPI = 96.f;
+
+/**
+ * Rasterizes the image into a buffer of the given width, keeping the aspect ratio.
+ */
+void RasterizeImage( NSVGrasterizer* rasterizer, NSVGimage* image, unsigned int width, std::vector<unsigned char>& buffer )
+{
+  const float scale = static_cast<float>( width ) / image->width;
+  const unsigned int height = static_cast<unsigned int>( image->height * scale );
+
+  buffer.resize( width * height * 4u );
+  nsvgRasterize( rasterizer, image, 0.f, 0.f, scale, &buffer[0], width, height, width * 4u );
+}
+
+/**
+ * Rasterizes the image the given number of times.
+ *
+ * @return The time in milliseconds.
+ */
+double TimeRasterization( NSVGrasterizer* rasterizer, NSVGimage* image, unsigned int width, unsigned int numberOfIterations, std::vector<unsigned char>& buffer )
+{
+  // Warm up the caches and the allocations of the rasterizer.
+  RasterizeImage( rasterizer, image, width, buffer );
+
+  const double start = Benchmark::GetTimeInMilliseconds();
+  for( unsigned int iteration = 0u; iteration < numberOfIterations; ++iteration )
+  {
+    RasterizeImage( rasterizer, image, width, buffer );
+  }
+  return Benchmark::GetTimeInMilliseconds() - start;
+}
+
+} // namespace
+
+int main( int argc, char** argv )
+{
+  unsigned int width = DEFAULT_WIDTH;
+  unsigned int numberOfIterations = DEFAULT_NUMBER_OF_ITERATIONS;
+  std::vector<std::string> fileNames;
+
+  for( int index = 1; index < argc; ++index )
+  {
+    if( ( 0 == strcmp( argv[index], "-w" ) ) && ( index + 1 < argc ) )
+    {
+      width = static_cast<unsigned int>( atoi( argv[++index] ) );
+    }
+    else if( ( 0 == strcmp( argv[index], "-n" ) ) && ( index + 1 < argc ) )
+    {
+      numberOfIterations = static_cast<unsigned int>( atoi( argv[++index] ) );
+    }
+    else
+    {
+      fileNames.push_back( argv[index] );
+    }
+  }
+
+  if( fileNames.empty() )
+  {
+    fileNames.assign( DEFAULT_SVG_FILES, DEFAULT_SVG_FILES + NUMBER_OF_DEFAULT_SVG_FILES );
+  }
+
+  if( ( 0u == width ) || ( 0u == numberOfIterations ) )
+  {
+    fprintf( stderr, "Usage: %s [-w width] [-n iterations] [file.svg ...]\n", argv[0] );
+    return EXIT_FAILURE;
+  }
+
+  NSVGrasterizer* rasterizer = nsvgCreateRasterizer();
+  if( !nsvgSetRasterizerSimd( rasterizer, 1 ) )
+  {
+    fprintf( stderr, "The rasterizer is built without SSE2 or NEON, both paths are scalar.\n" );
+  }
+
+  printf( "%-40s %12s %12s %8s\n", "file", "scalar (ms)", "simd (ms)", "speedup" );
+
+  int result = EXIT_SUCCESS;
+  double totalTime[2] = { 0.0, 0.0 };
+  std::vector<unsigned char> buffers[2];
+
+  for( std::vector<std::string>::const_iterator it = fileNames.begin(), endIt = fileNames.end(); it != endIt; ++it )
+  {
+    NSVGimage* image = nsvgParseFromFile( it->c_str(), "px", DPI );
+    if( ( NULL == image ) || ( image->width <= 0.f ) || ( image->height <= 0.f ) )
+    {
+      fprintf( stderr, "Can't parse %s\n", it->c_str() );
+      nsvgDelete( image );
+      result = EXIT_FAILURE;
+      continue;
+    }
+
+    double time[2];
+    for( int simd = 0; simd < 2; ++simd )
+    {
+      nsvgSetRasterizerSimd( rasterizer, simd );
+      time[simd] = TimeRasterization( rasterizer, image, width, numberOfIterations, buffers[simd] );
+      totalTime[simd] += time[simd];
+    }
+
+    // Both paths must give the same pixels.
+    if( buffers[0] != buffers[1] )
+    {
+      fprintf( stderr, "The scalar and vectorised pixels of %s differ\n", it->c_str() );
+      result = EXIT_FAILURE;
+    }
+
+    printf( "%-40s %12.2f %12.2f %7.2fx\n", Benchmark::GetFileName( *it ).c_str(), time[0], time[1], time[0] / time[1] );
+
+    nsvgDelete( image );
+  }
+
+  printf( "%-40s %12.2f %12.2f %7.2fx\n", "total", totalTime[0], totalTime[1], ( totalTime[1] > 0.0 ) ? totalTime[0] / totalTime[1] : 0.0 );
+  printf( "%u iterations at width %u\n", numberOfIterations, width );
+
+  nsvgDeleteRasterizer( rasterizer );
+
+  return result;
+}
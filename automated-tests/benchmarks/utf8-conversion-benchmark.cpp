@@ -0,0 +1,207 @@
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// Compares the per-character and the block conversion of UTF8 text to UTF32.
+//
+// Usage: utf8-conversion-benchmark [-s size in KB] [-n iterations]
+//
+// Each corpus repeats a text up to the given size.
+
+// EXTERNAL INCLUDES
+#include <algorithm>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+// INTERNAL INCLUDES
+#include <dali-toolkit/internal/text/character-set-conversion.h>
+#include "benchmark-utils.h"
+
+namespace
+{
+
+struct Corpus
+{
+  const char* description; ///< The name of the corpus.
+  const char* text;        ///< The text repeated to build the corpus.
+};
+
+const Corpus CORPORA[] =
+{
+  {
+    "Latin",
+    "Lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do eiusmod tempor incididunt ut labore et dolore magna aliqua. ",
+  },
+  {
+    "Latin with CR and CR+LF",
+    "Lorem ipsum dolor sit amet,\xd consectetur adipiscing elit,\xd\xa sed do eiusmod tempor\xd\xa",
+  },
+  {
+    "Arabic",
+    "\xd9\x85\xd8\xb1\xd8\xad\xd8\xa8\xd8\xa7\xd8\xa8\xd8\xa7\xd9\x84\xd8\xb9\xd8\xa7\xd9\x84\xd9\x85 \xd9\x85\xd8\xb1\xd8\xad\xd8\xa8\xd8\xa7 ",
+  },
+  {
+    "CJK",
+    "\xe6\x97\xa5\xe6\x9c\xac\xe8\xaa\x9e\xe3\x81\xae\xe3\x83\x86\xe3\x82\xad\xe3\x82\xb9\xe3\x83\x88\xe3\x80\x82\xe4\xb8\xad\xe6\x96\x87\xed\x95\x9c\xea\xb5\xad\xec\x96\xb4",
+  },
+  {
+    "Emojis",
+    "\xf0\x9f\x98\x81\xf0\x9f\x98\x82\xf0\x9f\x98\x83\xf0\x9f\x98\x84\xf0\x9f\x98\x85\xf0\x9f\x98\x86\xf0\x9f\x98\x87\xf0\x9f\x98\x88",
+  },
+  {
+    "Latin and emojis",
+    "Hello World \xf0\x9f\x98\x81 \xf0\x9f\x98\x82 Hello World ",
+  },
+};
+const unsigned int NUMBER_OF_CORPORA = sizeof( CORPORA ) / sizeof( CORPORA[0] );
+
+const unsigned int DEFAULT_SIZE = 256u; ///< In KB.
+const unsigned int DEFAULT_NUMBER_OF_ITERATIONS = 100u;
+
+/**
+ * Converts the text one character at a time, the way Utf8ToUtf32() did before the block conversion.
+ */
+uint32_t ScalarUtf8ToUtf32( const uint8_t* const utf8, uint32_t length, uint32_t* utf32 )
+{
+  uint32_t numberOfCharacters = 0u;
+
+  const uint8_t* begin = utf8;
+  const uint8_t* end = utf8 + length;
+
+  for( ; begin < end; ++numberOfCharacters )
+  {
+    const uint8_t leadByte = *begin;
+    const uint8_t utf8Length = Dali::Toolkit::Text::GetUtf8Length( leadByte );
+
+    if( 0x0du == leadByte )
+    {
+      *utf32++ = 0x0au;
+      ++begin;
+      if( ( begin < end ) && ( 0x0au == *begin ) )
+      {
+        ++begin;
+      }
+      continue;
+    }
+
+    uint32_t code = ( 1u == utf8Length ) ? leadByte : ( leadByte & ( 0xffu >> ( utf8Length + 1u ) ) );
+    for( uint8_t index = 1u; index < utf8Length; ++index )
+    {
+      code = ( code << 6u ) | ( begin[index] & 0x3fu );
+    }
+
+    *utf32++ = code;
+    begin += utf8Length;
+  }
+
+  return numberOfCharacters;
+}
+
+typedef uint32_t (*ConversionFunction)( const uint8_t* const utf8, uint32_t length, uint32_t* utf32 );
+
+/**
+ * Converts the corpus the given number of times.
+ *
+ * @return The time in milliseconds.
+ */
+double TimeConversion( ConversionFunction function, const std::string& corpus, unsigned int numberOfIterations, std::vector<uint32_t>& utf32, uint32_t& numberOfCharacters )
+{
+  const uint8_t* const utf8 = reinterpret_cast<const uint8_t*>( corpus.c_str() );
+  const uint32_t length = static_cast<uint32_t>( corpus.size() );
+
+  // Warm up the caches.
+  numberOfCharacters = function( utf8, length, &utf32[0] );
+
+  const double start = Benchmark::GetTimeInMilliseconds();
+  for( unsigned int iteration = 0u; iteration < numberOfIterations; ++iteration )
+  {
+    numberOfCharacters = function( utf8, length, &utf32[0] );
+  }
+  return Benchmark::GetTimeInMilliseconds() - start;
+}
+
+} // namespace
+
+int main( int argc, char** argv )
+{
+  unsigned int size = DEFAULT_SIZE;
+  unsigned int numberOfIterations = DEFAULT_NUMBER_OF_ITERATIONS;
+
+  for( int index = 1; index < argc; ++index )
+  {
+    if( ( 0 == strcmp( argv[index], "-s" ) ) && ( index + 1 < argc ) )
+    {
+      size = static_cast<unsigned int>( atoi( argv[++index] ) );
+    }
+    else if( ( 0 == strcmp( argv[index], "-n" ) ) && ( index + 1 < argc ) )
+    {
+      numberOfIterations = static_cast<unsigned int>( atoi( argv[++index] ) );
+    }
+    else
+    {
+      size = 0u;
+    }
+  }
+
+  if( ( 0u == size ) || ( 0u == numberOfIterations ) )
+  {
+    fprintf( stderr, "Usage: %s [-s size in KB] [-n iterations]\n", argv[0] );
+    return EXIT_FAILURE;
+  }
+
+  printf( "%-24s %14s %14s %8s\n", "corpus", "scalar (MB/s)", "block (MB/s)", "speedup" );
+
+  int result = EXIT_SUCCESS;
+  std::vector<uint32_t> utf32[2];
+
+  for( unsigned int corpusIndex = 0u; corpusIndex < NUMBER_OF_CORPORA; ++corpusIndex )
+  {
+    const Corpus& corpus = CORPORA[corpusIndex];
+
+    std::string text;
+    while( text.size() < size * 1024u )
+    {
+      text.append( corpus.text );
+    }
+
+    const ConversionFunction functions[2] = { &ScalarUtf8ToUtf32, &Dali::Toolkit::Text::Utf8ToUtf32 };
+    double throughput[2];
+    uint32_t numberOfCharacters[2];
+    for( unsigned int functionIndex = 0u; functionIndex < 2u; ++functionIndex )
+    {
+      utf32[functionIndex].assign( text.size(), 0u );
+      const double time = TimeConversion( functions[functionIndex], text, numberOfIterations, utf32[functionIndex], numberOfCharacters[functionIndex] );
+      throughput[functionIndex] = ( time > 0.0 ) ? ( static_cast<double>( text.size() ) * numberOfIterations ) / ( time * 1000.0 ) : 0.0;
+    }
+
+    // Both conversions must give the same characters.
+    if( ( numberOfCharacters[0] != numberOfCharacters[1] ) ||
+        !std::equal( utf32[0].begin(), utf32[0].begin() + numberOfCharacters[0], utf32[1].begin() ) )
+    {
+      fprintf( stderr, "The scalar and block conversions of the %s corpus differ\n", corpus.description );
+      result = EXIT_FAILURE;
+    }
+
+    printf( "%-24s %14.1f %14.1f %7.2fx\n", corpus.description, throughput[0], throughput[1], ( throughput[0] > 0.0 ) ? throughput[1] / throughput[0] : 0.0 );
+  }
+
+  printf( "%u iterations of %u KB\n", numberOfIterations, size );
+
+  return result;
+}
@@ -0,0 +1,207 @@
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <iostream>
+
+#include <stdlib.h>
+#include <dali-toolkit/internal/visuals/image-atlas-manager.h>
+#include <dali-toolkit-test-suite-utils.h>
+#include <toolkit-event-thread-callback.h>
+#include <dali-toolkit/dali-toolkit.h>
+
+
+using namespace Dali;
+using namespace Toolkit;
+
+// Tests the compaction of the atlases of the image atlas manager.
+
+//////////////////////////////////////////////////////////
+
+namespace
+{
+
+const char* TEST_IMAGE_FILE_NAME = TEST_RESOURCE_DIR "/gallery-small-1.jpg";
+const char* ATLAS_RECT_UNIFORM_NAME = "uAtlasRect";
+
+/**
+ * Creates a renderer showing the atlas image, as the image visual does.
+ */
+Renderer CreateRenderer( TextureSet textureSet, const Vector4& textureRect )
+{
+  Geometry geometry = Geometry::New();
+  Shader shader = Shader::New( "vertexSrc", "fragmentSrc" );
+  Renderer renderer = Renderer::New( geometry, shader );
+  renderer.SetTextures( textureSet );
+  renderer.RegisterProperty( ATLAS_RECT_UNIFORM_NAME, textureRect );
+  return renderer;
+}
+
+Vector4 GetAtlasRect( Renderer renderer )
+{
+  Vector4 textureRect;
+  renderer.GetProperty( renderer.GetPropertyIndex( ATLAS_RECT_UNIFORM_NAME ) ).Get( textureRect );
+  return textureRect;
+}
+
+/**
+ * Waits until the given number of images are loaded in total, and uploads them.
+ */
+void UploadLoadedImages( ToolkitTestApplication& application, unsigned int numberOfImages )
+{
+  EventThreadCallback* eventTrigger = EventThreadCallback::Get();
+  eventTrigger->WaitingForTrigger( numberOfImages );
+  CallbackBase::Execute( *eventTrigger->GetCallback() );
+
+  application.SendNotification();
+  application.Render();
+}
+
+} // namespace
+
+//////////////////////////////////////////////////////////
+
+int UtcDaliImageAtlasManagerCompact(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline(" UtcDaliImageAtlasManagerCompact");
+
+  IntrusivePtr< Internal::ImageAtlasManager > manager = new Internal::ImageAtlasManager();
+
+  // Fill the first atlas, the next images go to a second one.
+  Vector4 textureRects[6];
+  TextureSet textureSets[6];
+  Renderer renderers[6];
+  for( unsigned int index = 0u; index < 5u; ++index )
+  {
+    textureSets[index] = manager->Add( textureRects[index], TEST_IMAGE_FILE_NAME, ImageDimensions( 512, 512 ) );
+  }
+  textureSets[5] = manager->Add( textureRects[5], TEST_IMAGE_FILE_NAME, ImageDimensions( 128, 128 ) );
+
+  for( unsigned int index = 0u; index < 6u; ++index )
+  {
+    renderers[index] = CreateRenderer( textureSets[index], textureRects[index] );
+    manager->RegisterRenderer( textureSets[index], textureRects[index], renderers[index] );
+  }
+
+  DALI_TEST_EQUALS( manager->GetNumberOfAtlases(), 2u, TEST_LOCATION );
+  DALI_TEST_CHECK( textureSets[0] == textureSets[3] );
+  DALI_TEST_CHECK( textureSets[0] != textureSets[4] );
+  DALI_TEST_CHECK( textureSets[4] == textureSets[5] );
+
+  UploadLoadedImages( application, 6u );
+
+  // Nothing to compact while the atlases are dense.
+  DALI_TEST_CHECK( !manager->Compact() );
+
+  // Free some space in the first atlas, and leave the second one sparse.
+  manager->Remove( textureSets[3], textureRects[3] );
+  renderers[3].Reset();
+  manager->Remove( textureSets[4], textureRects[4] );
+  renderers[4].Reset();
+
+  // The image of the sparse atlas is loaded again into the dense one.
+  DALI_TEST_CHECK( manager->Compact() );
+  DALI_TEST_EQUALS( manager->GetNumberOfAtlases(), 2u, TEST_LOCATION );
+
+  // The renderer shows the image in the sparse atlas until it's uploaded to the dense one.
+  DALI_TEST_CHECK( renderers[5].GetTextures() == textureSets[5] );
+  DALI_TEST_EQUALS( GetAtlasRect( renderers[5] ), textureRects[5], TEST_LOCATION );
+
+  // No other pass while the images are being moved.
+  DALI_TEST_CHECK( manager->Compact() );
+
+  UploadLoadedImages( application, 7u );
+
+  // The renderer is switched to the dense atlas, and the emptied atlas is freed.
+  DALI_TEST_CHECK( renderers[5].GetTextures() == textureSets[0] );
+  Vector4 textureRect = GetAtlasRect( renderers[5] );
+  DALI_TEST_CHECK( textureRect != textureRects[5] );
+  DALI_TEST_EQUALS( manager->GetNumberOfAtlases(), 1u, TEST_LOCATION );
+
+  // The image is removed from its new place.
+  manager->Remove( textureSets[0], textureRect );
+  Vector4 newTextureRect;
+  DALI_TEST_CHECK( manager->Add( newTextureRect, TEST_IMAGE_FILE_NAME, ImageDimensions( 512, 512 ) ) == textureSets[0] );
+  DALI_TEST_EQUALS( manager->GetNumberOfAtlases(), 1u, TEST_LOCATION );
+
+  UploadLoadedImages( application, 8u );
+
+  END_TEST;
+}
+
+int UtcDaliImageAtlasManagerCompactNotMovable(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline(" UtcDaliImageAtlasManagerCompactNotMovable");
+
+  IntrusivePtr< Internal::ImageAtlasManager > manager = new Internal::ImageAtlasManager();
+
+  // A full atlas, and a sparse one with an image which doesn't fit into the full one.
+  Vector4 textureRects[5];
+  TextureSet textureSets[5];
+  Renderer renderers[5];
+  for( unsigned int index = 0u; index < 4u; ++index )
+  {
+    textureSets[index] = manager->Add( textureRects[index], TEST_IMAGE_FILE_NAME, ImageDimensions( 512, 512 ) );
+  }
+  textureSets[4] = manager->Add( textureRects[4], TEST_IMAGE_FILE_NAME, ImageDimensions( 256, 256 ) );
+
+  for( unsigned int index = 0u; index < 5u; ++index )
+  {
+    renderers[index] = CreateRenderer( textureSets[index], textureRects[index] );
+    manager->RegisterRenderer( textureSets[index], textureRects[index], renderers[index] );
+  }
+
+  UploadLoadedImages( application, 5u );
+  DALI_TEST_EQUALS( manager->GetNumberOfAtlases(), 2u, TEST_LOCATION );
+
+  // The images are only moved if they all fit.
+  DALI_TEST_CHECK( !manager->Compact() );
+  DALI_TEST_EQUALS( manager->GetNumberOfAtlases(), 2u, TEST_LOCATION );
+  DALI_TEST_CHECK( renderers[4].GetTextures() == textureSets[4] );
+
+  // The pixel buffers are not kept, so they pin their atlas.
+  const unsigned int bufferSize = 16u * 16u * 4u;
+  unsigned char* buffer = new unsigned char[ bufferSize ];
+  PixelData pixelData = PixelData::New( buffer, bufferSize, 16u, 16u, Pixel::RGBA8888, PixelData::DELETE_ARRAY );
+  Vector4 pixelDataRect;
+  DALI_TEST_CHECK( manager->Add( pixelDataRect, pixelData ) == textureSets[4] );
+  manager->Remove( textureSets[3], textureRects[3] );
+  DALI_TEST_CHECK( !manager->Compact() );
+  DALI_TEST_EQUALS( manager->GetNumberOfAtlases(), 2u, TEST_LOCATION );
+
+  // Removing an area twice, or the zero rectangle of an image which couldn't be read, doesn't unpin the atlas.
+  manager->Remove( textureSets[3], textureRects[3] );
+  manager->Remove( textureSets[4], Vector4::ZERO );
+  manager->Remove( textureSets[4], textureRects[3] );
+  DALI_TEST_CHECK( !manager->Compact() );
+  DALI_TEST_EQUALS( manager->GetNumberOfAtlases(), 2u, TEST_LOCATION );
+  DALI_TEST_CHECK( renderers[4].GetTextures() == textureSets[4] );
+
+  // Neither are the images without renderer, which can't be switched to another atlas.
+  manager->Remove( textureSets[4], pixelDataRect );
+  renderers[4].Reset();
+  DALI_TEST_CHECK( !manager->Compact() );
+  DALI_TEST_EQUALS( manager->GetNumberOfAtlases(), 2u, TEST_LOCATION );
+
+  // The emptied atlas is freed.
+  manager->Remove( textureSets[4], textureRects[4] );
+  DALI_TEST_CHECK( !manager->Compact() );
+  DALI_TEST_EQUALS( manager->GetNumberOfAtlases(), 1u, TEST_LOCATION );
+
+  END_TEST;
+}
@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <iostream>
+#include <string>
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <unistd.h>
+#include <utime.h>
+#include <dali-toolkit/internal/image-atlas/image-dimensions-cache.h>
+#include <dali-toolkit-test-suite-utils.h>
+#include <dali-toolkit/dali-toolkit.h>
+
+
+using namespace Dali;
+using namespace Toolkit;
+
+// Tests the image dimensions cache shared by the atlases and visuals.
+//
+// The test platform abstraction returns the size set with SetClosestImageSize() for any url,
+// so the cached dimensions are told apart from the ones read again by changing it.
+
+//////////////////////////////////////////////////////////
+
+namespace
+{
+
+const char* TEST_IMAGE_FILE_NAME = TEST_RESOURCE_DIR "/icon-edit.png";
+const char* TEST_NON_FILE_URL = "http://localhost/image.png";
+
+/**
+ * Creates a temporary file to be modified by the test.
+ */
+std::string CreateTemporaryFile()
+{
+  char fileName[] = "/tmp/dali-image-dimensions-XXXXXX";
+  const int fd = mkstemp( fileName );
+  if( fd >= 0 )
+  {
+    write( fd, "image", 5 );
+    close( fd );
+  }
+  return std::string( fileName );
+}
+
+void SetModificationTime( const std::string& fileName, time_t time )
+{
+  struct utimbuf times;
+  times.actime = time;
+  times.modtime = time;
+  utime( fileName.c_str(), &times );
+}
+
+} // namespace
+
+//////////////////////////////////////////////////////////
+
+int UtcDaliImageDimensionsCacheShared(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline(" UtcDaliImageDimensionsCacheShared");
+
+  Internal::ImageDimensionsCachePtr cache = Internal::ImageDimensionsCache::Get();
+  DALI_TEST_CHECK( cache );
+  DALI_TEST_CHECK( cache == Internal::ImageDimensionsCache::Get() );
+
+  TestPlatformAbstraction& platform = application.GetPlatform();
+  platform.SetClosestImageSize( Vector2( 34.f, 34.f ) );
+  DALI_TEST_CHECK( cache->GetImageSize( TEST_IMAGE_FILE_NAME ) == ImageDimensions( 34, 34 ) );
+  DALI_TEST_EQUALS( cache->GetNumberOfEntries(), 1u, TEST_LOCATION );
+
+  // The file is not modified, the cached dimensions are used.
+  platform.SetClosestImageSize( Vector2( 50.f, 50.f ) );
+  DALI_TEST_CHECK( cache->GetImageSize( TEST_IMAGE_FILE_NAME ) == ImageDimensions( 34, 34 ) );
+
+  // The natural size of the image visuals uses the same cache.
+  VisualFactory factory = VisualFactory::Get();
+  Property::Map propertyMap;
+  propertyMap.Insert( Visual::Property::TYPE, Visual::IMAGE );
+  propertyMap.Insert( ImageVisual::Property::URL, TEST_IMAGE_FILE_NAME );
+  Visual::Base visual = factory.CreateVisual( propertyMap );
+
+  Vector2 naturalSize;
+  visual.GetNaturalSize( naturalSize );
+  DALI_TEST_EQUALS( naturalSize, Vector2( 34.f, 34.f ), TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliImageDimensionsCacheModifiedFile(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline(" UtcDaliImageDimensionsCacheModifiedFile");
+
+  const std::string fileName = CreateTemporaryFile();
+  SetModificationTime( fileName, 1000 );
+
+  Internal::ImageDimensionsCachePtr cache = Internal::ImageDimensionsCache::Get();
+  TestPlatformAbstraction& platform = application.GetPlatform();
+
+  platform.SetClosestImageSize( Vector2( 20.f, 30.f ) );
+  DALI_TEST_CHECK( cache->GetImageSize( fileName ) == ImageDimensions( 20, 30 ) );
+
+  platform.SetClosestImageSize( Vector2( 40.f, 60.f ) );
+  DALI_TEST_CHECK( cache->GetImageSize( fileName ) == ImageDimensions( 20, 30 ) );
+
+  // The dimensions are read again when the file is modified.
+  SetModificationTime( fileName, 2000 );
+  DALI_TEST_CHECK( cache->GetImageSize( fileName ) == ImageDimensions( 40, 60 ) );
+
+  // The entry is removed if the file can't be read any more.
+  platform.SetClosestImageSize( Vector2::ZERO );
+  SetModificationTime( fileName, 3000 );
+  DALI_TEST_CHECK( cache->GetImageSize( fileName ) == ImageDimensions() );
+  DALI_TEST_EQUALS( cache->GetNumberOfEntries(), 0u, TEST_LOCATION );
+
+  unlink( fileName.c_str() );
+
+  END_TEST;
+}
+
+int UtcDaliImageDimensionsCacheNonFileUrl(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline(" UtcDaliImageDimensionsCacheNonFileUrl");
+
+  Internal::ImageDimensionsCachePtr cache = Internal::ImageDimensionsCache::Get();
+  TestPlatformAbstraction& platform = application.GetPlatform();
+
+  // The urls which are not local files are not cached.
+  platform.SetClosestImageSize( Vector2( 20.f, 30.f ) );
+  DALI_TEST_CHECK( cache->GetImageSize( TEST_NON_FILE_URL ) == ImageDimensions( 20, 30 ) );
+  DALI_TEST_EQUALS( cache->GetNumberOfEntries(), 0u, TEST_LOCATION );
+
+  platform.SetClosestImageSize( Vector2( 40.f, 60.f ) );
+  DALI_TEST_CHECK( cache->GetImageSize( TEST_NON_FILE_URL ) == ImageDimensions( 40, 60 ) );
+
+  END_TEST;
+}
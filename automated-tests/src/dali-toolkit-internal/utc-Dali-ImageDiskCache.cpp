@@ -0,0 +1,255 @@
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <unistd.h>
+#include <utime.h>
+#include <dali-toolkit/internal/image-atlas/image-disk-cache.h>
+#include <dali-toolkit-test-suite-utils.h>
+#include <dali-toolkit/dali-toolkit.h>
+#include <dali-toolkit/devel-api/image-atlas/image-atlas.h>
+
+
+using namespace Dali;
+using namespace Toolkit;
+
+// Tests the disk cache of the rasterized svg image pixels.
+
+//////////////////////////////////////////////////////////
+
+namespace
+{
+
+const unsigned int TEST_WIDTH = 7u;
+const unsigned int TEST_HEIGHT = 5u;
+const unsigned long long TEST_BUDGET = 1024u * 1024u;
+
+/**
+ * Creates a temporary directory for the cache files.
+ */
+std::string CreateTemporaryDirectory()
+{
+  char directory[] = "/tmp/dali-image-disk-cache-XXXXXX";
+  if( NULL == mkdtemp( directory ) )
+  {
+    return std::string();
+  }
+  return std::string( directory );
+}
+
+/**
+ * Creates a file standing for the image file the pixels are decoded from.
+ */
+std::string CreateImageFile( const std::string& directory )
+{
+  const std::string fileName = directory + "/image.png";
+  FILE* file = fopen( fileName.c_str(), "w" );
+  if( file )
+  {
+    fputs( "image", file );
+    fclose( file );
+  }
+  return fileName;
+}
+
+void SetModificationTime( const std::string& fileName, time_t time )
+{
+  struct utimbuf times;
+  times.actime = time;
+  times.modtime = time;
+  utime( fileName.c_str(), &times );
+}
+
+void RemoveDirectory( const std::string& directory )
+{
+  const std::string command = "rm -rf " + directory;
+  system( command.c_str() );
+}
+
+void CreatePixels( std::vector<unsigned char>& pixels )
+{
+  pixels.resize( TEST_WIDTH * TEST_HEIGHT * 4u );
+  for( unsigned int index = 0u; index < pixels.size(); ++index )
+  {
+    pixels[index] = static_cast<unsigned char>( index );
+  }
+}
+
+} // namespace
+
+//////////////////////////////////////////////////////////
+
+int UtcDaliImageDiskCacheStoreAndLoad(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline(" UtcDaliImageDiskCacheStoreAndLoad");
+
+  const std::string directory = CreateTemporaryDirectory();
+  const std::string imageFile = CreateImageFile( directory );
+
+  Internal::ImageDiskCachePtr cache = Internal::ImageDiskCache::New( directory + "/cache", TEST_BUDGET );
+  DALI_TEST_CHECK( cache );
+
+  const Internal::ImageDiskCache::Key key( imageFile, ImageDimensions( TEST_WIDTH, TEST_HEIGHT ), FittingMode::SCALE_TO_FILL );
+  DALI_TEST_CHECK( !cache->Load( key ) );
+
+  std::vector<unsigned char> pixels;
+  CreatePixels( pixels );
+  DALI_TEST_CHECK( cache->Store( key, &pixels[0], TEST_WIDTH, TEST_HEIGHT, Pixel::RGBA8888 ) );
+
+  PixelData pixelData = cache->Load( key );
+  DALI_TEST_CHECK( pixelData );
+  DALI_TEST_EQUALS( pixelData.GetWidth(), TEST_WIDTH, TEST_LOCATION );
+  DALI_TEST_EQUALS( pixelData.GetHeight(), TEST_HEIGHT, TEST_LOCATION );
+  DALI_TEST_EQUALS( pixelData.GetPixelFormat(), Pixel::RGBA8888, TEST_LOCATION );
+
+  // The loaded pixels go straight to the atlas.
+  ImageAtlas atlas = ImageAtlas::New( 100, 100 );
+  Vector4 textureRect;
+  DALI_TEST_CHECK( atlas.Upload( textureRect, pixelData ) );
+
+  // The pixels are stored by size and load parameters.
+  DALI_TEST_CHECK( !cache->Load( Internal::ImageDiskCache::Key( imageFile, ImageDimensions( TEST_WIDTH, TEST_HEIGHT ) ) ) );
+  DALI_TEST_CHECK( !cache->Load( Internal::ImageDiskCache::Key( imageFile, ImageDimensions( TEST_WIDTH, TEST_WIDTH ), FittingMode::SCALE_TO_FILL ) ) );
+
+  // The vector images rasterized at another dpi don't share the pixels.
+  const Internal::ImageDiskCache::Key dpiKey( imageFile, ImageDimensions( TEST_WIDTH, TEST_HEIGHT ), FittingMode::SCALE_TO_FILL, SamplingMode::DEFAULT, 96.f );
+  DALI_TEST_CHECK( !cache->Load( dpiKey ) );
+  DALI_TEST_CHECK( cache->Store( dpiKey, &pixels[0], TEST_WIDTH, TEST_HEIGHT, Pixel::RGBA8888 ) );
+  DALI_TEST_CHECK( cache->Load( dpiKey ) );
+  DALI_TEST_CHECK( !cache->Load( Internal::ImageDiskCache::Key( imageFile, ImageDimensions( TEST_WIDTH, TEST_HEIGHT ), FittingMode::SCALE_TO_FILL, SamplingMode::DEFAULT, 120.f ) ) );
+
+  // The pixels are kept in the directory for the next launch.
+  cache.Reset();
+  cache = Internal::ImageDiskCache::New( directory + "/cache", TEST_BUDGET );
+  DALI_TEST_CHECK( cache->Load( key ) );
+
+  RemoveDirectory( directory );
+
+  END_TEST;
+}
+
+int UtcDaliImageDiskCacheModifiedFile(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline(" UtcDaliImageDiskCacheModifiedFile");
+
+  const std::string directory = CreateTemporaryDirectory();
+  const std::string imageFile = CreateImageFile( directory );
+  SetModificationTime( imageFile, 1000 );
+
+  Internal::ImageDiskCachePtr cache = Internal::ImageDiskCache::New( directory, TEST_BUDGET );
+  const Internal::ImageDiskCache::Key key( imageFile, ImageDimensions( TEST_WIDTH, TEST_HEIGHT ) );
+
+  std::vector<unsigned char> pixels;
+  CreatePixels( pixels );
+  DALI_TEST_CHECK( cache->Store( key, &pixels[0], TEST_WIDTH, TEST_HEIGHT, Pixel::RGBA8888 ) );
+  DALI_TEST_CHECK( cache->Load( key ) );
+
+  // The pixels are not used once the image file is modified.
+  SetModificationTime( imageFile, 2000 );
+  DALI_TEST_CHECK( !cache->Load( key ) );
+
+  // They are replaced when stored again.
+  DALI_TEST_CHECK( cache->Store( key, &pixels[0], TEST_WIDTH, TEST_HEIGHT, Pixel::RGBA8888 ) );
+  DALI_TEST_CHECK( cache->Load( key ) );
+
+  // Nothing is stored for the urls which are not local files.
+  const Internal::ImageDiskCache::Key nonFileKey( directory + "/non-exist.png", ImageDimensions( TEST_WIDTH, TEST_HEIGHT ) );
+  DALI_TEST_CHECK( !cache->Store( nonFileKey, &pixels[0], TEST_WIDTH, TEST_HEIGHT, Pixel::RGBA8888 ) );
+
+  RemoveDirectory( directory );
+
+  END_TEST;
+}
+
+int UtcDaliImageDiskCacheDisabled(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline(" UtcDaliImageDiskCacheDisabled");
+
+  // The cache is not enabled unless the environment variable is set.
+  DALI_TEST_CHECK( !Internal::ImageDiskCache::Get() );
+
+  // Only absolute directories are used.
+  DALI_TEST_CHECK( !Internal::ImageDiskCache::New( "relative", TEST_BUDGET ) );
+  DALI_TEST_CHECK( !Internal::ImageDiskCache::New( "", TEST_BUDGET ) );
+
+  END_TEST;
+}
+
+int UtcDaliImageDiskCacheBudget(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline(" UtcDaliImageDiskCacheBudget");
+
+  const std::string directory = CreateTemporaryDirectory();
+  const std::string imageFile = CreateImageFile( directory );
+
+  std::vector<unsigned char> pixels;
+  CreatePixels( pixels );
+
+  // The budget fits the files of two keys, but not three, with the header and the key stored besides the pixels.
+  const unsigned long long budget = 2u * ( pixels.size() + 128u );
+  Internal::ImageDiskCachePtr cache = Internal::ImageDiskCache::New( directory + "/cache", budget );
+  DALI_TEST_CHECK( cache );
+  DALI_TEST_CHECK( budget == cache->GetBudget() );
+
+  const Internal::ImageDiskCache::Key key1( imageFile, ImageDimensions( TEST_WIDTH, TEST_HEIGHT ) );
+  const Internal::ImageDiskCache::Key key2( imageFile, ImageDimensions( TEST_WIDTH, TEST_HEIGHT ), FittingMode::SCALE_TO_FILL );
+  const Internal::ImageDiskCache::Key key3( imageFile, ImageDimensions( TEST_WIDTH, TEST_HEIGHT ), FittingMode::FIT_WIDTH );
+
+  // The files are ordered by the time they were last used, so wait between the operations.
+  DALI_TEST_CHECK( cache->Store( key1, &pixels[0], TEST_WIDTH, TEST_HEIGHT, Pixel::RGBA8888 ) );
+  usleep( 20000 );
+  DALI_TEST_CHECK( cache->Store( key2, &pixels[0], TEST_WIDTH, TEST_HEIGHT, Pixel::RGBA8888 ) );
+  usleep( 20000 );
+
+  // Loading the first pixels makes the second ones the least recently used.
+  DALI_TEST_CHECK( cache->Load( key1 ) );
+  usleep( 20000 );
+
+  DALI_TEST_CHECK( cache->Store( key3, &pixels[0], TEST_WIDTH, TEST_HEIGHT, Pixel::RGBA8888 ) );
+  DALI_TEST_CHECK( cache->Load( key1 ) );
+  DALI_TEST_CHECK( !cache->Load( key2 ) );
+  DALI_TEST_CHECK( cache->Load( key3 ) );
+
+  // Storing the same key again replaces its file without removing the other ones.
+  for( unsigned int index = 0u; index < 4u; ++index )
+  {
+    DALI_TEST_CHECK( cache->Store( key3, &pixels[0], TEST_WIDTH, TEST_HEIGHT, Pixel::RGBA8888 ) );
+  }
+  DALI_TEST_CHECK( cache->Load( key1 ) );
+  DALI_TEST_CHECK( cache->Load( key3 ) );
+
+  // The pixels just stored are kept even if they are over the budget on their own.
+  Internal::ImageDiskCachePtr smallCache = Internal::ImageDiskCache::New( directory + "/small", 1u );
+  DALI_TEST_CHECK( smallCache->Store( key1, &pixels[0], TEST_WIDTH, TEST_HEIGHT, Pixel::RGBA8888 ) );
+  DALI_TEST_CHECK( smallCache->Load( key1 ) );
+  DALI_TEST_CHECK( smallCache->Store( key2, &pixels[0], TEST_WIDTH, TEST_HEIGHT, Pixel::RGBA8888 ) );
+  DALI_TEST_CHECK( !smallCache->Load( key1 ) );
+  DALI_TEST_CHECK( smallCache->Load( key2 ) );
+
+  RemoveDirectory( directory );
+
+  END_TEST;
+}
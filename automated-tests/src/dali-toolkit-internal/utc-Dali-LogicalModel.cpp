@@ -20,6 +20,7 @@
 #include <stdlib.h>
 
 #include <dali-toolkit-test-suite-utils.h>
+#include <dali-toolkit/internal/text/script-run.h>
 #include <dali-toolkit/internal/text/text-run-container.h>
 #include <dali-toolkit/dali-toolkit.h>
 #include <toolkit-text-model.h>
@@ -39,6 +40,8 @@ using namespace Text;
 // bool FetchBidirectionalLineInfo( CharacterIndex characterIndex )
 // CharacterIndex GetLogicalCharacterIndex( CharacterIndex visualCharacterIndex ) const;
 // CharacterIndex GetLogicalCursorIndex( CharacterIndex visualCursorIndex ) const;
+// Length FindFirstCharacterRun( const Vector<T>& runs, CharacterIndex characterIndex );
+// bool FindCharacterRun( const Vector<T>& runs, CharacterIndex characterIndex, Length& runIndex );
 
 //////////////////////////////////////////////////////////
 
@@ -945,3 +948,53 @@ int UtcDaliGetLogicalCursorIndex(void)
   tet_result(TET_PASS);
   END_TEST;
 }
+
+int UtcDaliFindCharacterRun(void)
+{
+  tet_infoline(" UtcDaliFindCharacterRun");
+
+  // Runs sorted by character index with a gap between the characters 10 and 14.
+  const CharacterIndex characterIndices[] = { 0u, 3u, 7u, 15u, 20u };
+  const Length numberOfCharacters[] = { 3u, 4u, 3u, 5u, 1u };
+  const Length numberOfRuns = 5u;
+
+  Vector<ScriptRun> runs;
+  for( Length index = 0u; index < numberOfRuns; ++index )
+  {
+    ScriptRun run;
+    run.characterRun.characterIndex = characterIndices[index];
+    run.characterRun.numberOfCharacters = numberOfCharacters[index];
+    run.script = TextAbstraction::LATIN;
+    runs.PushBack( run );
+  }
+
+  // The expected first run which ends after each character and whether the character is inside a run.
+  const Length expectedRunIndices[] = { 0u, 0u, 0u, 1u, 1u, 1u, 1u, 2u, 2u, 2u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 4u, 5u, 5u };
+  const bool expectedFound[] = { true, true, true, true, true, true, true, true, true, true, false, false, false, false, false, true, true, true, true, true, true, false, false };
+  const CharacterIndex numberOfCharactersToTest = 23u;
+
+  for( CharacterIndex characterIndex = 0u; characterIndex < numberOfCharactersToTest; ++characterIndex )
+  {
+    if( expectedRunIndices[characterIndex] != FindFirstCharacterRun( runs, characterIndex ) )
+    {
+      tet_printf( "  different first run for the character : %d\n", characterIndex );
+      tet_result(TET_FAIL);
+    }
+
+    Length runIndex = 0u;
+    if( expectedFound[characterIndex] != FindCharacterRun( runs, characterIndex, runIndex ) )
+    {
+      tet_printf( "  different result finding the run for the character : %d\n", characterIndex );
+      tet_result(TET_FAIL);
+    }
+  }
+
+  // No runs.
+  Vector<ScriptRun> emptyRuns;
+  Length runIndex = 0u;
+  DALI_TEST_EQUALS( FindFirstCharacterRun( emptyRuns, 0u ), 0u, TEST_LOCATION );
+  DALI_TEST_CHECK( !FindCharacterRun( emptyRuns, 0u, runIndex ) );
+
+  tet_result(TET_PASS);
+  END_TEST;
+}
@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <iostream>
+
+#include <stdlib.h>
+#include <dali/devel-api/adaptor-framework/environment-variable.h>
+#include <dali-toolkit/internal/visuals/image-atlas-manager.h>
+#include <dali-toolkit/internal/visuals/svg/svg-rasterize-thread.h>
+#include <dali-toolkit/internal/visuals/svg/svg-visual.h>
+#include <dali-toolkit/internal/visuals/visual-factory-cache.h>
+#include <dali-toolkit-test-suite-utils.h>
+#include <toolkit-environment-variable.h>
+#include <toolkit-event-thread-callback.h>
+#include <dali-toolkit/dali-toolkit.h>
+
+
+using namespace Dali;
+using namespace Toolkit;
+
+// Tests the cancellation and the priorities of the tasks of the svg rasterize thread pool.
+// The tasks are queued before the worker thread is started, so the order they're processed is known.
+
+//////////////////////////////////////////////////////////
+
+namespace
+{
+
+const char* TEST_SVG_FILE_NAME = TEST_RESOURCE_DIR "/svg1.svg";
+const float TEST_DPI = 96.f;
+
+void RasterizedSvgCallback()
+{
+}
+
+/**
+ * Creates a pool with a single worker thread, which is not started.
+ */
+Internal::SvgRasterizeThreadPool* CreateThreadPool()
+{
+  // DALI_SVG_RASTERIZE_THREADS is read when the pool is created.
+  EnvironmentVariable::SetTestingEnvironmentVariable( true );
+  Internal::SvgRasterizeThreadPool* threadPool = new Internal::SvgRasterizeThreadPool( new EventThreadCallback( MakeCallback( &RasterizedSvgCallback ) ) );
+  EnvironmentVariable::SetTestingEnvironmentVariable( false );
+
+  return threadPool;
+}
+
+} // namespace
+
+//////////////////////////////////////////////////////////
+
+int UtcDaliSvgRasterizeThreadPoolCancelledTask(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline(" UtcDaliSvgRasterizeThreadPoolCancelledTask");
+
+  IntrusivePtr< Internal::VisualFactoryCache > cache = new Internal::VisualFactoryCache();
+  IntrusivePtr< Internal::ImageAtlasManager > atlasManager = new Internal::ImageAtlasManager();
+  IntrusivePtr< Internal::SvgVisual > visual1 = new Internal::SvgVisual( *cache, *atlasManager );
+  IntrusivePtr< Internal::SvgVisual > visual2 = new Internal::SvgVisual( *cache, *atlasManager );
+
+  Internal::SvgDocumentPtr document = cache->GetSvgDocumentCache().GetDocument( TEST_SVG_FILE_NAME, TEST_DPI );
+
+  Internal::SvgRasterizeThreadPool* threadPool = CreateThreadPool();
+  DALI_TEST_EQUALS( threadPool->GetNumberOfThreads(), 1u, TEST_LOCATION );
+
+  Internal::RasterizingTaskPtr cancelledTask = new Internal::RasterizingTask( visual1.Get(), document, 100u, 100u, Internal::RasterizingTask::HIGH );
+  Internal::RasterizingTaskPtr task = new Internal::RasterizingTask( visual2.Get(), document, 50u, 50u, Internal::RasterizingTask::HIGH );
+  threadPool->AddTask( cancelledTask );
+  threadPool->AddTask( task );
+
+  // The visual goes off stage before its task runs.
+  DALI_TEST_CHECK( threadPool->RemoveTask( cancelledTask, visual1.Get() ) );
+  DALI_TEST_CHECK( 0u == cancelledTask->GetSvgVisuals().Count() );
+
+  // The worker thread skips the cancelled task.
+  threadPool->Start();
+
+  EventThreadCallback* eventTrigger = EventThreadCallback::Get();
+  eventTrigger->WaitingForTrigger( 1u );
+
+  Internal::RasterizingTaskPtr completedTask = threadPool->NextCompletedTask();
+  DALI_TEST_CHECK( completedTask == task );
+  DALI_TEST_CHECK( completedTask->GetPixelData() );
+  DALI_TEST_CHECK( !threadPool->NextCompletedTask() );
+
+  // The cancelled task is not rasterized, so there is nothing to apply.
+  DALI_TEST_CHECK( !cancelledTask->GetPixelData() );
+
+  // The pool releases it in the main thread the next time a task is added or removed.
+  DALI_TEST_CHECK( threadPool->RemoveTask( task, visual2.Get() ) );
+  DALI_TEST_EQUALS( cancelledTask->ReferenceCount(), 1, TEST_LOCATION );
+
+  Internal::SvgRasterizeThreadPool::TerminateThreadPool( threadPool );
+  DALI_TEST_CHECK( NULL == threadPool );
+
+  END_TEST;
+}
+
+int UtcDaliSvgRasterizeThreadPoolPriority(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline(" UtcDaliSvgRasterizeThreadPoolPriority");
+
+  IntrusivePtr< Internal::VisualFactoryCache > cache = new Internal::VisualFactoryCache();
+  IntrusivePtr< Internal::ImageAtlasManager > atlasManager = new Internal::ImageAtlasManager();
+  IntrusivePtr< Internal::SvgVisual > visual = new Internal::SvgVisual( *cache, *atlasManager );
+
+  Internal::SvgDocumentPtr document = cache->GetSvgDocumentCache().GetDocument( TEST_SVG_FILE_NAME, TEST_DPI );
+
+  Internal::SvgRasterizeThreadPool* threadPool = CreateThreadPool();
+
+  // The visuals already showing an image are resized.
+  const unsigned int numberOfTasks = 4u;
+  Internal::RasterizingTaskPtr tasks[numberOfTasks];
+  for( unsigned int index = 0u; index < numberOfTasks - 1u; ++index )
+  {
+    const unsigned int size = 64u + index;
+    tasks[index] = new Internal::RasterizingTask( visual.Get(), document, size, size, Internal::RasterizingTask::NORMAL );
+    threadPool->AddTask( tasks[index] );
+  }
+
+  // Then a visual is put on stage.
+  Internal::RasterizingTaskPtr highPriorityTask = new Internal::RasterizingTask( visual.Get(), document, 32u, 32u, Internal::RasterizingTask::HIGH );
+  threadPool->AddTask( highPriorityTask );
+
+  threadPool->Start();
+
+  EventThreadCallback* eventTrigger = EventThreadCallback::Get();
+  eventTrigger->WaitingForTrigger( numberOfTasks );
+
+  // The task with the high priority completes first, then the other ones in the order they were added.
+  DALI_TEST_CHECK( threadPool->NextCompletedTask() == highPriorityTask );
+  for( unsigned int index = 0u; index < numberOfTasks - 1u; ++index )
+  {
+    DALI_TEST_CHECK( threadPool->NextCompletedTask() == tasks[index] );
+  }
+  DALI_TEST_CHECK( !threadPool->NextCompletedTask() );
+
+  Internal::SvgRasterizeThreadPool::TerminateThreadPool( threadPool );
+
+  END_TEST;
+}
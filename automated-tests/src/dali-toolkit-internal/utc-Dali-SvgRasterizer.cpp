@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <stdlib.h>
+#include <string.h>
+#include <dali-toolkit/third-party/nanosvg/nanosvg.h>
+#include <dali-toolkit/third-party/nanosvg/nanosvgrast.h>
+#include <dali-toolkit-test-suite-utils.h>
+#include <dali-toolkit/dali-toolkit.h>
+
+
+using namespace Dali;
+using namespace Toolkit;
+
+// Tests the vectorised span compositing of the following function.
+//
+// void nsvgRasterize( NSVGrasterizer* r, NSVGimage* image, float tx, float ty, float scale, unsigned char* dst, int w, int h, int stride );
+
+//////////////////////////////////////////////////////////
+
+namespace
+{
+
+const char* TEST_SVG_FILE_NAME = TEST_RESOURCE_DIR "/svg1.svg";
+
+// Svg documents with the paints not used by the test resources.
+const char* const TEST_SVG_DOCUMENTS[] =
+{
+  // Linear gradient with a translucent stop and opacity.
+  "<svg width='100' height='100'>"
+  "<linearGradient id='g' x1='0' y1='0' x2='1' y2='1'>"
+  "<stop offset='0' stop-color='#f00'/><stop offset='0.5' stop-color='#0f0' stop-opacity='0.5'/><stop offset='1' stop-color='#00f'/>"
+  "</linearGradient>"
+  "<rect x='3.3' y='5.1' width='90' height='80' fill='url(#g)'/>"
+  "<circle cx='40' cy='40' r='30' fill='url(#g)' opacity='0.7'/>"
+  "</svg>",
+
+  // Radial gradient fill and stroke over a translucent solid fill.
+  "<svg width='100' height='100'>"
+  "<radialGradient id='g' cx='0.4' cy='0.5' r='0.6'>"
+  "<stop offset='0' stop-color='#ff0'/><stop offset='0.7' stop-color='#0ff' stop-opacity='0.3'/><stop offset='1' stop-color='#f0f'/>"
+  "</radialGradient>"
+  "<rect x='10' y='10' width='30' height='70' fill='#8040c0' fill-opacity='0.6'/>"
+  "<ellipse cx='50' cy='50' rx='45' ry='33' fill='url(#g)' stroke='url(#g)' stroke-width='5'/>"
+  "</svg>",
+
+  // Even-odd solid fill with a translucent stroke.
+  "<svg width='100' height='100'>"
+  "<path d='M10 10 L90 20 L50 95 Z M30 30 L60 40 L45 70 Z' fill='#123456' fill-rule='evenodd' stroke='#ff8800' stroke-width='3' stroke-opacity='0.5'/>"
+  "</svg>",
+};
+const unsigned int NUMBER_OF_TEST_SVG_DOCUMENTS = sizeof( TEST_SVG_DOCUMENTS ) / sizeof( TEST_SVG_DOCUMENTS[0] );
+
+/**
+ * Parses the svg file of the test resources and the test documents.
+ */
+void ParseTestImages( std::vector<NSVGimage*>& images )
+{
+  images.push_back( nsvgParseFromFile( TEST_SVG_FILE_NAME, "px", 96.f ) );
+
+  for( unsigned int index = 0u; index < NUMBER_OF_TEST_SVG_DOCUMENTS; ++index )
+  {
+    // nsvgParse() modifies the input.
+    std::string document( TEST_SVG_DOCUMENTS[index] );
+    images.push_back( nsvgParse( &document[0], "px", 96.f ) );
+  }
+}
+
+void DeleteTestImages( std::vector<NSVGimage*>& images )
+{
+  for( std::vector<NSVGimage*>::iterator it = images.begin(), endIt = images.end(); it != endIt; ++it )
+  {
+    nsvgDelete( *it );
+  }
+  images.clear();
+}
+
+/**
+ * Rasterizes the image into a buffer of the given width, keeping the aspect ratio.
+ */
+void RasterizeImage( NSVGrasterizer* rasterizer, NSVGimage* image, unsigned int width, std::vector<unsigned char>& buffer )
+{
+  const float scale = static_cast<float>( width ) / image->width;
+  const unsigned int height = static_cast<unsigned int>( image->height * scale );
+
+  buffer.resize( width * height * 4u );
+  nsvgRasterize( rasterizer, image, 0.f, 0.f, scale, &buffer[0], width, height, width * 4u );
+}
+
+} // namespace
+
+//////////////////////////////////////////////////////////
+
+int UtcDaliSvgRasterizerSimdPixelExact(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline(" UtcDaliSvgRasterizerSimdPixelExact");
+
+  std::vector<NSVGimage*> images;
+  ParseTestImages( images );
+
+  NSVGrasterizer* rasterizer = nsvgCreateRasterizer();
+  DALI_TEST_CHECK( NULL != rasterizer );
+
+  const int simd = nsvgSetRasterizerSimd( rasterizer, 1 );
+  tet_printf( "  vectorised path %s\n", simd ? "enabled" : "not available" );
+
+  // Odd sizes leave pixels to the scalar tails of the vectorised loops.
+  const unsigned int widths[] = { 17u, 64u, 100u, 255u, 512u };
+  const unsigned int numberOfWidths = sizeof( widths ) / sizeof( widths[0] );
+
+  std::vector<unsigned char> scalarBuffer;
+  std::vector<unsigned char> simdBuffer;
+  for( unsigned int imageIndex = 0u; imageIndex < images.size(); ++imageIndex )
+  {
+    DALI_TEST_CHECK( NULL != images[imageIndex] );
+
+    for( unsigned int widthIndex = 0u; widthIndex < numberOfWidths; ++widthIndex )
+    {
+      nsvgSetRasterizerSimd( rasterizer, 0 );
+      RasterizeImage( rasterizer, images[imageIndex], widths[widthIndex], scalarBuffer );
+
+      nsvgSetRasterizerSimd( rasterizer, 1 );
+      RasterizeImage( rasterizer, images[imageIndex], widths[widthIndex], simdBuffer );
+
+      if( 0 != memcmp( &scalarBuffer[0], &simdBuffer[0], scalarBuffer.size() ) )
+      {
+        tet_printf( "  image %d rasterized at width %d differs from the scalar path\n", imageIndex, widths[widthIndex] );
+        tet_result(TET_FAIL);
+      }
+    }
+  }
+
+  nsvgDeleteRasterizer( rasterizer );
+  DeleteTestImages( images );
+
+  tet_result(TET_PASS);
+  END_TEST;
+}
@@ -0,0 +1,391 @@
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <iostream>
+
+#include <stdlib.h>
+#include <string.h>
+#include <dali-toolkit/internal/text/rendering/atlas/atlas-manager.h>
+#include <dali-toolkit/internal/text/rendering/atlas/atlas-glyph-manager.h>
+#include <dali-toolkit/internal/text/rendering/atlas/atlas-glyph-manager-impl.h>
+#include <dali-toolkit-test-suite-utils.h>
+#include <dali-toolkit/dali-toolkit.h>
+
+
+using namespace Dali;
+using namespace Toolkit;
+
+// Tests the placement and the uploads of the images stored in the glyph atlases, and the reuse of the glyph quads by the atlas renderer.
+
+//////////////////////////////////////////////////////////
+
+namespace
+{
+
+/**
+ * Creates an L8 image of the given size.
+ */
+PixelData CreateImage( unsigned int width, unsigned int height )
+{
+  const unsigned int bufferSize = width * height;
+  unsigned char* buffer = new unsigned char[ bufferSize ];
+  memset( buffer, 0xFF, bufferSize );
+  return PixelData::New( buffer, bufferSize, width, height, Pixel::L8, PixelData::DELETE_ARRAY );
+}
+
+/**
+ * Whether an area of the given size has been uploaded to the given position of a texture.
+ */
+bool FindUpload( TraceCallStack& callStack, unsigned int x, unsigned int y, unsigned int width, unsigned int height )
+{
+  TraceCallStack::NamedParams params;
+  params["xoffset"] = ToString( x );
+  params["yoffset"] = ToString( y );
+  params["width"] = ToString( width );
+  params["height"] = ToString( height );
+  return callStack.FindMethodAndParams( "TexSubImage2D", params );
+}
+
+/**
+ * Creates an atlas, and starts tracing the texture calls once the atlas has been cleared.
+ */
+AtlasManager::AtlasId CreateAtlas( ToolkitTestApplication& application, AtlasManager& manager, unsigned int width, unsigned int height )
+{
+  AtlasManager::AtlasSize size;
+  size.mWidth = width;
+  size.mHeight = height;
+  size.mBlockWidth = 16u;
+  size.mBlockHeight = 16u;
+  const AtlasManager::AtlasId atlasId = manager.CreateAtlas( size, Pixel::L8 );
+
+  application.SendNotification();
+  application.Render();
+
+  TraceCallStack& callStack = application.GetGlAbstraction().GetTextureTrace();
+  callStack.Reset();
+  callStack.Enable( true );
+
+  return atlasId;
+}
+
+/**
+ * Adds a glyph of the given font and index to the glyph manager.
+ */
+AtlasManager::AtlasSlot AddGlyph( Internal::AtlasGlyphManager& glyphManager, Text::FontId fontId, Text::GlyphIndex index )
+{
+  Text::GlyphInfo glyph;
+  glyph.fontId = fontId;
+  glyph.index = index;
+
+  AtlasManager::AtlasSlot slot;
+  glyphManager.Add( glyph, CreateImage( 14u, 14u ), slot );
+  return slot;
+}
+
+bool IsGlyphCached( Internal::AtlasGlyphManager& glyphManager, Text::FontId fontId, Text::GlyphIndex index )
+{
+  AtlasManager::AtlasSlot slot;
+  return glyphManager.IsCached( fontId, index, slot );
+}
+
+} // namespace
+
+//////////////////////////////////////////////////////////
+
+int UtcDaliTextAtlasManagerFixedBlockUploads(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline(" UtcDaliTextAtlasManagerFixedBlockUploads");
+
+  AtlasManager manager = AtlasManager::New();
+  TraceCallStack& callStack = application.GetGlAbstraction().GetTextureTrace();
+
+  // Four blocks of 16x16 after the filled pixel in the top left corner.
+  const AtlasManager::AtlasId atlasId = CreateAtlas( application, manager, 33u, 33u );
+  DALI_TEST_EQUALS( atlasId, 1u, TEST_LOCATION );
+  DALI_TEST_EQUALS( manager.GetFreeBlocks( atlasId ), 4u, TEST_LOCATION );
+
+  AtlasManager::AtlasSlot slots[4];
+  for( unsigned int index = 0u; index < 4u; ++index )
+  {
+    DALI_TEST_CHECK( !manager.Add( CreateImage( 10u, 10u ), slots[index] ) );
+    DALI_TEST_EQUALS( slots[index].mAtlasId, atlasId, TEST_LOCATION );
+  }
+
+  application.SendNotification();
+  application.Render();
+
+  // The atlas is cleared when created, so each image in a never used block is a single upload without padding.
+  DALI_TEST_EQUALS( callStack.CountMethod( "TexSubImage2D" ), 4, TEST_LOCATION );
+  DALI_TEST_CHECK( FindUpload( callStack, 2u, 2u, 10u, 10u ) );
+  DALI_TEST_CHECK( FindUpload( callStack, 18u, 2u, 10u, 10u ) );
+  DALI_TEST_CHECK( FindUpload( callStack, 2u, 18u, 10u, 10u ) );
+  DALI_TEST_CHECK( FindUpload( callStack, 18u, 18u, 10u, 10u ) );
+
+  // A recycled block is cleared with one upload before the new image is uploaded.
+  DALI_TEST_CHECK( manager.Remove( slots[1].mImageId ) );
+  callStack.Reset();
+
+  AtlasManager::AtlasSlot slot;
+  DALI_TEST_CHECK( !manager.Add( CreateImage( 12u, 12u ), slot ) );
+  DALI_TEST_EQUALS( slot.mAtlasId, atlasId, TEST_LOCATION );
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS( callStack.CountMethod( "TexSubImage2D" ), 2, TEST_LOCATION );
+  DALI_TEST_CHECK( FindUpload( callStack, 17u, 1u, 16u, 16u ) );
+  DALI_TEST_CHECK( FindUpload( callStack, 18u, 2u, 12u, 12u ) );
+
+  END_TEST;
+}
+
+int UtcDaliTextAtlasManagerVariableSizePacking(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline(" UtcDaliTextAtlasManagerVariableSizePacking");
+
+  AtlasManager manager = AtlasManager::New();
+  manager.SetPackingMode( AtlasManager::PACK_VARIABLE_SIZE );
+  TraceCallStack& callStack = application.GetGlAbstraction().GetTextureTrace();
+
+  // A packed area of 64x64 after the filled pixel in the top left corner.
+  const AtlasManager::AtlasId atlasId = CreateAtlas( application, manager, 65u, 65u );
+  DALI_TEST_EQUALS( manager.GetFreeBlocks( atlasId ), 64u * 64u, TEST_LOCATION );
+
+  // Each image reserves an area of its own size plus the padding.
+  AtlasManager::AtlasSlot slotA;
+  AtlasManager::AtlasSlot slotB;
+  DALI_TEST_CHECK( !manager.Add( CreateImage( 10u, 10u ), slotA ) );
+  DALI_TEST_CHECK( !manager.Add( CreateImage( 20u, 6u ), slotB ) );
+  DALI_TEST_EQUALS( slotA.mAtlasId, atlasId, TEST_LOCATION );
+  DALI_TEST_EQUALS( slotB.mAtlasId, atlasId, TEST_LOCATION );
+  DALI_TEST_EQUALS( manager.GetFreeBlocks( atlasId ), 64u * 64u - 12u * 12u - 22u * 8u, TEST_LOCATION );
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS( callStack.CountMethod( "TexSubImage2D" ), 2, TEST_LOCATION );
+  DALI_TEST_CHECK( FindUpload( callStack, 2u, 2u, 10u, 10u ) );
+  DALI_TEST_CHECK( FindUpload( callStack, 14u, 2u, 20u, 6u ) );
+
+  // The quad samples the image where it has been uploaded.
+  AtlasManager::Mesh2D mesh;
+  manager.GenerateMeshData( slotB.mImageId, Vector2::ZERO, mesh, false );
+  DALI_TEST_CHECK( 4u == mesh.mVertices.Count() );
+  DALI_TEST_EQUALS( mesh.mVertices[0].mTexCoords, Vector2( 13.5f / 65.f, 1.5f / 65.f ), Math::MACHINE_EPSILON_1000, TEST_LOCATION );
+  DALI_TEST_EQUALS( mesh.mVertices[3].mTexCoords, Vector2( 34.5f / 65.f, 8.5f / 65.f ), Math::MACHINE_EPSILON_1000, TEST_LOCATION );
+
+  // A removed image has its area cleared once.
+  callStack.Reset();
+  DALI_TEST_CHECK( manager.Remove( slotA.mImageId ) );
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS( callStack.CountMethod( "TexSubImage2D" ), 1, TEST_LOCATION );
+  DALI_TEST_CHECK( FindUpload( callStack, 1u, 1u, 12u, 12u ) );
+
+  // A smaller image reuses the freed area, with a single upload.
+  callStack.Reset();
+  AtlasManager::AtlasSlot slotC;
+  DALI_TEST_CHECK( !manager.Add( CreateImage( 8u, 8u ), slotC ) );
+  DALI_TEST_EQUALS( slotC.mAtlasId, atlasId, TEST_LOCATION );
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS( callStack.CountMethod( "TexSubImage2D" ), 1, TEST_LOCATION );
+  DALI_TEST_CHECK( FindUpload( callStack, 2u, 2u, 8u, 8u ) );
+
+  // The freed areas are merged, so a wide image is packed again from the top left corner.
+  DALI_TEST_CHECK( manager.Remove( slotB.mImageId ) );
+  DALI_TEST_CHECK( manager.Remove( slotC.mImageId ) );
+  DALI_TEST_EQUALS( manager.GetFreeBlocks( atlasId ), 64u * 64u, TEST_LOCATION );
+
+  application.SendNotification();
+  application.Render();
+  callStack.Reset();
+
+  AtlasManager::AtlasSlot slotD;
+  DALI_TEST_CHECK( !manager.Add( CreateImage( 60u, 10u ), slotD ) );
+  DALI_TEST_EQUALS( slotD.mAtlasId, atlasId, TEST_LOCATION );
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS( callStack.CountMethod( "TexSubImage2D" ), 1, TEST_LOCATION );
+  DALI_TEST_CHECK( FindUpload( callStack, 2u, 2u, 60u, 10u ) );
+
+  END_TEST;
+}
+
+int UtcDaliTextAtlasGlyphManagerEviction(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline(" UtcDaliTextAtlasGlyphManagerEviction");
+
+  IntrusivePtr< Internal::AtlasGlyphManager > glyphManager = new Internal::AtlasGlyphManager();
+
+  // Each atlas stores four glyphs of 14x14 and uses 33x33 bytes, and the budget allows two atlases.
+  const Text::FontId fontId = 1u;
+  glyphManager->SetNewAtlasSize( 33u, 33u, 16u, 16u );
+  glyphManager->SetMemoryBudget( 2500u );
+
+  AtlasManager::AtlasSlot slots[10];
+  for( unsigned int index = 1u; index <= 8u; ++index )
+  {
+    slots[index] = AddGlyph( *glyphManager, fontId, index );
+  }
+  DALI_TEST_EQUALS( slots[1].mAtlasId, slots[4].mAtlasId, TEST_LOCATION );
+  DALI_TEST_EQUALS( slots[5].mAtlasId, slots[8].mAtlasId, TEST_LOCATION );
+  DALI_TEST_CHECK( slots[1].mAtlasId != slots[5].mAtlasId );
+
+  // The glyphs of the second atlas stop being used first; within the budget they stay cached.
+  for( unsigned int index = 5u; index <= 8u; ++index )
+  {
+    glyphManager->AdjustReferenceCount( fontId, index, -1 );
+  }
+  for( unsigned int index = 1u; index <= 4u; ++index )
+  {
+    glyphManager->AdjustReferenceCount( fontId, index, -1 );
+  }
+  DALI_TEST_EQUALS( glyphManager->GetMetrics().mUnreferencedGlyphCount, 8u, TEST_LOCATION );
+  DALI_TEST_EQUALS( glyphManager->GetMetrics().mGlyphCount, 8u, TEST_LOCATION );
+
+  // A third atlas exceeds the budget, but adding a glyph doesn't evict anything.
+  slots[9] = AddGlyph( *glyphManager, fontId, 9u );
+  DALI_TEST_CHECK( slots[9].mAtlasId != slots[1].mAtlasId );
+  DALI_TEST_CHECK( slots[9].mAtlasId != slots[5].mAtlasId );
+  AddGlyph( *glyphManager, fontId, 10u );
+  DALI_TEST_EQUALS( glyphManager->GetMetrics().mGlyphCount, 10u, TEST_LOCATION );
+
+  // When a glyph stops being used, the least recently used atlas storing only unreferenced glyphs is emptied and released.
+  glyphManager->AdjustReferenceCount( fontId, 10u, -1 );
+  for( unsigned int index = 5u; index <= 8u; ++index )
+  {
+    DALI_TEST_CHECK( !IsGlyphCached( *glyphManager, fontId, index ) );
+  }
+  for( unsigned int index = 1u; index <= 4u; ++index )
+  {
+    DALI_TEST_CHECK( IsGlyphCached( *glyphManager, fontId, index ) );
+  }
+  DALI_TEST_CHECK( IsGlyphCached( *glyphManager, fontId, 9u ) );
+  DALI_TEST_CHECK( IsGlyphCached( *glyphManager, fontId, 10u ) );
+  DALI_TEST_EQUALS( glyphManager->GetMetrics().mEvictedGlyphCount, 4u, TEST_LOCATION );
+  DALI_TEST_EQUALS( glyphManager->GetMetrics().mReleasedAtlasCount, 1u, TEST_LOCATION );
+  DALI_TEST_EQUALS( glyphManager->GetMetrics().mUnreferencedGlyphCount, 5u, TEST_LOCATION );
+  DALI_TEST_EQUALS( glyphManager->GetAtlasSize( slots[5].mAtlasId ), Vector2::ZERO, TEST_LOCATION );
+
+  // An unreferenced glyph used again is not evicted.
+  glyphManager->AdjustReferenceCount( fontId, 1u, 1 );
+  DALI_TEST_EQUALS( glyphManager->GetMetrics().mUnreferencedGlyphCount, 4u, TEST_LOCATION );
+
+  // Without atlas to release, the unreferenced glyphs stay cached until their areas are needed.
+  glyphManager->SetMemoryBudget( 1500u );
+  for( unsigned int index = 1u; index <= 4u; ++index )
+  {
+    DALI_TEST_CHECK( IsGlyphCached( *glyphManager, fontId, index ) );
+  }
+  DALI_TEST_EQUALS( glyphManager->GetMetrics().mEvictedGlyphCount, 4u, TEST_LOCATION );
+  DALI_TEST_EQUALS( glyphManager->GetMetrics().mUnreferencedGlyphCount, 4u, TEST_LOCATION );
+
+  // The glyphs fitting in the atlases don't evict anything.
+  DALI_TEST_EQUALS( AddGlyph( *glyphManager, fontId, 11u ).mAtlasId, slots[9].mAtlasId, TEST_LOCATION );
+  DALI_TEST_EQUALS( AddGlyph( *glyphManager, fontId, 12u ).mAtlasId, slots[9].mAtlasId, TEST_LOCATION );
+  DALI_TEST_EQUALS( glyphManager->GetMetrics().mEvictedGlyphCount, 4u, TEST_LOCATION );
+
+  // Otherwise only the least recently used glyph is evicted, and its area is reused.
+  DALI_TEST_EQUALS( AddGlyph( *glyphManager, fontId, 13u ).mAtlasId, slots[1].mAtlasId, TEST_LOCATION );
+  DALI_TEST_CHECK( !IsGlyphCached( *glyphManager, fontId, 2u ) );
+  DALI_TEST_CHECK( IsGlyphCached( *glyphManager, fontId, 3u ) );
+  DALI_TEST_CHECK( IsGlyphCached( *glyphManager, fontId, 4u ) );
+  DALI_TEST_CHECK( IsGlyphCached( *glyphManager, fontId, 10u ) );
+  DALI_TEST_EQUALS( glyphManager->GetMetrics().mEvictedGlyphCount, 5u, TEST_LOCATION );
+  DALI_TEST_EQUALS( glyphManager->GetMetrics().mUnreferencedGlyphCount, 3u, TEST_LOCATION );
+
+  // A glyph used again becomes the most recently used one.
+  glyphManager->AdjustReferenceCount( fontId, 3u, 1 );
+  glyphManager->AdjustReferenceCount( fontId, 3u, -1 );
+
+  DALI_TEST_EQUALS( AddGlyph( *glyphManager, fontId, 14u ).mAtlasId, slots[1].mAtlasId, TEST_LOCATION );
+  DALI_TEST_CHECK( !IsGlyphCached( *glyphManager, fontId, 4u ) );
+  DALI_TEST_EQUALS( AddGlyph( *glyphManager, fontId, 15u ).mAtlasId, slots[9].mAtlasId, TEST_LOCATION );
+  DALI_TEST_CHECK( !IsGlyphCached( *glyphManager, fontId, 10u ) );
+  DALI_TEST_CHECK( IsGlyphCached( *glyphManager, fontId, 3u ) );
+
+  DALI_TEST_EQUALS( glyphManager->GetMetrics().mEvictedGlyphCount, 7u, TEST_LOCATION );
+  DALI_TEST_EQUALS( glyphManager->GetMetrics().mReleasedAtlasCount, 1u, TEST_LOCATION );
+  DALI_TEST_EQUALS( glyphManager->GetMetrics().mUnreferencedGlyphCount, 1u, TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliTextAtlasRendererIncrementalUpdate(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline(" UtcDaliTextAtlasRendererIncrementalUpdate");
+
+  TextLabel label = TextLabel::New();
+  label.SetParentOrigin( ParentOrigin::TOP_LEFT );
+  label.SetAnchorPoint( AnchorPoint::TOP_LEFT );
+  label.SetSize( 400.f, 100.f );
+  label.SetProperty( TextLabel::Property::TEXT, "Hello" );
+  Stage::GetCurrent().Add( label );
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS( label.GetChildCount(), 1u, TEST_LOCATION );
+  Actor renderableActor = label.GetChildAt( 0u );
+  DALI_TEST_CHECK( renderableActor.GetChildCount() > 0u );
+  Actor meshActor = renderableActor.GetChildAt( 0u );
+  DALI_TEST_EQUALS( meshActor.GetRendererCount(), 1u, TEST_LOCATION );
+  Renderer renderer = meshActor.GetRendererAt( 0u );
+
+  AtlasGlyphManager glyphManager = AtlasGlyphManager::Get();
+  const unsigned int cacheHits = glyphManager.GetMetrics().mCacheHits;
+  const unsigned int cacheMisses = glyphManager.GetMetrics().mCacheMisses;
+
+  // Only the appended glyph is looked up, and the actors and renderers of the previous render are reused.
+  label.SetProperty( TextLabel::Property::TEXT, "Hello!" );
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS( glyphManager.GetMetrics().mCacheHits, cacheHits, TEST_LOCATION );
+  DALI_TEST_EQUALS( glyphManager.GetMetrics().mCacheMisses, cacheMisses + 1u, TEST_LOCATION );
+
+  DALI_TEST_EQUALS( label.GetChildCount(), 1u, TEST_LOCATION );
+  DALI_TEST_CHECK( label.GetChildAt( 0u ) == renderableActor );
+  DALI_TEST_CHECK( renderableActor.GetChildAt( 0u ) == meshActor );
+  DALI_TEST_CHECK( meshActor.GetRendererAt( 0u ) == renderer );
+
+  // Removing the last glyph looks up no glyph, and releases the one removed.
+  const unsigned int glyphCount = glyphManager.GetMetrics().mGlyphCount;
+  label.SetProperty( TextLabel::Property::TEXT, "Hello" );
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS( glyphManager.GetMetrics().mCacheHits, cacheHits, TEST_LOCATION );
+  DALI_TEST_EQUALS( glyphManager.GetMetrics().mCacheMisses, cacheMisses + 1u, TEST_LOCATION );
+  DALI_TEST_EQUALS( glyphManager.GetMetrics().mGlyphCount, glyphCount - 1u, TEST_LOCATION );
+  DALI_TEST_CHECK( label.GetChildAt( 0u ) == renderableActor );
+
+  END_TEST;
+}
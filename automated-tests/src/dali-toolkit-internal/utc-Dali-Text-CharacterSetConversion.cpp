@@ -100,6 +100,48 @@ bool Utf8ToUtf32Test( const Utf8ToUtf32Data& data )
   return true;
 }
 
+//////////////////////////////////////////////////////////
+
+struct Utf8ToUtf32InvalidData
+{
+  std::string   description;        ///< Description of the test.
+  std::string   text;               ///< input text.
+  unsigned int* utf32;              ///< The expected text (array of bytes with text encoded in utf32).
+  unsigned int  numberOfCharacters; ///< The expected number of characters.
+};
+
+bool Utf8ToUtf32InvalidTest( const Utf8ToUtf32InvalidData& data )
+{
+  const uint8_t* const utf8 = reinterpret_cast<const uint8_t* const>( data.text.c_str() );
+
+  if( GetNumberOfUtf8Characters( utf8, data.text.size() ) != data.numberOfCharacters )
+  {
+    tet_printf( "  %s : different number of utf8 characters : %d, expected : %d\n", data.description.c_str(), GetNumberOfUtf8Characters( utf8, data.text.size() ), data.numberOfCharacters );
+    return false;
+  }
+
+  Vector<uint32_t> utf32;
+  utf32.Resize( data.text.size() );
+
+  const uint32_t numberOfCharacters = Utf8ToUtf32( utf8, data.text.size(), utf32.Begin() );
+  if( numberOfCharacters != data.numberOfCharacters )
+  {
+    tet_printf( "  %s : different number of characters : %d, expected : %d\n", data.description.c_str(), numberOfCharacters, data.numberOfCharacters );
+    return false;
+  }
+
+  for( unsigned int index = 0u; index < numberOfCharacters; ++index )
+  {
+    if( data.utf32[index] != utf32[index] )
+    {
+      tet_printf( "  %s : different character at index : %d\n", data.description.c_str(), index );
+      return false;
+    }
+  }
+
+  return true;
+}
+
 } // namespace
 
 //////////////////////////////////////////////////////////
@@ -287,6 +329,8 @@ int UtcDaliTextCharacterSetConversionUtf8ToUtf32(void)
   unsigned int utf32_03[] = { 0x645, 0x631, 0x62D, 0x628, 0x627, 0x20, 0x628, 0x627, 0x644, 0x639, 0x627, 0x644, 0x645 }; // مرحبا بالعالم
   unsigned int utf32_04[] = { 0x939, 0x948, 0x932, 0x94B, 0x20, 0x935, 0x930, 0x94D, 0x932, 0x94D, 0x921 }; // हैलो वर्ल्ड
   unsigned int utf32_05[] = { 0x1F601, 0x20, 0x1F602, 0x20, 0x1F603, 0x20, 0x1F604 }; // Emojis
+  unsigned int utf32_06[] = { 0x48, 0x65, 0x6C, 0x6C, 0x6F, 0xA, 0x20, 0x57, 0x6F, 0x72, 0x6C, 0x64, 0xA, 0x20, 0x48, 0x65, 0x6C, 0x6C, 0x6F, 0x20, 0x57, 0x6F, 0x72, 0x6C, 0x64, 0xA }; // Blocks of ASCII characters with 'CR' and 'CR'+'LF'
+  unsigned int utf32_07[] = { 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x61, 0x62, 0x63, 0x64, 0x65, 0xA, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66 }; // 'CR'+'LF' across two blocks of ASCII characters
 
   const Utf8ToUtf32Data data[] =
   {
@@ -315,8 +359,18 @@ int UtcDaliTextCharacterSetConversionUtf8ToUtf32(void)
       "\xF0\x9F\x98\x81 \xF0\x9F\x98\x82 \xF0\x9F\x98\x83 \xF0\x9F\x98\x84",
       utf32_05,
     },
+    {
+      "Blocks of ASCII characters with 'CR' and 'CR'+'LF'",
+      "Hello\xd World\xd\xa Hello World\xd\xa",
+      utf32_06,
+    },
+    {
+      "'CR'+'LF' across two blocks of ASCII characters",
+      "0123456789abcde\xd\xa" "0123456789abcdef",
+      utf32_07,
+    },
   };
-  const unsigned int numberOfTests = 5u;
+  const unsigned int numberOfTests = 7u;
 
   for( unsigned int index = 0u; index < numberOfTests; ++index )
   {
@@ -381,3 +435,144 @@ int UtcDaliTextCharacterSetConversionUtf32ToUtf8(void)
   tet_result(TET_PASS);
   END_TEST;
 }
+
+int UtcDaliTextCharacterSetConversionUtf8ToUtf32Invalid(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline(" UtcDaliTextCharacterSetConversionUtf8ToUtf32Invalid");
+
+  unsigned int utf32_01[] = { 0x61, 0xFFFD, 0x62 }; // a, non valid lead byte, b
+  unsigned int utf32_02[] = { 0xFFFD, 0xFFFD, 0x20 }; // two non valid lead bytes
+  unsigned int utf32_03[] = { 0x61, 0x62, 0xFFFD }; // a, b, truncated 3 bytes sequence
+  unsigned int utf32_04[] = { 0xFFFD }; // truncated emoji
+  unsigned int utf32_05[] = { 0x48, 0x65, 0x6C, 0x6C, 0x6F, 0x20, 0x57, 0x6F, 0x72, 0x6C, 0x64, 0x20, 0x48, 0x65, 0x6C, 0x6C, 0x6F, 0x20, 0x57, 0x6F,
+                              0xFFFD,
+                              0x48, 0x65, 0x6C, 0x6C, 0x6F, 0x20, 0x57, 0x6F, 0x72, 0x6C, 0x64, 0x20, 0x48, 0x65, 0x6C, 0x6C, 0x6F, 0x20, 0x57, 0x6F,
+                              0xFFFD }; // Blocks of ASCII characters around a non valid lead byte, and a truncated sequence.
+  unsigned int utf32_06[] = { 0xFFFD, 0x41, 0x97 }; // 3 bytes lead byte followed by a non continuation byte
+  unsigned int utf32_07[] = { 0xFFFD, 0x9F, 0x20 }; // 4 bytes lead byte followed by a continuation byte and a non continuation byte
+  unsigned int utf32_08[] = { 0x645, 0x631, 0xFFFD, 0x41, 0x628, 0x627, 0x628, 0x627, 0x644, 0x639 }; // Non continuation byte in a block of 2 bytes sequences
+
+  const Utf8ToUtf32InvalidData data[] =
+  {
+    {
+      "Non valid lead byte",
+      "a\xF8" "b",
+      utf32_01,
+      3u
+    },
+    {
+      "Non valid lead bytes",
+      "\xFF\xFE ",
+      utf32_02,
+      3u
+    },
+    {
+      "Truncated sequence",
+      "ab\xE6\x97",
+      utf32_03,
+      3u
+    },
+    {
+      "Truncated emoji",
+      "\xF0\x9F\x98",
+      utf32_04,
+      1u
+    },
+    {
+      "Non valid lead byte between blocks of ASCII characters",
+      "Hello World Hello Wo\xFC" "Hello World Hello Wo\xF0\x9F",
+      utf32_05,
+      42u
+    },
+    {
+      "Non continuation byte",
+      "\xE6\x41\x97",
+      utf32_06,
+      3u
+    },
+    {
+      "Non continuation byte in an emoji",
+      "\xF0\x9F\x20",
+      utf32_07,
+      3u
+    },
+    {
+      "Non continuation byte in a block",
+      "\xD9\x85\xD8\xB1\xD8\x41\xD8\xA8\xD8\xA7\xD8\xA8\xD8\xA7\xD9\x84\xD8\xB9",
+      utf32_08,
+      10u
+    },
+  };
+  const unsigned int numberOfTests = 8u;
+
+  for( unsigned int index = 0u; index < numberOfTests; ++index )
+  {
+    if( !Utf8ToUtf32InvalidTest( data[index] ) )
+    {
+      tet_result(TET_FAIL);
+    }
+  }
+
+  tet_result(TET_PASS);
+  END_TEST;
+}
+
+int UtcDaliTextCharacterSetConversionUtf8ToUtf32Blocks(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline(" UtcDaliTextCharacterSetConversionUtf8ToUtf32Blocks");
+
+  unsigned int utf32_01[] = { 0x645, 0x631, 0x62D, 0x628, 0x627, 0x628, 0x627, 0x644, 0x639, 0x627, 0x644, 0x645 }; // مرحبابالعالم
+  unsigned int utf32_02[] = { 0x65E5, 0x672C, 0x8A9E, 0x306E, 0x30C6, 0x30AD, 0x30B9, 0x30C8, 0x3002, 0x4E2D }; // 日本語のテキスト。中
+  unsigned int utf32_03[] = { 0x1F601, 0x1F602, 0x1F603, 0x1F604, 0x1F605 }; // Emojis
+  unsigned int utf32_04[] = { 0x48, 0x65, 0x6C, 0x6C, 0x6F, 0x20, 0x57, 0x6F, 0x72, 0x6C, 0x64, 0x20, 0x48, 0x65, 0x6C, 0x6C,
+                              0x645, 0x631, 0x62D, 0x628, 0x627, 0x628, 0x627, 0x644,
+                              0x65E5, 0x672C, 0x8A9E, 0x306E,
+                              0x1F601, 0x1F602, 0x1F603, 0x1F604,
+                              0x6F }; // Blocks of characters with a different number of bytes
+
+  const Utf8ToUtf32InvalidData data[] =
+  {
+    {
+      "Block of 2 bytes sequences",
+      "\xD9\x85\xD8\xB1\xD8\xAD\xD8\xA8\xD8\xA7\xD8\xA8\xD8\xA7\xD9\x84\xD8\xB9\xD8\xA7\xD9\x84\xD9\x85",
+      utf32_01,
+      12u
+    },
+    {
+      "Blocks of 3 bytes sequences",
+      "\xE6\x97\xA5\xE6\x9C\xAC\xE8\xAA\x9E\xE3\x81\xAE\xE3\x83\x86\xE3\x82\xAD\xE3\x82\xB9\xE3\x83\x88\xE3\x80\x82\xE4\xB8\xAD",
+      utf32_02,
+      10u
+    },
+    {
+      "Block of 4 bytes sequences",
+      "\xF0\x9F\x98\x81\xF0\x9F\x98\x82\xF0\x9F\x98\x83\xF0\x9F\x98\x84\xF0\x9F\x98\x85",
+      utf32_03,
+      5u
+    },
+    {
+      "Blocks of characters with a different number of bytes",
+      "Hello World Hell"
+      "\xD9\x85\xD8\xB1\xD8\xAD\xD8\xA8\xD8\xA7\xD8\xA8\xD8\xA7\xD9\x84"
+      "\xE6\x97\xA5\xE6\x9C\xAC\xE8\xAA\x9E\xE3\x81\xAE"
+      "\xF0\x9F\x98\x81\xF0\x9F\x98\x82\xF0\x9F\x98\x83\xF0\x9F\x98\x84"
+      "o",
+      utf32_04,
+      33u
+    },
+  };
+  const unsigned int numberOfTests = 4u;
+
+  for( unsigned int index = 0u; index < numberOfTests; ++index )
+  {
+    if( !Utf8ToUtf32InvalidTest( data[index] ) )
+    {
+      tet_result(TET_FAIL);
+    }
+  }
+
+  tet_result(TET_PASS);
+  END_TEST;
+}
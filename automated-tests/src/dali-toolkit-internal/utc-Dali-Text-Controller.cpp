@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <iostream>
+
+#include <stdlib.h>
+#include <dali/devel-api/text-abstraction/font-client.h>
+#include <dali-toolkit/internal/text/text-control-interface.h>
+#include <dali-toolkit/internal/text/text-controller.h>
+#include <dali-toolkit/internal/text/text-controller-impl.h>
+#include <dali-toolkit-test-suite-utils.h>
+#include <dali-toolkit/dali-toolkit.h>
+
+
+using namespace Dali;
+using namespace Toolkit;
+using namespace Text;
+
+// Tests the following functions.
+//
+// float Controller::GetHeightForWidth( float width )
+//
+// bool HeightForWidthCache::Get( float width, float& height ) const
+//
+// void HeightForWidthCache::Set( float width, float height )
+
+//////////////////////////////////////////////////////////
+
+namespace
+{
+
+const char* const SHORT_TEXT = "Hello world demo.";
+const char* const LONG_TEXT = "Hello world demo. Hello world demo. Hello world demo. Hello world demo. Hello world demo.";
+
+/**
+ * A control which ignores the requests of the text controller.
+ */
+class ControlImpl : public ControlInterface
+{
+public:
+
+  ControlImpl()
+  {
+  }
+
+  virtual ~ControlImpl()
+  {
+  }
+
+  virtual void AddDecoration( Actor&, bool )
+  {
+  }
+
+  virtual void RequestTextRelayout()
+  {
+  }
+
+  virtual void TextChanged()
+  {
+  }
+
+  virtual void MaxLengthReached()
+  {
+  }
+};
+
+} // namespace
+
+//////////////////////////////////////////////////////////
+
+int UtcDaliTextControllerHeightForWidthCache(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline(" UtcDaliTextControllerHeightForWidthCache");
+
+  HeightForWidthCache cache;
+
+  float height = 0.f;
+  DALI_TEST_CHECK( !cache.Get( 100.f, height ) );
+
+  // The heights of four widths are kept.
+  cache.Set( 100.f, 40.f );
+  cache.Set( 200.f, 30.f );
+  cache.Set( 300.f, 20.f );
+  cache.Set( 400.f, 10.f );
+
+  DALI_TEST_CHECK( cache.Get( 100.f, height ) );
+  DALI_TEST_EQUALS( height, 40.f, TEST_LOCATION );
+  DALI_TEST_CHECK( cache.Get( 300.f, height ) );
+  DALI_TEST_EQUALS( height, 20.f, TEST_LOCATION );
+  DALI_TEST_CHECK( !cache.Get( 150.f, height ) );
+
+  // A fifth width replaces the first one stored.
+  cache.Set( 500.f, 5.f );
+  DALI_TEST_CHECK( 4u == cache.mHeightsForWidth.Count() );
+
+  DALI_TEST_CHECK( !cache.Get( 100.f, height ) );
+  DALI_TEST_CHECK( cache.Get( 200.f, height ) );
+  DALI_TEST_EQUALS( height, 30.f, TEST_LOCATION );
+  DALI_TEST_CHECK( cache.Get( 400.f, height ) );
+  DALI_TEST_EQUALS( height, 10.f, TEST_LOCATION );
+  DALI_TEST_CHECK( cache.Get( 500.f, height ) );
+  DALI_TEST_EQUALS( height, 5.f, TEST_LOCATION );
+
+  // Then the second one.
+  cache.Set( 600.f, 2.f );
+  DALI_TEST_CHECK( !cache.Get( 200.f, height ) );
+  DALI_TEST_CHECK( cache.Get( 300.f, height ) );
+  DALI_TEST_CHECK( cache.Get( 600.f, height ) );
+  DALI_TEST_EQUALS( height, 2.f, TEST_LOCATION );
+
+  // The text or the style changes.
+  cache.Clear();
+  DALI_TEST_CHECK( !cache.Get( 600.f, height ) );
+  DALI_TEST_CHECK( 0u == cache.mHeightsForWidth.Count() );
+
+  END_TEST;
+}
+
+int UtcDaliTextControllerGetHeightForWidth(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline(" UtcDaliTextControllerGetHeightForWidth");
+
+  TextAbstraction::FontClient fontClient = TextAbstraction::FontClient::Get();
+  fontClient.SetDpi( 96u, 96u );
+
+  ControlImpl controlImpl;
+  ControllerPtr controller = Controller::New( controlImpl );
+  controller->SetMultiLineEnabled( true );
+  controller->SetDefaultPointSize( 10.f );
+  controller->SetText( SHORT_TEXT );
+
+  // The text is laid-out for the first width.
+  const float narrowHeight = controller->GetHeightForWidth( 50.f );
+  DALI_TEST_CHECK( narrowHeight > 0.f );
+
+  // The next widths are either cached or calculated without modifying the laid-out text.
+  const float wideHeight = controller->GetHeightForWidth( 1000.f );
+  DALI_TEST_CHECK( wideHeight > 0.f );
+  DALI_TEST_CHECK( wideHeight < narrowHeight );
+
+  DALI_TEST_EQUALS( controller->GetHeightForWidth( 50.f ), narrowHeight, TEST_LOCATION );
+  DALI_TEST_EQUALS( controller->GetHeightForWidth( 1000.f ), wideHeight, TEST_LOCATION );
+
+  // Fill the cache, the first width is replaced but calculated again.
+  const float heights[] = { controller->GetHeightForWidth( 200.f ),
+                            controller->GetHeightForWidth( 300.f ),
+                            controller->GetHeightForWidth( 400.f ) };
+  DALI_TEST_CHECK( heights[0u] <= narrowHeight );
+  DALI_TEST_CHECK( heights[2u] >= wideHeight );
+  DALI_TEST_EQUALS( controller->GetHeightForWidth( 50.f ), narrowHeight, TEST_LOCATION );
+  DALI_TEST_EQUALS( controller->GetHeightForWidth( 300.f ), heights[1u], TEST_LOCATION );
+
+  // The heights calculated for the previous text are not valid.
+  controller->SetText( LONG_TEXT );
+  const float longTextHeight = controller->GetHeightForWidth( 50.f );
+  DALI_TEST_CHECK( longTextHeight > narrowHeight );
+
+  // Neither are the heights calculated for the previous font.
+  controller->SetDefaultPointSize( 20.f );
+  DALI_TEST_CHECK( controller->GetHeightForWidth( 50.f ) > longTextHeight );
+
+  END_TEST;
+}
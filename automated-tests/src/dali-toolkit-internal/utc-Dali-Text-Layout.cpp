@@ -16,6 +16,7 @@
  */
 
 #include <iostream>
+#include <limits>
 #include <stdlib.h>
 #include <unistd.h>
 
@@ -4978,3 +4979,170 @@ int UtcDaliTextAlign09(void)
   tet_result(TET_PASS);
   END_TEST;
 }
+
+int UtcDaliTextLayoutParagraphLayoutCache(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline(" UtcDaliTextLayoutParagraphLayoutCache");
+
+  // Layout the same text twice with the same width. The second layout copies the paragraphs from the cache.
+
+  TextAbstraction::FontClient fontClient = TextAbstraction::FontClient::Get();
+  fontClient.SetDpi( 96u, 96u );
+
+  char* pathNamePtr = get_current_dir_name();
+  const std::string pathName( pathNamePtr );
+  free( pathNamePtr );
+
+  fontClient.GetFontId( pathName + DEFAULT_FONT_DIR + "/tizen/TizenSansRegular.ttf" );
+
+  LogicalModelPtr logicalModel;
+  VisualModelPtr visualModel;
+  MetricsPtr metrics;
+  Size layoutSize;
+
+  Vector<FontDescriptionRun> fontDescriptionRuns;
+  LayoutOptions options;
+  options.reorder = false;
+  options.align = false;
+  CreateTextModel( "Hello world demo.\nHello world demo.\n\nHello world demo. Hello world demo.",
+                   Size( 100.f, 300.f ),
+                   fontDescriptionRuns,
+                   options,
+                   layoutSize,
+                   logicalModel,
+                   visualModel,
+                   metrics );
+
+  const Length totalNumberOfGlyphs = visualModel->mGlyphs.Count();
+
+  LayoutParameters layoutParameters( Size( 100.f, 300.f ),
+                                     logicalModel->mText.Begin(),
+                                     logicalModel->mLineBreakInfo.Begin(),
+                                     logicalModel->mWordBreakInfo.Begin(),
+                                     ( 0u != logicalModel->mCharacterDirections.Count() ) ? logicalModel->mCharacterDirections.Begin() : NULL,
+                                     visualModel->mGlyphs.Begin(),
+                                     visualModel->mGlyphsToCharacters.Begin(),
+                                     visualModel->mCharactersPerGlyph.Begin(),
+                                     visualModel->mCharactersToGlyph.Begin(),
+                                     visualModel->mGlyphsPerCharacter.Begin(),
+                                     totalNumberOfGlyphs );
+  layoutParameters.numberOfGlyphs = totalNumberOfGlyphs;
+  layoutParameters.estimatedNumberOfLines = logicalModel->mParagraphInfo.Count();
+
+  LayoutEngine engine;
+  engine.SetMetrics( metrics );
+  engine.SetLayout( LayoutEngine::MULTI_LINE_BOX );
+
+  Vector<Vector2> glyphPositions;
+  glyphPositions.Resize( totalNumberOfGlyphs );
+  Vector<LineRun> lines;
+  Size firstLayoutSize;
+  DALI_TEST_CHECK( engine.LayoutText( layoutParameters, glyphPositions, lines, firstLayoutSize ) );
+
+  // Only the height of the box changes.
+  layoutParameters.boundingBox.height = 200.f;
+
+  Vector<Vector2> cachedGlyphPositions;
+  cachedGlyphPositions.Resize( totalNumberOfGlyphs );
+  Vector<LineRun> cachedLines;
+  Size secondLayoutSize;
+  DALI_TEST_CHECK( engine.LayoutText( layoutParameters, cachedGlyphPositions, cachedLines, secondLayoutSize ) );
+
+  DALI_TEST_EQUALS( firstLayoutSize, secondLayoutSize, TEST_LOCATION );
+  DALI_TEST_EQUALS( lines.Count(), cachedLines.Count(), TEST_LOCATION );
+
+  for( unsigned int index = 0u; index < lines.Count(); ++index )
+  {
+    const LineRun& line = *( lines.Begin() + index );
+    const LineRun& cachedLine = *( cachedLines.Begin() + index );
+
+    DALI_TEST_EQUALS( line.glyphRun.glyphIndex, cachedLine.glyphRun.glyphIndex, TEST_LOCATION );
+    DALI_TEST_EQUALS( line.glyphRun.numberOfGlyphs, cachedLine.glyphRun.numberOfGlyphs, TEST_LOCATION );
+    DALI_TEST_EQUALS( line.characterRun.characterIndex, cachedLine.characterRun.characterIndex, TEST_LOCATION );
+    DALI_TEST_EQUALS( line.characterRun.numberOfCharacters, cachedLine.characterRun.numberOfCharacters, TEST_LOCATION );
+    DALI_TEST_EQUALS( line.width, cachedLine.width, TEST_LOCATION );
+    DALI_TEST_EQUALS( line.ascender, cachedLine.ascender, TEST_LOCATION );
+    DALI_TEST_EQUALS( line.descender, cachedLine.descender, TEST_LOCATION );
+  }
+
+  for( unsigned int index = 0u; index < totalNumberOfGlyphs; ++index )
+  {
+    DALI_TEST_EQUALS( *( glyphPositions.Begin() + index ), *( cachedGlyphPositions.Begin() + index ), TEST_LOCATION );
+  }
+
+  tet_result(TET_PASS);
+  END_TEST;
+}
+
+int UtcDaliTextLayoutCalculateLayoutSize(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline(" UtcDaliTextLayoutCalculateLayoutSize");
+
+  // The size calculated without setting the glyph positions must be the same than the size of the layout.
+
+  TextAbstraction::FontClient fontClient = TextAbstraction::FontClient::Get();
+  fontClient.SetDpi( 96u, 96u );
+
+  char* pathNamePtr = get_current_dir_name();
+  const std::string pathName( pathNamePtr );
+  free( pathNamePtr );
+
+  fontClient.GetFontId( pathName + DEFAULT_FONT_DIR + "/tizen/TizenSansRegular.ttf" );
+
+  LogicalModelPtr logicalModel;
+  VisualModelPtr visualModel;
+  MetricsPtr metrics;
+  Size layoutSize;
+
+  Vector<FontDescriptionRun> fontDescriptionRuns;
+  LayoutOptions options;
+  options.reorder = false;
+  options.align = false;
+  CreateTextModel( "Hello world demo.\nHello world demo.\n\nHello world demo. Hello world demo.\n",
+                   Size( 100.f, 300.f ),
+                   fontDescriptionRuns,
+                   options,
+                   layoutSize,
+                   logicalModel,
+                   visualModel,
+                   metrics );
+
+  const Length totalNumberOfGlyphs = visualModel->mGlyphs.Count();
+
+  LayoutParameters layoutParameters( Size( 100.f, std::numeric_limits<float>::max() ),
+                                     logicalModel->mText.Begin(),
+                                     logicalModel->mLineBreakInfo.Begin(),
+                                     logicalModel->mWordBreakInfo.Begin(),
+                                     ( 0u != logicalModel->mCharacterDirections.Count() ) ? logicalModel->mCharacterDirections.Begin() : NULL,
+                                     visualModel->mGlyphs.Begin(),
+                                     visualModel->mGlyphsToCharacters.Begin(),
+                                     visualModel->mCharactersPerGlyph.Begin(),
+                                     visualModel->mCharactersToGlyph.Begin(),
+                                     visualModel->mGlyphsPerCharacter.Begin(),
+                                     totalNumberOfGlyphs );
+  layoutParameters.numberOfGlyphs = totalNumberOfGlyphs;
+  layoutParameters.estimatedNumberOfLines = logicalModel->mParagraphInfo.Count();
+  layoutParameters.isLastNewParagraph = true;
+
+  LayoutEngine engine;
+  engine.SetMetrics( metrics );
+  engine.SetLayout( LayoutEngine::MULTI_LINE_BOX );
+
+  Vector<Vector2> glyphPositions;
+  glyphPositions.Resize( totalNumberOfGlyphs );
+  Vector<LineRun> lines;
+  Size textLayoutSize;
+  DALI_TEST_CHECK( engine.LayoutText( layoutParameters, glyphPositions, lines, textLayoutSize ) );
+
+  Size calculatedLayoutSize;
+  Length numberOfLines = 0u;
+  DALI_TEST_CHECK( engine.CalculateLayoutSize( layoutParameters, calculatedLayoutSize, numberOfLines ) );
+
+  DALI_TEST_EQUALS( textLayoutSize, calculatedLayoutSize, TEST_LOCATION );
+  DALI_TEST_EQUALS( lines.Count(), numberOfLines, TEST_LOCATION );
+
+  tet_result(TET_PASS);
+  END_TEST;
+}
@@ -0,0 +1,218 @@
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <iostream>
+
+#include <stdlib.h>
+#include <dali-toolkit/internal/text/character-set-conversion.h>
+#include <dali-toolkit/internal/text/markup-processor.h>
+#include <dali-toolkit-test-suite-utils.h>
+#include <dali-toolkit/dali-toolkit.h>
+
+
+using namespace Dali;
+using namespace Toolkit;
+using namespace Text;
+
+// Tests the following function.
+//
+// void ProcessMarkupString( const std::string& markupString, MarkupProcessData& markupProcessData );
+
+//////////////////////////////////////////////////////////
+
+namespace
+{
+
+struct ProcessMarkupStringData
+{
+  std::string   description;          ///< Description of the test.
+  std::string   markupString;         ///< The mark-up string.
+  std::string   text;                 ///< The expected plain text.
+  unsigned int  numberOfColorRuns;    ///< The expected number of color runs.
+  unsigned int  numberOfFontRuns;     ///< The expected number of font description runs.
+  unsigned int* fontRunsIndices;      ///< The expected character index and number of characters of each font description run.
+};
+
+bool ProcessMarkupStringTest( const ProcessMarkupStringData& data )
+{
+  Vector<ColorRun> colorRuns;
+  Vector<FontDescriptionRun> fontRuns;
+  Vector<Character> text;
+  MarkupProcessData markupProcessData( colorRuns, fontRuns, text );
+
+  ProcessMarkupString( data.markupString, markupProcessData );
+
+  // Convert the expected text to utf32.
+  Vector<Character> expectedText;
+  expectedText.Resize( data.text.size() );
+  const Length numberOfCharacters = Utf8ToUtf32( reinterpret_cast<const uint8_t* const>( data.text.c_str() ),
+                                                 data.text.size(),
+                                                 expectedText.Begin() );
+  expectedText.Resize( numberOfCharacters );
+
+  if( numberOfCharacters != text.Count() )
+  {
+    tet_printf( "  %s : different number of characters : %d, expected : %d\n", data.description.c_str(), static_cast<int>( text.Count() ), numberOfCharacters );
+    return false;
+  }
+
+  for( unsigned int index = 0u; index < numberOfCharacters; ++index )
+  {
+    if( expectedText[index] != text[index] )
+    {
+      tet_printf( "  %s : different character at index : %d\n", data.description.c_str(), index );
+      return false;
+    }
+  }
+
+  if( data.numberOfColorRuns != colorRuns.Count() )
+  {
+    tet_printf( "  %s : different number of color runs : %d, expected : %d\n", data.description.c_str(), static_cast<int>( colorRuns.Count() ), data.numberOfColorRuns );
+    return false;
+  }
+
+  if( data.numberOfFontRuns != fontRuns.Count() )
+  {
+    tet_printf( "  %s : different number of font runs : %d, expected : %d\n", data.description.c_str(), static_cast<int>( fontRuns.Count() ), data.numberOfFontRuns );
+    return false;
+  }
+
+  for( unsigned int index = 0u; index < data.numberOfFontRuns; ++index )
+  {
+    const FontDescriptionRun& fontRun = fontRuns[index];
+
+    if( ( data.fontRunsIndices[2u * index] != fontRun.characterRun.characterIndex ) ||
+        ( data.fontRunsIndices[2u * index + 1u] != fontRun.characterRun.numberOfCharacters ) )
+    {
+      tet_printf( "  %s : different font run : %d\n", data.description.c_str(), index );
+      return false;
+    }
+  }
+
+  return true;
+}
+
+} // namespace
+
+//////////////////////////////////////////////////////////
+
+int UtcDaliTextMarkupProcessString(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline(" UtcDaliTextMarkupProcessString");
+
+  unsigned int fontRuns01[] = { 6u, 5u };
+  unsigned int fontRuns02[] = { 3u, 5u };
+  unsigned int fontRuns04[] = { 2u, 1u };
+  unsigned int fontRuns05[] = { 0u, 9u, 1u, 2u };
+
+  const ProcessMarkupStringData data[] =
+  {
+    {
+      "Bold tag",
+      "Hello <b>world</b>",
+      "Hello world",
+      0u,
+      1u,
+      fontRuns01
+    },
+    {
+      "Color and italic tags with 'CR'+'LF'",
+      "<color value='red'>Hi</color>\xd\xa<i>there</i>",
+      "Hi\xathere",
+      1u,
+      1u,
+      fontRuns02
+    },
+    {
+      "Escaped characters",
+      "\\<b\\> \\a",
+      "<b> \\a",
+      0u,
+      0u,
+      NULL
+    },
+    {
+      "'CR' and 'LF' split by a tag",
+      "a\xd<b>\xa" "b</b>",
+      "a\xa" "b",
+      0u,
+      1u,
+      fontRuns04
+    },
+    {
+      "Nested tags and multi-byte characters",
+      "<i>\xe6\x97\xa5<b>\xe6\x9c\xac\xe8\xaa\x9e</b> \xF0\x9F\x98\x81 abc</i>",
+      "\xe6\x97\xa5\xe6\x9c\xac\xe8\xaa\x9e \xF0\x9F\x98\x81 abc",
+      0u,
+      2u,
+      fontRuns05
+    },
+  };
+  const unsigned int numberOfTests = 5u;
+
+  for( unsigned int index = 0u; index < numberOfTests; ++index )
+  {
+    if( !ProcessMarkupStringTest( data[index] ) )
+    {
+      tet_result(TET_FAIL);
+    }
+  }
+
+  tet_result(TET_PASS);
+  END_TEST;
+}
+
+int UtcDaliTextMarkupProcessLargeDocument(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline(" UtcDaliTextMarkupProcessLargeDocument");
+
+  // A paragraph with 90 characters, 2 color runs and 3 font description runs.
+  const std::string paragraph( "<b>Lorem ipsum</b> dolor sit amet, <color value='blue'>consectetur</color> adipiscing elit, "
+                               "<i>sed do <b>eiusmod</b> tempor</i> <color value='#F00'>incididunt</color>\n" );
+  const unsigned int numberOfParagraphs = 2000u;
+
+  std::string markupString;
+  markupString.reserve( numberOfParagraphs * paragraph.size() );
+  for( unsigned int index = 0u; index < numberOfParagraphs; ++index )
+  {
+    markupString.append( paragraph );
+  }
+
+  Vector<ColorRun> colorRuns;
+  Vector<FontDescriptionRun> fontRuns;
+  Vector<Character> text;
+  MarkupProcessData markupProcessData( colorRuns, fontRuns, text );
+
+  ProcessMarkupString( markupString, markupProcessData );
+
+  const Length numberOfCharacters = text.Count();
+  const Length numberOfColorRuns = colorRuns.Count();
+  const Length numberOfFontRuns = fontRuns.Count();
+  DALI_TEST_EQUALS( numberOfCharacters, 90u * numberOfParagraphs, TEST_LOCATION );
+  DALI_TEST_EQUALS( numberOfColorRuns, 2u * numberOfParagraphs, TEST_LOCATION );
+  DALI_TEST_EQUALS( numberOfFontRuns, 3u * numberOfParagraphs, TEST_LOCATION );
+
+  // The runs of the last paragraph.
+  const CharacterIndex lastParagraphIndex = 90u * ( numberOfParagraphs - 1u );
+  DALI_TEST_EQUALS( fontRuns[numberOfFontRuns - 3u].characterRun.characterIndex, lastParagraphIndex, TEST_LOCATION );
+  DALI_TEST_EQUALS( colorRuns[numberOfColorRuns - 1u].characterRun.characterIndex, lastParagraphIndex + 79u, TEST_LOCATION );
+
+  tet_result(TET_PASS);
+  END_TEST;
+}
@@ -24,6 +24,7 @@
 #include <dali-toolkit/internal/text/logical-model-impl.h>
 #include <dali-toolkit/internal/text/multi-language-helper-functions.h>
 #include <dali-toolkit/internal/text/multi-language-support.h>
+#include <dali-toolkit/internal/text/multi-language-support-impl.h>
 #include <dali-toolkit/internal/text/segmentation.h>
 #include <dali-toolkit/internal/text/text-run-container.h>
 #include <dali-toolkit-test-suite-utils.h>
@@ -49,6 +50,9 @@ using namespace Text;
 //
 // Constructor, destructor and MultilanguageSupport::Get()
 //
+// FontId FontFallbackCache::FindFont( FontId requestedFontId, Character character );
+// void FontFallbackCache::AddFont( FontId requestedFontId, Character character, FontId fontId );
+//
 // void MultilanguageSupport::SetScripts( const Vector<Character>& text,
 //                                        CharacterIndex startIndex,
 //                                        Length numberOfCharacters,
@@ -1705,3 +1709,38 @@ int UtcDaliTextMultiLanguageValidateFonts01(void)
   tet_result(TET_PASS);
   END_TEST;
 }
+
+int UtcDaliTextMultiLanguageFontFallbackCache(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline(" UtcDaliTextMultiLanguageFontFallbackCache");
+
+  Internal::FontFallbackCache cache;
+
+  // Nothing cached yet.
+  DALI_TEST_EQUALS( cache.FindFont( 1u, 0x1F601 ), 0u, TEST_LOCATION );
+  DALI_TEST_EQUALS( cache.mNumberOfHits, 0u, TEST_LOCATION );
+  DALI_TEST_EQUALS( cache.mNumberOfMisses, 1u, TEST_LOCATION );
+
+  cache.AddFont( 1u, 0x1F601, 2u );
+  cache.AddFont( 1u, 0x1F602, 2u );
+  cache.AddFont( 3u, 0x1F601, 4u );
+
+  DALI_TEST_EQUALS( cache.FindFont( 1u, 0x1F601 ), 2u, TEST_LOCATION );
+  DALI_TEST_EQUALS( cache.FindFont( 1u, 0x1F602 ), 2u, TEST_LOCATION );
+  DALI_TEST_EQUALS( cache.FindFont( 3u, 0x1F601 ), 4u, TEST_LOCATION );
+  DALI_TEST_EQUALS( cache.mNumberOfHits, 3u, TEST_LOCATION );
+
+  // A different character or requested font is not found.
+  DALI_TEST_EQUALS( cache.FindFont( 1u, 0x1F603 ), 0u, TEST_LOCATION );
+  DALI_TEST_EQUALS( cache.FindFont( 5u, 0x1F601 ), 0u, TEST_LOCATION );
+  DALI_TEST_EQUALS( cache.mNumberOfMisses, 3u, TEST_LOCATION );
+
+  // An item is replaced by the next one with the same hash.
+  cache.AddFont( 1u, 0x1F601 + 1024u, 6u );
+  DALI_TEST_EQUALS( cache.FindFont( 1u, 0x1F601 + 1024u ), 6u, TEST_LOCATION );
+  DALI_TEST_EQUALS( cache.FindFont( 1u, 0x1F601 ), 0u, TEST_LOCATION );
+
+  tet_result(TET_PASS);
+  END_TEST;
+}
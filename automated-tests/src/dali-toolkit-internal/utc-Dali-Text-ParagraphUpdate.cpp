@@ -0,0 +1,302 @@
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <iostream>
+
+#include <stdlib.h>
+#include <dali/devel-api/adaptor-framework/environment-variable.h>
+#include <dali-toolkit/internal/text/character-set-conversion.h>
+#include <dali-toolkit/internal/text/multi-language-support.h>
+#include <dali-toolkit/internal/text/paragraph-update.h>
+#include <dali-toolkit/internal/text/segmentation.h>
+#include <dali-toolkit-test-suite-utils.h>
+#include <toolkit-environment-variable.h>
+#include <dali-toolkit/dali-toolkit.h>
+
+
+using namespace Dali;
+using namespace Toolkit;
+using namespace Text;
+
+// Tests the following functions.
+//
+// ParagraphUpdateThreadPoolPtr ParagraphUpdateThreadPool::Get();
+//
+// bool ParagraphUpdateThreadPool::UpdateParagraphs( const Vector<Character>& text,
+//                                                   CharacterIndex startIndex,
+//                                                   Length numberOfCharacters,
+//                                                   bool setLineBreakInfo,
+//                                                   bool setWordBreakInfo,
+//                                                   bool setScripts,
+//                                                   Vector<LineBreakInfo>& lineBreakInfo,
+//                                                   Vector<WordBreakInfo>& wordBreakInfo,
+//                                                   Vector<ScriptRun>& scripts );
+
+//////////////////////////////////////////////////////////
+
+namespace
+{
+
+const Length MINIMUM_NUMBER_OF_INSERTED_CHARACTERS = 2u * 4096u; ///< Two groups of paragraphs with one worker thread.
+
+const char* const LATIN_PARAGRAPH = "Lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do eiusmod tempor.\n";
+const char* const ARABIC_PARAGRAPH = "مرحبا بالعالم، هذا نص عربي للتجربة مع بعض الكلمات الإضافية.\n";
+const char* const HEBREW_PARAGRAPH = "שלום עולם, זהו טקסט בעברית לבדיקה עם כמה מילים נוספות.\r\n";
+const char* const CJK_PARAGRAPH = "你好世界，这是一个用于测试的中文段落。Hello 世界。\n";
+
+/**
+ * Converts the UTF-8 text to UTF-32.
+ */
+void ToUtf32( const std::string& text, Vector<Character>& utf32 )
+{
+  utf32.Resize( text.size() );
+
+  const uint32_t numberOfCharacters = Utf8ToUtf32( reinterpret_cast<const uint8_t* const>( text.c_str() ),
+                                                   text.size(),
+                                                   &utf32[0u] );
+  utf32.Resize( numberOfCharacters );
+}
+
+/**
+ * Sets the break info and the scripts of the given characters in the event thread only, as the text controller does when the parallel update is disabled.
+ */
+void UpdateParagraphs( const Vector<Character>& text,
+                       CharacterIndex startIndex,
+                       Length numberOfCharacters,
+                       Vector<LineBreakInfo>& lineBreakInfo,
+                       Vector<WordBreakInfo>& wordBreakInfo,
+                       Vector<ScriptRun>& scripts )
+{
+  const Length totalNumberOfCharacters = text.Count();
+
+  lineBreakInfo.Resize( totalNumberOfCharacters, TextAbstraction::LINE_NO_BREAK );
+  SetLineBreakInfo( text,
+                    startIndex,
+                    numberOfCharacters,
+                    lineBreakInfo );
+
+  wordBreakInfo.Resize( totalNumberOfCharacters, TextAbstraction::WORD_NO_BREAK );
+  SetWordBreakInfo( text,
+                    startIndex,
+                    numberOfCharacters,
+                    wordBreakInfo );
+
+  MultilanguageSupport::Get().SetScripts( text,
+                                          startIndex,
+                                          numberOfCharacters,
+                                          scripts );
+}
+
+template< typename T >
+bool CompareBreakInfo( const char* const name, const Vector<T>& info, const Vector<T>& expectedInfo )
+{
+  if( info.Count() != expectedInfo.Count() )
+  {
+    tet_printf( "%s FAIL: different number of characters. %d, should be %d\n", name, info.Count(), expectedInfo.Count() );
+    return false;
+  }
+
+  for( unsigned int index = 0u; index < info.Count(); ++index )
+  {
+    if( info[index] != expectedInfo[index] )
+    {
+      tet_printf( "%s FAIL: different break info at character %d. %d, should be %d\n", name, index, static_cast<unsigned int>( info[index] ), static_cast<unsigned int>( expectedInfo[index] ) );
+      return false;
+    }
+  }
+
+  return true;
+}
+
+bool CompareScripts( const Vector<ScriptRun>& scripts, const Vector<ScriptRun>& expectedScripts )
+{
+  if( scripts.Count() != expectedScripts.Count() )
+  {
+    tet_printf( "ScriptsTest FAIL: different number of scripts. %d, should be %d\n", scripts.Count(), expectedScripts.Count() );
+    return false;
+  }
+
+  for( unsigned int index = 0u; index < scripts.Count(); ++index )
+  {
+    const ScriptRun& scriptRun1 = scripts[index];
+    const ScriptRun& scriptRun2 = expectedScripts[index];
+
+    if( scriptRun1.characterRun.characterIndex != scriptRun2.characterRun.characterIndex )
+    {
+      tet_printf( "ScriptsTest FAIL: different character index of the run %d. %d, should be %d\n", index, scriptRun1.characterRun.characterIndex, scriptRun2.characterRun.characterIndex );
+      return false;
+    }
+
+    if( scriptRun1.characterRun.numberOfCharacters != scriptRun2.characterRun.numberOfCharacters )
+    {
+      tet_printf( "ScriptsTest FAIL: different number of characters of the run %d. %d, should be %d\n", index, scriptRun1.characterRun.numberOfCharacters, scriptRun2.characterRun.numberOfCharacters );
+      return false;
+    }
+
+    if( scriptRun1.script != scriptRun2.script )
+    {
+      tet_printf( "ScriptsTest FAIL: different script of the run %d. %s, should be %s\n", index, TextAbstraction::ScriptName[scriptRun1.script], TextAbstraction::ScriptName[scriptRun2.script] );
+      return false;
+    }
+  }
+
+  return true;
+}
+
+/**
+ * Inserts paragraphs of different scripts between a Latin and an Arabic paragraph, and updates them
+ * with the thread pool and in the event thread only.
+ */
+bool InsertParagraphsTest( ParagraphUpdateThreadPool& threadPool, unsigned int numberOfInsertedParagraphs )
+{
+  const std::string textBefore = std::string( "The first paragraph is not updated.\n" ) + CJK_PARAGRAPH + LATIN_PARAGRAPH;
+  const std::string textAfter = std::string( ARABIC_PARAGRAPH ) + HEBREW_PARAGRAPH + "The last paragraph is not updated either.";
+
+  const char* const paragraphs[] = { LATIN_PARAGRAPH, ARABIC_PARAGRAPH, HEBREW_PARAGRAPH, CJK_PARAGRAPH };
+  const unsigned int numberOfParagraphs = sizeof( paragraphs ) / sizeof( paragraphs[0u] );
+  std::string insertedText;
+  for( unsigned int index = 0u; index < numberOfInsertedParagraphs; ++index )
+  {
+    insertedText += paragraphs[index % numberOfParagraphs];
+  }
+
+  Vector<Character> textBeforeUtf32;
+  Vector<Character> insertedTextUtf32;
+  Vector<Character> utf32;
+  ToUtf32( textBefore, textBeforeUtf32 );
+  ToUtf32( insertedText, insertedTextUtf32 );
+
+  // 1) Set the break info and the scripts of the text without the inserted paragraphs.
+  ToUtf32( textBefore + textAfter, utf32 );
+
+  Vector<LineBreakInfo> lineBreakInfo;
+  Vector<WordBreakInfo> wordBreakInfo;
+  Vector<ScriptRun> scripts;
+  UpdateParagraphs( utf32, 0u, utf32.Count(), lineBreakInfo, wordBreakInfo, scripts );
+
+  // 2) Insert the paragraphs.
+  const CharacterIndex startIndex = textBeforeUtf32.Count();
+  const Length numberOfCharacters = insertedTextUtf32.Count();
+  ToUtf32( textBefore + insertedText + textAfter, utf32 );
+
+  if( numberOfCharacters < MINIMUM_NUMBER_OF_INSERTED_CHARACTERS )
+  {
+    tet_printf( "InsertParagraphsTest FAIL: too few characters to update in parallel. %d\n", numberOfCharacters );
+    return false;
+  }
+
+  // 3) Update the inserted paragraphs in the event thread only.
+  Vector<LineBreakInfo> expectedLineBreakInfo = lineBreakInfo;
+  Vector<WordBreakInfo> expectedWordBreakInfo = wordBreakInfo;
+  Vector<ScriptRun> expectedScripts = scripts;
+  UpdateParagraphs( utf32, startIndex, numberOfCharacters, expectedLineBreakInfo, expectedWordBreakInfo, expectedScripts );
+
+  // 4) Update the inserted paragraphs with the thread pool.
+  if( !threadPool.UpdateParagraphs( utf32,
+                                    startIndex,
+                                    numberOfCharacters,
+                                    true,
+                                    true,
+                                    true,
+                                    lineBreakInfo,
+                                    wordBreakInfo,
+                                    scripts ) )
+  {
+    tet_printf( "InsertParagraphsTest FAIL: the paragraphs are not updated in parallel.\n" );
+    return false;
+  }
+
+  // 5) Compare the results, including the script runs after the inserted paragraphs.
+  return CompareBreakInfo( "LineBreakInfoTest", lineBreakInfo, expectedLineBreakInfo ) &&
+         CompareBreakInfo( "WordBreakInfoTest", wordBreakInfo, expectedWordBreakInfo ) &&
+         CompareScripts( scripts, expectedScripts );
+}
+
+} // namespace
+
+//////////////////////////////////////////////////////////
+
+int UtcDaliTextParagraphUpdateDisabled(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline(" UtcDaliTextParagraphUpdateDisabled");
+
+  // No pool unless DALI_TEXT_UPDATE_THREADS is set.
+  DALI_TEST_CHECK( !ParagraphUpdateThreadPool::Get() );
+
+  END_TEST;
+}
+
+int UtcDaliTextParagraphUpdateInParallel(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline(" UtcDaliTextParagraphUpdateInParallel");
+
+  // DALI_TEXT_UPDATE_THREADS is read with the first call.
+  EnvironmentVariable::SetTestingEnvironmentVariable( true );
+
+  ParagraphUpdateThreadPoolPtr threadPool = ParagraphUpdateThreadPool::Get();
+  DALI_TEST_CHECK( threadPool );
+  DALI_TEST_EQUALS( threadPool->GetNumberOfThreads(), 1u, TEST_LOCATION );
+
+  // The pool is shared.
+  DALI_TEST_CHECK( ParagraphUpdateThreadPool::Get() == threadPool );
+
+  // The same worker thread updates the paragraphs every time.
+  DALI_TEST_CHECK( InsertParagraphsTest( *threadPool, 200u ) );
+  DALI_TEST_CHECK( InsertParagraphsTest( *threadPool, 301u ) );
+
+  EnvironmentVariable::SetTestingEnvironmentVariable( false );
+
+  END_TEST;
+}
+
+int UtcDaliTextParagraphUpdateSmallText(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline(" UtcDaliTextParagraphUpdateSmallText");
+
+  EnvironmentVariable::SetTestingEnvironmentVariable( true );
+
+  ParagraphUpdateThreadPoolPtr threadPool = ParagraphUpdateThreadPool::Get();
+  DALI_TEST_CHECK( threadPool );
+
+  // A few paragraphs are not worth a thread.
+  Vector<Character> utf32;
+  ToUtf32( std::string( LATIN_PARAGRAPH ) + ARABIC_PARAGRAPH + HEBREW_PARAGRAPH + CJK_PARAGRAPH, utf32 );
+
+  Vector<LineBreakInfo> lineBreakInfo;
+  Vector<WordBreakInfo> wordBreakInfo;
+  Vector<ScriptRun> scripts;
+  DALI_TEST_CHECK( !threadPool->UpdateParagraphs( utf32, 0u, utf32.Count(), true, true, true, lineBreakInfo, wordBreakInfo, scripts ) );
+  DALI_TEST_CHECK( 0u == lineBreakInfo.Count() );
+  DALI_TEST_CHECK( 0u == scripts.Count() );
+
+  // Neither is a single large paragraph.
+  std::string text;
+  while( text.size() < 3u * 4096u )
+  {
+    text += "Lorem ipsum dolor sit amet. ";
+  }
+  ToUtf32( text, utf32 );
+  DALI_TEST_CHECK( !threadPool->UpdateParagraphs( utf32, 0u, utf32.Count(), true, true, true, lineBreakInfo, wordBreakInfo, scripts ) );
+  DALI_TEST_CHECK( 0u == lineBreakInfo.Count() );
+
+  EnvironmentVariable::SetTestingEnvironmentVariable( false );
+
+  END_TEST;
+}
@@ -18,6 +18,7 @@
 #include <iostream>
 #include <stdlib.h>
 
+#include <dali-toolkit/internal/text/shaped-run-cache.h>
 #include <dali-toolkit/internal/text/shaper.h>
 #include <dali-toolkit-test-suite-utils.h>
 #include <dali-toolkit/dali-toolkit.h>
@@ -532,3 +533,60 @@ int UtcDaliTextShape(void)
   tet_result(TET_PASS);
   END_TEST;
 }
+
+int UtcDaliTextShapedRunCache(void)
+{
+  tet_infoline(" UtcDaliTextShapedRunCache");
+
+  ToolkitTestApplication application;
+
+  ShapedRunCachePtr cache = ShapedRunCache::Get();
+  DALI_TEST_CHECK( cache );
+  cache->Clear();
+
+  const Character text[] = { 0x0048, 0x0065, 0x006c, 0x006c, 0x006f }; // Hello
+  const Length numberOfCharacters = 5u;
+
+  Vector<GlyphInfo> glyphs;
+  Vector<CharacterIndex> glyphToCharacterMap;
+  for( unsigned int index = 0u; index < numberOfCharacters; ++index )
+  {
+    GlyphInfo glyph;
+    glyph.fontId = 1u;
+    glyph.index = text[index];
+    glyphs.PushBack( glyph );
+    glyphToCharacterMap.PushBack( index );
+  }
+
+  const unsigned int hits = cache->GetNumberOfHits();
+  const unsigned int misses = cache->GetNumberOfMisses();
+
+  DALI_TEST_CHECK( NULL == cache->Find( text, numberOfCharacters, 1u, TextAbstraction::LATIN ) );
+
+  cache->Add( text, numberOfCharacters, 1u, TextAbstraction::LATIN, glyphs, glyphToCharacterMap );
+
+  const ShapedRun* run = cache->Find( text, numberOfCharacters, 1u, TextAbstraction::LATIN );
+  DALI_TEST_CHECK( NULL != run );
+  DALI_TEST_EQUALS( run->glyphs.Count(), numberOfCharacters, TEST_LOCATION );
+  DALI_TEST_EQUALS( run->glyphToCharacterMap.Count(), numberOfCharacters, TEST_LOCATION );
+  for( unsigned int index = 0u; index < numberOfCharacters; ++index )
+  {
+    DALI_TEST_EQUALS( run->glyphs[index].index, text[index], TEST_LOCATION );
+    DALI_TEST_EQUALS( run->glyphToCharacterMap[index], index, TEST_LOCATION );
+  }
+
+  // A different font, script or text is a different run.
+  DALI_TEST_CHECK( NULL == cache->Find( text, numberOfCharacters, 2u, TextAbstraction::LATIN ) );
+  DALI_TEST_CHECK( NULL == cache->Find( text, numberOfCharacters, 1u, TextAbstraction::ARABIC ) );
+  DALI_TEST_CHECK( NULL == cache->Find( text, numberOfCharacters - 1u, 1u, TextAbstraction::LATIN ) );
+
+  DALI_TEST_EQUALS( cache->GetNumberOfHits(), hits + 1u, TEST_LOCATION );
+  DALI_TEST_EQUALS( cache->GetNumberOfMisses(), misses + 4u, TEST_LOCATION );
+  DALI_TEST_CHECK( cache->GetHitRate() > 0.f );
+
+  cache->Clear();
+  DALI_TEST_CHECK( NULL == cache->Find( text, numberOfCharacters, 1u, TextAbstraction::LATIN ) );
+
+  tet_result(TET_PASS);
+  END_TEST;
+}
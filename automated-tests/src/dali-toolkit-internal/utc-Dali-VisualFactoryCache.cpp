@@ -0,0 +1,192 @@
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <iostream>
+#include <sstream>
+#include <string>
+
+#include <stdlib.h>
+#include <dali-toolkit/third-party/nanosvg/nanosvgrast.h>
+#include <dali-toolkit/internal/visuals/visual-factory-cache.h>
+#include <dali-toolkit/internal/visuals/svg/svg-rasterize-thread.h>
+#include <dali-toolkit-test-suite-utils.h>
+#include <dali-toolkit/dali-toolkit.h>
+
+
+using namespace Dali;
+using namespace Toolkit;
+
+// Tests the renderer cache and the svg document cache of the visual factory cache.
+
+//////////////////////////////////////////////////////////
+
+namespace
+{
+
+const char* TEST_IMAGE_FILE_NAME = "gallery_image_01.jpg";
+const char* TEST_SVG_FILE_NAME = TEST_RESOURCE_DIR "/svg1.svg";
+const char* TEST_INVALID_SVG_FILE_NAME = TEST_RESOURCE_DIR "/invalid.svg";
+const float TEST_DPI = 96.f;
+
+typedef Internal::VisualFactoryCache::RendererKey RendererKey;
+typedef Internal::VisualFactoryCache::RendererCacheStatistics RendererCacheStatistics;
+
+Renderer CreateRenderer()
+{
+  Geometry geometry = Geometry::New();
+  Shader shader = Shader::New( "vertexSrc", "fragmentSrc" );
+  return Renderer::New( geometry, shader );
+}
+
+} // namespace
+
+//////////////////////////////////////////////////////////
+
+int UtcDaliVisualFactoryCacheRendererKey(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline(" UtcDaliVisualFactoryCacheRendererKey");
+
+  const RendererKey key( TEST_IMAGE_FILE_NAME, ImageDimensions( 100, 200 ), FittingMode::SHRINK_TO_FIT, SamplingMode::BOX );
+  DALI_TEST_CHECK( key == RendererKey( TEST_IMAGE_FILE_NAME, ImageDimensions( 100, 200 ), FittingMode::SHRINK_TO_FIT, SamplingMode::BOX ) );
+  DALI_TEST_EQUALS( key.hash, RendererKey( TEST_IMAGE_FILE_NAME, ImageDimensions( 100, 200 ), FittingMode::SHRINK_TO_FIT, SamplingMode::BOX ).hash, TEST_LOCATION );
+
+  // Every load parameter is part of the key.
+  DALI_TEST_CHECK( !( key == RendererKey( "another_image.jpg", ImageDimensions( 100, 200 ), FittingMode::SHRINK_TO_FIT, SamplingMode::BOX ) ) );
+  DALI_TEST_CHECK( !( key == RendererKey( TEST_IMAGE_FILE_NAME, ImageDimensions( 200, 100 ), FittingMode::SHRINK_TO_FIT, SamplingMode::BOX ) ) );
+  DALI_TEST_CHECK( !( key == RendererKey( TEST_IMAGE_FILE_NAME, ImageDimensions( 100, 200 ), FittingMode::SCALE_TO_FILL, SamplingMode::BOX ) ) );
+  DALI_TEST_CHECK( !( key == RendererKey( TEST_IMAGE_FILE_NAME, ImageDimensions( 100, 200 ), FittingMode::SHRINK_TO_FIT, SamplingMode::NEAREST ) ) );
+
+  END_TEST;
+}
+
+int UtcDaliVisualFactoryCacheRendererStatistics(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline(" UtcDaliVisualFactoryCacheRendererStatistics");
+
+  IntrusivePtr< Internal::VisualFactoryCache > cache = new Internal::VisualFactoryCache();
+
+  const RendererKey key( TEST_IMAGE_FILE_NAME, ImageDimensions( 100, 200 ), FittingMode::DEFAULT, SamplingMode::DEFAULT );
+  DALI_TEST_CHECK( !cache->GetRenderer( key ) );
+
+  Renderer renderer = CreateRenderer();
+  cache->SaveRenderer( key, renderer );
+  DALI_TEST_CHECK( cache->GetRenderer( key ) == renderer );
+  DALI_TEST_CHECK( cache->GetRenderer( key ) == renderer );
+
+  // Another size is another renderer.
+  DALI_TEST_CHECK( !cache->GetRenderer( RendererKey( TEST_IMAGE_FILE_NAME, ImageDimensions( 50, 100 ), FittingMode::DEFAULT, SamplingMode::DEFAULT ) ) );
+
+  RendererCacheStatistics statistics = cache->GetRendererCacheStatistics();
+  DALI_TEST_EQUALS( statistics.hits, 2u, TEST_LOCATION );
+  DALI_TEST_EQUALS( statistics.misses, 2u, TEST_LOCATION );
+  DALI_TEST_EQUALS( statistics.numberOfEntries, 1u, TEST_LOCATION );
+
+  // The renderer in use is not cleaned.
+  DALI_TEST_CHECK( !cache->CleanRendererCache( key ) );
+
+  // The cache doesn't keep the renderer alive.
+  renderer.Reset();
+  DALI_TEST_CHECK( !cache->GetRenderer( key ) );
+  DALI_TEST_CHECK( cache->CleanRendererCache( key ) );
+
+  statistics = cache->GetRendererCacheStatistics();
+  DALI_TEST_EQUALS( statistics.misses, 3u, TEST_LOCATION );
+  DALI_TEST_EQUALS( statistics.numberOfEntries, 0u, TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliVisualFactoryCacheRendererSweep(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline(" UtcDaliVisualFactoryCacheRendererSweep");
+
+  IntrusivePtr< Internal::VisualFactoryCache > cache = new Internal::VisualFactoryCache();
+
+  Renderer keptRenderer = CreateRenderer();
+  const RendererKey keptKey( TEST_IMAGE_FILE_NAME, ImageDimensions(), FittingMode::DEFAULT, SamplingMode::DEFAULT );
+  cache->SaveRenderer( keptKey, keptRenderer );
+
+  // The renderers deleted without cleaning the cache leave dead entries.
+  const unsigned int numberOfRenderers = 200u;
+  for( unsigned int index = 0u; index < numberOfRenderers; ++index )
+  {
+    std::ostringstream url;
+    url << "image_" << index << ".png";
+
+    Renderer renderer = CreateRenderer();
+    cache->SaveRenderer( RendererKey( url.str(), ImageDimensions(), FittingMode::DEFAULT, SamplingMode::DEFAULT ), renderer );
+  }
+
+  // The dead entries are swept while the renderers are saved.
+  RendererCacheStatistics statistics = cache->GetRendererCacheStatistics();
+  DALI_TEST_CHECK( statistics.sweptEntries > 0u );
+  DALI_TEST_CHECK( statistics.numberOfEntries < numberOfRenderers );
+  DALI_TEST_EQUALS( statistics.sweptEntries + statistics.numberOfEntries, numberOfRenderers + 1u, TEST_LOCATION );
+
+  // The renderer in use is never swept.
+  DALI_TEST_CHECK( cache->GetRenderer( keptKey ) == keptRenderer );
+
+  END_TEST;
+}
+
+int UtcDaliVisualFactoryCacheSvgDocument(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline(" UtcDaliVisualFactoryCacheSvgDocument");
+
+  IntrusivePtr< Internal::VisualFactoryCache > cache = new Internal::VisualFactoryCache();
+  Internal::SvgDocumentCache& documentCache = cache->GetSvgDocumentCache();
+
+  // The visuals with the same url share one document.
+  Internal::SvgDocumentPtr document = documentCache.GetDocument( TEST_SVG_FILE_NAME, TEST_DPI );
+  DALI_TEST_CHECK( document );
+  DALI_TEST_CHECK( documentCache.GetDocument( TEST_SVG_FILE_NAME, TEST_DPI ) == document );
+  DALI_TEST_CHECK( documentCache.GetDocument( TEST_INVALID_SVG_FILE_NAME, TEST_DPI ) != document );
+
+  // The natural size is only known once a task has parsed the document.
+  DALI_TEST_CHECK( !document->HasNaturalSize() );
+  DALI_TEST_EQUALS( document->GetNaturalSize(), Vector2::ZERO, TEST_LOCATION );
+
+  NSVGrasterizer* rasterizer = nsvgCreateRasterizer();
+
+  // A task with a zero size only parses the document.
+  Internal::RasterizingTaskPtr parsingTask = new Internal::RasterizingTask( NULL, document, 0u, 0u, Internal::RasterizingTask::HIGH );
+  parsingTask->Rasterize( rasterizer, NULL );
+  DALI_TEST_CHECK( !parsingTask->GetPixelData() );
+
+  // TEST_SVG_FILE:
+  //  <svg width="100" height="100">
+  Vector2 naturalSize;
+  DALI_TEST_CHECK( parsingTask->GetNaturalSize( naturalSize ) );
+  DALI_TEST_EQUALS( naturalSize, Vector2( 100.f, 100.f ), Math::MACHINE_EPSILON_100, TEST_LOCATION );
+  DALI_TEST_CHECK( parsingTask->GetDocument() == document );
+
+  // A svg file which can't be parsed gives an empty result.
+  Internal::SvgDocumentPtr invalidDocument = documentCache.GetDocument( TEST_INVALID_SVG_FILE_NAME, TEST_DPI );
+  Internal::RasterizingTaskPtr invalidTask = new Internal::RasterizingTask( NULL, invalidDocument, 100u, 100u, Internal::RasterizingTask::NORMAL );
+  invalidTask->Rasterize( rasterizer, NULL );
+  DALI_TEST_CHECK( !invalidTask->GetPixelData() );
+  DALI_TEST_CHECK( invalidTask->GetNaturalSize( naturalSize ) );
+  DALI_TEST_EQUALS( naturalSize, Vector2::ZERO, TEST_LOCATION );
+
+  nsvgDeleteRasterizer( rasterizer );
+
+  END_TEST;
+}
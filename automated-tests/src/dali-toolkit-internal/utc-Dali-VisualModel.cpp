@@ -21,6 +21,7 @@
 
 #include <dali-toolkit-test-suite-utils.h>
 #include <dali-toolkit/dali-toolkit.h>
+#include <dali-toolkit/internal/text/text-view.h>
 #include <toolkit-text-model.h>
 
 
@@ -35,6 +36,13 @@ using namespace Text;
 //
 // void CreateGlyphsPerCharacterTable( CharacterIndex startIndex,
 //                                     Length numberOfCharacters )
+//
+// void SetRenderedArea( float top, float bottom )
+//
+// Length View::GetGlyphs( GlyphInfo* glyphs,
+//                         Vector2* glyphPositions,
+//                         GlyphIndex glyphIndex,
+//                         Length numberOfGlyphs ) const
 
 
 //////////////////////////////////////////////////////////
@@ -383,3 +391,130 @@ int UtcDaliSetCharacterToGlyph(void)
   tet_result(TET_PASS);
   END_TEST;
 }
+
+int UtcDaliSetRenderedArea(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline(" UtcDaliSetRenderedArea");
+
+  // Ten lines of ten glyphs. Each line is 20 pixels high.
+  VisualModelPtr visualModel = VisualModel::New();
+
+  for( unsigned int index = 0u; index < 10u; ++index )
+  {
+    LineRun line;
+    line.glyphRun.glyphIndex = 10u * index;
+    line.glyphRun.numberOfGlyphs = 10u;
+    line.characterRun.characterIndex = 10u * index;
+    line.characterRun.numberOfCharacters = 10u;
+    line.width = 100.f;
+    line.ascender = 15.f;
+    line.descender = -5.f;
+    line.extraLength = 0.f;
+    line.alignmentOffset = 0.f;
+    line.direction = false;
+    line.ellipsis = false;
+
+    visualModel->mLines.PushBack( line );
+  }
+
+  // The area intersects from the third to the fifth line.
+  visualModel->SetRenderedArea( 50.f, 90.f );
+  DALI_TEST_EQUALS( visualModel->mFirstRenderedGlyph, 20u, TEST_LOCATION );
+  DALI_TEST_EQUALS( visualModel->mNumberOfRenderedGlyphs, 30u, TEST_LOCATION );
+
+  DALI_TEST_CHECK( visualModel->IsAreaRendered( 55.f, 85.f ) );
+  DALI_TEST_CHECK( !visualModel->IsAreaRendered( 40.f, 80.f ) );
+
+  // The area starts exactly at the top of the second line.
+  visualModel->SetRenderedArea( 20.f, 40.f );
+  DALI_TEST_EQUALS( visualModel->mFirstRenderedGlyph, 10u, TEST_LOCATION );
+  DALI_TEST_EQUALS( visualModel->mNumberOfRenderedGlyphs, 10u, TEST_LOCATION );
+
+  // An area bigger than the text.
+  visualModel->SetRenderedArea( -100.f, 1000.f );
+  DALI_TEST_EQUALS( visualModel->mFirstRenderedGlyph, 0u, TEST_LOCATION );
+  DALI_TEST_EQUALS( visualModel->mNumberOfRenderedGlyphs, 100u, TEST_LOCATION );
+
+  // An area below the text.
+  visualModel->SetRenderedArea( 300.f, 400.f );
+  DALI_TEST_EQUALS( visualModel->mNumberOfRenderedGlyphs, 0u, TEST_LOCATION );
+
+  tet_result(TET_PASS);
+  END_TEST;
+}
+
+int UtcDaliViewGetRenderedGlyphs(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline(" UtcDaliViewGetRenderedGlyphs");
+
+  // Ten lines of ten glyphs. The lines have different heights and alignment offsets.
+  VisualModelPtr visualModel = VisualModel::New();
+  visualModel->mGlyphs.Resize( 100u );
+  visualModel->mGlyphPositions.Resize( 100u );
+
+  for( unsigned int index = 0u; index < 10u; ++index )
+  {
+    LineRun line;
+    line.glyphRun.glyphIndex = 10u * index;
+    line.glyphRun.numberOfGlyphs = 10u;
+    line.characterRun.characterIndex = 10u * index;
+    line.characterRun.numberOfCharacters = 10u;
+    line.width = 100.f;
+    line.ascender = 15.f + static_cast<float>( index );
+    line.descender = -5.f;
+    line.extraLength = 0.f;
+    line.alignmentOffset = static_cast<float>( index );
+    line.direction = false;
+    line.ellipsis = false;
+
+    visualModel->mLines.PushBack( line );
+
+    for( unsigned int glyphIndex = 0u; glyphIndex < 10u; ++glyphIndex )
+    {
+      visualModel->mGlyphPositions[10u * index + glyphIndex] = Vector2( 10.f * static_cast<float>( glyphIndex ), 0.f );
+    }
+  }
+
+  View view;
+  view.SetVisualModel( visualModel );
+
+  // The positions of the whole text.
+  GlyphInfo glyphs[100u];
+  Vector2 positions[100u];
+  DALI_TEST_EQUALS( view.GetGlyphs( glyphs, positions, 0u, 100u ), 100u, TEST_LOCATION );
+
+  // The offsets of the lines are not cached yet.
+  DALI_TEST_EQUALS( visualModel->GetLineOffset( 4u ), 86.f, TEST_LOCATION );
+
+  // Scroll the text. The area intersects the fifth and the sixth lines.
+  visualModel->mVirtualisedRenderingEnabled = true;
+  visualModel->SetRenderedArea( 90.f, 130.f );
+  DALI_TEST_EQUALS( visualModel->GetLineOffset( 4u ), 86.f, TEST_LOCATION );
+  DALI_TEST_EQUALS( visualModel->GetLineOffset( 5u ), 110.f, TEST_LOCATION );
+
+  GlyphIndex glyphIndex = 0u;
+  Length numberOfGlyphs = 0u;
+  view.GetRenderedGlyphRange( glyphIndex, numberOfGlyphs );
+  DALI_TEST_EQUALS( glyphIndex, 40u, TEST_LOCATION );
+  DALI_TEST_EQUALS( numberOfGlyphs, 20u, TEST_LOCATION );
+
+  // The glyphs of the range are at the same position than in the whole text.
+  GlyphInfo renderedGlyphs[20u];
+  Vector2 renderedPositions[20u];
+  DALI_TEST_EQUALS( view.GetGlyphs( renderedGlyphs, renderedPositions, glyphIndex, numberOfGlyphs ), 20u, TEST_LOCATION );
+
+  for( unsigned int index = 0u; index < numberOfGlyphs; ++index )
+  {
+    DALI_TEST_EQUALS( renderedPositions[index], positions[glyphIndex + index], TEST_LOCATION );
+  }
+
+  // The first glyph of each line is at the ascender of the line plus the height of the previous lines.
+  DALI_TEST_EQUALS( renderedPositions[0u], Vector2( 4.f, 86.f + 19.f ), TEST_LOCATION );
+  DALI_TEST_EQUALS( renderedPositions[10u], Vector2( 5.f, 110.f + 20.f ), TEST_LOCATION );
+  DALI_TEST_EQUALS( renderedPositions[19u], Vector2( 95.f, 110.f + 20.f ), TEST_LOCATION );
+
+  tet_result(TET_PASS);
+  END_TEST;
+}
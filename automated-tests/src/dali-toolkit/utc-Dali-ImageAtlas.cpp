@@ -321,3 +321,97 @@ int UtcDaliImageAtlasImageView(void)
 
   END_TEST;
 }
+
+int UtcDaliImageAtlasSharedLoadingThreads(void)
+{
+  ToolkitTestApplication application;
+  unsigned int size = 100;
+
+  // Both atlases load their images with the same thread pool.
+  ImageAtlas atlas1 = ImageAtlas::New( size, size );
+  ImageAtlas atlas2 = ImageAtlas::New( size, size );
+
+  EventThreadCallback* eventTrigger = EventThreadCallback::Get();
+  CallbackBase* callback = eventTrigger->GetCallback();
+
+  TraceCallStack& callStack = application.GetGlAbstraction().GetTextureTrace();
+  callStack.Reset();
+  callStack.Enable(true);
+
+  Vector4 textureRect1;
+  atlas1.Upload( textureRect1, gImage_34_RGBA, ImageDimensions(34, 34) );
+  Vector4 textureRect2;
+  atlas2.Upload( textureRect2, gImage_50_RGBA, ImageDimensions(50, 50) );
+
+  eventTrigger->WaitingForTrigger( 2 );// waiting until the images of both atlases are loaded
+
+  CallbackBase::Execute( *callback );
+
+  application.SendNotification();
+  application.Render(RENDER_FRAME_INTERVAL);
+
+  callStack.Enable(false);
+
+  TraceCallStack::NamedParams params1;
+  params1["width"] = "34";
+  params1["height"] = "34";
+  params1["xoffset"] = "0";
+  params1["yoffset"] = "0";
+
+  TraceCallStack::NamedParams params2;
+  params2["width"] = "50";
+  params2["height"] = "50";
+  params2["xoffset"] = "0";
+  params2["yoffset"] = "0";
+
+  DALI_TEST_EQUALS(  callStack.FindMethodAndParams("TexSubImage2D", params1 ), true, TEST_LOCATION );
+  DALI_TEST_EQUALS(  callStack.FindMethodAndParams("TexSubImage2D", params2 ), true, TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliImageAtlasRemoveCancelsLoading(void)
+{
+  ToolkitTestApplication application;
+  unsigned int size = 100;
+  ImageAtlas atlas = ImageAtlas::New( size, size );
+  Image image = atlas.GetAtlas();
+
+  TraceCallStack& callStack = application.GetGlAbstraction().GetTextureTrace();
+  callStack.Reset();
+  callStack.Enable(true);
+
+  // The first image is removed before it's uploaded, so its area is used by the second image.
+  Vector4 textureRect1;
+  atlas.Upload( textureRect1, gImage_34_RGBA, ImageDimensions(34, 34) );
+  atlas.Remove( textureRect1 );
+
+  Vector4 textureRect2;
+  atlas.Upload( textureRect2, gImage_50_RGBA, ImageDimensions(50, 50) );
+
+  // Deleting the atlas waits until its images are loaded and uploaded.
+  atlas.Reset();
+
+  application.SendNotification();
+  application.Render(RENDER_FRAME_INTERVAL);
+
+  callStack.Enable(false);
+
+  TraceCallStack::NamedParams params1;
+  params1["width"] = "34";
+  params1["height"] = "34";
+  params1["xoffset"] = "0";
+  params1["yoffset"] = "0";
+
+  TraceCallStack::NamedParams params2;
+  params2["width"] = "50";
+  params2["height"] = "50";
+  params2["xoffset"] = "0";
+  params2["yoffset"] = "0";
+
+  // The cancelled image doesn't overwrite the second one.
+  DALI_TEST_EQUALS(  callStack.FindMethodAndParams("TexSubImage2D", params1 ), false, TEST_LOCATION );
+  DALI_TEST_EQUALS(  callStack.FindMethodAndParams("TexSubImage2D", params2 ), true, TEST_LOCATION );
+
+  END_TEST;
+}
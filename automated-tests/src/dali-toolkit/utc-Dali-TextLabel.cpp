@@ -18,6 +18,7 @@
 #include <iostream>
 #include <stdlib.h>
 #include <dali-toolkit-test-suite-utils.h>
+#include "dali-toolkit-test-utils/toolkit-timer.h"
 #include <dali-toolkit/dali-toolkit.h>
 
 using namespace Dali;
@@ -61,6 +62,7 @@ const char* const PROPERTY_NAME_UNDERLINE = "underline";
 const char* const PROPERTY_NAME_SHADOW = "shadow";
 const char* const PROPERTY_NAME_EMBOSS = "emboss";
 const char* const PROPERTY_NAME_OUTLINE = "outline";
+const char* const PROPERTY_NAME_ASYNC_LAYOUT = "asyncLayout";
 
 const int DEFAULT_RENDERING_BACKEND = Dali::Toolkit::Text::DEFAULT_RENDERING_BACKEND;
 
@@ -171,6 +173,7 @@ int UtcDaliToolkitTextLabelGetPropertyP(void)
   DALI_TEST_CHECK( label.GetPropertyIndex( PROPERTY_NAME_SHADOW ) == TextLabel::Property::SHADOW );
   DALI_TEST_CHECK( label.GetPropertyIndex( PROPERTY_NAME_EMBOSS ) == TextLabel::Property::EMBOSS );
   DALI_TEST_CHECK( label.GetPropertyIndex( PROPERTY_NAME_OUTLINE ) == TextLabel::Property::OUTLINE );
+  DALI_TEST_CHECK( label.GetPropertyIndex( PROPERTY_NAME_ASYNC_LAYOUT ) == TextLabel::Property::ASYNC_LAYOUT );
 
   END_TEST;
 }
@@ -273,6 +276,11 @@ int UtcDaliToolkitTextLabelSetPropertyP(void)
   label.SetProperty( TextLabel::Property::OUTLINE, "Outline properties" );
   DALI_TEST_EQUALS( label.GetProperty<std::string>( TextLabel::Property::OUTLINE ), std::string("Outline properties"), TEST_LOCATION );
 
+  // Check the async layout property
+  DALI_TEST_CHECK( !label.GetProperty<bool>( TextLabel::Property::ASYNC_LAYOUT ) );
+  label.SetProperty( TextLabel::Property::ASYNC_LAYOUT, true );
+  DALI_TEST_CHECK( label.GetProperty<bool>( TextLabel::Property::ASYNC_LAYOUT ) );
+
   END_TEST;
 }
 
@@ -405,3 +413,71 @@ int UtcDaliToolkitTextlabelScrollingP(void)
 
   END_TEST;
 }
+
+int UtcDaliToolkitTextLabelAsyncLayoutP(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline(" UtcDaliToolkitTextLabelAsyncLayoutP");
+
+  const std::string text( "Some text laid-out in a later frame" );
+  const std::string otherText( "Some other text" );
+
+  TextLabel label = TextLabel::New();
+  DALI_TEST_CHECK( label );
+  TextLabel syncLabel = TextLabel::New( text );
+  DALI_TEST_CHECK( syncLabel );
+
+  // Avoid a crash when core load gl resources.
+  application.GetGlAbstraction().SetCheckFramebufferStatusResult( GL_FRAMEBUFFER_COMPLETE );
+
+  label.SetSize( 400.f, 100.f );
+  syncLabel.SetSize( 400.f, 100.f );
+  label.SetProperty( TextLabel::Property::ASYNC_LAYOUT, true );
+  label.SetProperty( TextLabel::Property::TEXT, text );
+  Stage::GetCurrent().Add( label );
+  Stage::GetCurrent().Add( syncLabel );
+
+  // The text of the async label is not laid-out in this frame, so it has no renderable actor yet.
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS( syncLabel.GetChildCount(), 1u, TEST_LOCATION );
+  DALI_TEST_EQUALS( label.GetChildCount(), 0u, TEST_LOCATION );
+
+  // Force the timer used by the layout queue to expire.
+  Dali::Timer timer = Timer::New( 0 );
+  timer.MockEmitSignal();
+
+  application.SendNotification();
+  application.Render();
+
+  // The renderable actor has the size of the laid-out text.
+  DALI_TEST_EQUALS( label.GetChildCount(), 1u, TEST_LOCATION );
+  const Vector3 textSize = syncLabel.GetChildAt( 0u ).GetTargetSize();
+  DALI_TEST_EQUALS( label.GetChildAt( 0u ).GetTargetSize(), textSize, TEST_LOCATION );
+  DALI_TEST_EQUALS( label.GetNaturalSize(), syncLabel.GetNaturalSize(), TEST_LOCATION );
+
+  syncLabel.SetProperty( TextLabel::Property::TEXT, otherText );
+  label.SetProperty( TextLabel::Property::TEXT, otherText );
+  application.SendNotification();
+  application.Render();
+
+  const Vector3 otherTextSize = syncLabel.GetChildAt( 0u ).GetTargetSize();
+  DALI_TEST_CHECK( otherTextSize != textSize );
+
+  // The new text is queued, the previous one is still rendered.
+  DALI_TEST_EQUALS( label.GetChildCount(), 1u, TEST_LOCATION );
+  DALI_TEST_EQUALS( label.GetChildAt( 0u ).GetTargetSize(), textSize, TEST_LOCATION );
+
+  // Disabling the async layout while the label is queued lays-out the text in the next relayout.
+  label.SetProperty( TextLabel::Property::ASYNC_LAYOUT, false );
+  DALI_TEST_CHECK( !label.GetProperty<bool>( TextLabel::Property::ASYNC_LAYOUT ) );
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS( label.GetChildCount(), 1u, TEST_LOCATION );
+  DALI_TEST_EQUALS( label.GetChildAt( 0u ).GetTargetSize(), otherTextSize, TEST_LOCATION );
+
+  END_TEST;
+}
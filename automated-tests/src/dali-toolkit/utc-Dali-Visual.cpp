@@ -17,6 +17,7 @@
 #include <iostream>
 #include <stdlib.h>
 #include <dali-toolkit-test-suite-utils.h>
+#include <toolkit-event-thread-callback.h>
 #include <dali/public-api/rendering/renderer.h>
 #include <dali/public-api/rendering/texture-set.h>
 #include <dali/public-api/rendering/shader.h>
@@ -181,6 +182,14 @@ int UtcDaliVisualSize(void)
   Visual::Base svgVisual = factory.CreateVisual( TEST_SVG_FILE_NAME, ImageDimensions() );
   svgVisual.SetSize( visualSize );
   DALI_TEST_EQUALS( svgVisual.GetSize(), visualSize, TEST_LOCATION );
+  svgVisual.GetNaturalSize(naturalSize);
+  // The svg document is parsed in the worker thread, the natural size is zero until then.
+  DALI_TEST_EQUALS( naturalSize, Vector2::ZERO, TEST_LOCATION );
+
+  EventThreadCallback* eventTrigger = EventThreadCallback::Get();
+  eventTrigger->WaitingForTrigger( 1 );// waiting until the svg document is parsed.
+  CallbackBase::Execute( *eventTrigger->GetCallback() );
+
   svgVisual.GetNaturalSize(naturalSize);
   // TEST_SVG_FILE:
   //  <svg width="100" height="100">
@@ -40,6 +40,21 @@ const char* TEST_MTL_FILE_NAME = TEST_RESOURCE_DIR "/ToyRobot-Metal.mtl";
 const char* TEST_SIMPLE_OBJ_FILE_NAME = TEST_RESOURCE_DIR "/Cube-Points-Only.obj";
 const char* TEST_SIMPLE_MTL_FILE_NAME = TEST_RESOURCE_DIR "/ToyRobot-Metal-Simple.mtl";
 
+struct NaturalSizeChangedCallback
+{
+  NaturalSizeChangedCallback( unsigned int& count )
+  : mCount( count )
+  {
+  }
+
+  void operator()( Visual::Base visual )
+  {
+    ++mCount;
+  }
+
+  unsigned int& mCount;
+};
+
 Integration::Bitmap* CreateBitmap( unsigned int imageWidth, unsigned int imageHeight, unsigned int initialColor, Pixel::Format pixelFormat )
 {
   Integration::Bitmap* bitmap = Integration::Bitmap::New( Integration::Bitmap::BITMAP_2D_PACKED_PIXELS, ResourcePolicy::OWNED_RETAIN );
@@ -643,6 +658,66 @@ int UtcDaliVisualFactoryGetImageVisual2(void)
   END_TEST;
 }
 
+int UtcDaliVisualFactoryGetImageVisualSharedRenderer(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline( "UtcDaliVisualFactoryGetImageVisualSharedRenderer: Share the renderer between image visuals with the same url and load parameters" );
+
+  VisualFactory factory = VisualFactory::Get();
+  DALI_TEST_CHECK( factory );
+
+  // Big desired sizes, so the atlasing is not applied.
+  Property::Map propertyMap;
+  propertyMap.Insert( Visual::Property::TYPE,  Visual::IMAGE );
+  propertyMap.Insert( ImageVisual::Property::URL,  TEST_IMAGE_FILE_NAME );
+  propertyMap.Insert( ImageVisual::Property::DESIRED_WIDTH,  600 );
+  propertyMap.Insert( ImageVisual::Property::DESIRED_HEIGHT,  600 );
+  Visual::Base visual1 = factory.CreateVisual( propertyMap );
+  Visual::Base visual2 = factory.CreateVisual( propertyMap );
+
+  propertyMap.Insert( ImageVisual::Property::DESIRED_WIDTH,  700 );
+  propertyMap.Insert( ImageVisual::Property::DESIRED_HEIGHT,  700 );
+  Visual::Base visual3 = factory.CreateVisual( propertyMap );
+
+  propertyMap.Insert( ImageVisual::Property::DESIRED_WIDTH,  600 );
+  propertyMap.Insert( ImageVisual::Property::DESIRED_HEIGHT,  600 );
+  propertyMap.Insert( ImageVisual::Property::FITTING_MODE,  FittingMode::SCALE_TO_FILL );
+  Visual::Base visual4 = factory.CreateVisual( propertyMap );
+
+  Actor actor1 = Actor::New();
+  Actor actor2 = Actor::New();
+  Actor actor3 = Actor::New();
+  Actor actor4 = Actor::New();
+  Stage::GetCurrent().Add( actor1 );
+  Stage::GetCurrent().Add( actor2 );
+  Stage::GetCurrent().Add( actor3 );
+  Stage::GetCurrent().Add( actor4 );
+  visual1.SetOnStage( actor1 );
+  visual2.SetOnStage( actor2 );
+  visual3.SetOnStage( actor3 );
+  visual4.SetOnStage( actor4 );
+
+  DALI_TEST_EQUALS( actor1.GetRendererCount(), 1u, TEST_LOCATION );
+  DALI_TEST_EQUALS( actor2.GetRendererCount(), 1u, TEST_LOCATION );
+  DALI_TEST_EQUALS( actor3.GetRendererCount(), 1u, TEST_LOCATION );
+  DALI_TEST_EQUALS( actor4.GetRendererCount(), 1u, TEST_LOCATION );
+
+  // The same url and load parameters share the renderer.
+  DALI_TEST_CHECK( actor1.GetRendererAt( 0u ) == actor2.GetRendererAt( 0u ) );
+
+  // The same url loaded with another size or fitting mode doesn't.
+  DALI_TEST_CHECK( actor1.GetRendererAt( 0u ) != actor3.GetRendererAt( 0u ) );
+  DALI_TEST_CHECK( actor1.GetRendererAt( 0u ) != actor4.GetRendererAt( 0u ) );
+
+  // The renderer is still shared after the other visual is put off stage and back.
+  visual1.SetOffStage( actor1 );
+  DALI_TEST_EQUALS( actor1.GetRendererCount(), 0u, TEST_LOCATION );
+  visual1.SetOnStage( actor1 );
+  DALI_TEST_CHECK( actor1.GetRendererAt( 0u ) == actor2.GetRendererAt( 0u ) );
+
+  END_TEST;
+}
+
 int UtcDaliVisualFactoryGetNPatchVisual1(void)
 {
   ToolkitTestApplication application;
@@ -937,7 +1012,7 @@ int UtcDaliVisualFactoryGetSvgVisual(void)
   EventThreadCallback* eventTrigger = EventThreadCallback::Get();
   CallbackBase* callback = eventTrigger->GetCallback();
 
-  eventTrigger->WaitingForTrigger( 1 );// waiting until the svg image is rasterized.
+  eventTrigger->WaitingForTrigger( 2 );// waiting until the svg document is parsed and the svg image is rasterized.
   CallbackBase::Execute( *callback );
 
   DALI_TEST_CHECK( actor.GetRendererCount() == 1u );
@@ -951,6 +1026,275 @@ int UtcDaliVisualFactoryGetSvgVisual(void)
   END_TEST;
 }
 
+int UtcDaliVisualFactoryGetSvgVisualShared(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline( "UtcDaliVisualFactoryGetSvgVisualShared: Request two svg visuals with the same svg url" );
+
+  VisualFactory factory = VisualFactory::Get();
+  Visual::Base visual1 = factory.CreateVisual( TEST_SVG_FILE_NAME, ImageDimensions() );
+  Visual::Base visual2 = factory.CreateVisual( TEST_SVG_FILE_NAME, ImageDimensions() );
+  DALI_TEST_CHECK( visual1 );
+  DALI_TEST_CHECK( visual2 );
+
+  // The document is parsed in the worker thread, the natural size is not known yet.
+  Vector2 naturalSize;
+  visual1.GetNaturalSize( naturalSize );
+  DALI_TEST_EQUALS( naturalSize, Vector2::ZERO, TEST_LOCATION );
+
+  EventThreadCallback* eventTrigger = EventThreadCallback::Get();
+  CallbackBase* callback = eventTrigger->GetCallback();
+
+  // Both visuals share one document, so a single parsing gives the natural size of both.
+  // TEST_SVG_FILE:
+  //  <svg width="100" height="100">
+  eventTrigger->WaitingForTrigger( 1 );// waiting until the svg document is parsed.
+  CallbackBase::Execute( *callback );
+
+  visual1.GetNaturalSize( naturalSize );
+  DALI_TEST_EQUALS( naturalSize, Vector2( 100.f, 100.f ), Math::MACHINE_EPSILON_100, TEST_LOCATION );
+  visual2.GetNaturalSize( naturalSize );
+  DALI_TEST_EQUALS( naturalSize, Vector2( 100.f, 100.f ), Math::MACHINE_EPSILON_100, TEST_LOCATION );
+
+  Actor actor1 = Actor::New();
+  actor1.SetSize( 200.f, 200.f );
+  Stage::GetCurrent().Add( actor1 );
+  visual1.SetSize( Vector2(200.f, 200.f) );
+  visual1.SetOnStage( actor1 );
+
+  Actor actor2 = Actor::New();
+  actor2.SetSize( 50.f, 50.f );
+  Stage::GetCurrent().Add( actor2 );
+  visual2.SetSize( Vector2(50.f, 50.f) );
+  visual2.SetOnStage( actor2 );
+
+  application.SendNotification();
+  application.Render();
+
+  eventTrigger->WaitingForTrigger( 3 );// waiting until both svg images are rasterized.
+  CallbackBase::Execute( *callback );
+
+  DALI_TEST_CHECK( actor1.GetRendererCount() == 1u );
+  DALI_TEST_CHECK( actor2.GetRendererCount() == 1u );
+
+  // Deleting one of the visuals keeps the document of the other one.
+  visual1.SetOffStage( actor1 );
+  visual1.Reset();
+  visual2.GetNaturalSize( naturalSize );
+  DALI_TEST_EQUALS( naturalSize, Vector2( 100.f, 100.f ), Math::MACHINE_EPSILON_100, TEST_LOCATION );
+
+  // A svg file which can't be parsed gives a zero natural size, and no image is applied.
+  Visual::Base visual3 = factory.CreateVisual( TEST_RESOURCE_DIR "/invalid.svg", ImageDimensions() );
+  DALI_TEST_CHECK( visual3 );
+
+  Actor actor3 = Actor::New();
+  actor3.SetSize( 200.f, 200.f );
+  Stage::GetCurrent().Add( actor3 );
+  visual3.SetSize( Vector2(200.f, 200.f) );
+  visual3.SetOnStage( actor3 );
+  DALI_TEST_CHECK( actor3.GetRendererCount() == 1u );
+  TextureSet textureSet = actor3.GetRendererAt( 0u ).GetTextures();
+
+  eventTrigger->WaitingForTrigger( 5 );// waiting until the svg document is parsed and rasterized.
+  CallbackBase::Execute( *callback );
+
+  visual3.GetNaturalSize( naturalSize );
+  DALI_TEST_EQUALS( naturalSize, Vector2::ZERO, TEST_LOCATION );
+  DALI_TEST_CHECK( actor3.GetRendererAt( 0u ).GetTextures() == textureSet );
+  DALI_TEST_CHECK( 0u == textureSet.GetTextureCount() );
+
+  visual2.SetOffStage( actor2 );
+  visual3.SetOffStage( actor3 );
+
+  END_TEST;
+}
+
+int UtcDaliVisualFactoryGetSvgVisualGrid(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline( "UtcDaliVisualFactoryGetSvgVisualGrid: Request a grid of svg visuals rasterized by the thread pool" );
+
+  const unsigned int numberOfVisuals = 16u;
+
+  VisualFactory factory = VisualFactory::Get();
+  std::vector<Visual::Base> visuals;
+  std::vector<Actor> actors;
+
+  for( unsigned int index = 0u; index < numberOfVisuals; ++index )
+  {
+    Visual::Base visual = factory.CreateVisual( TEST_SVG_FILE_NAME, ImageDimensions() );
+    DALI_TEST_CHECK( visual );
+
+    // Different sizes, so the rasterizations are not shared.
+    const float size = 64.f + static_cast<float>( index );
+    Actor actor = Actor::New();
+    actor.SetSize( size, size );
+    Stage::GetCurrent().Add( actor );
+    visual.SetSize( Vector2( size, size ) );
+    visual.SetOnStage( actor );
+
+    visuals.push_back( visual );
+    actors.push_back( actor );
+  }
+
+  application.SendNotification();
+  application.Render();
+
+  EventThreadCallback* eventTrigger = EventThreadCallback::Get();
+  CallbackBase* callback = eventTrigger->GetCallback();
+
+  eventTrigger->WaitingForTrigger( numberOfVisuals + 1u );// waiting until the shared svg document is parsed and all the svg images are rasterized.
+  CallbackBase::Execute( *callback );
+
+  for( unsigned int index = 0u; index < numberOfVisuals; ++index )
+  {
+    DALI_TEST_CHECK( actors[index].GetRendererCount() == 1u );
+  }
+
+  for( unsigned int index = 0u; index < numberOfVisuals; ++index )
+  {
+    visuals[index].SetOffStage( actors[index] );
+  }
+
+  END_TEST;
+}
+
+int UtcDaliVisualFactoryGetSvgVisualOffStage(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline( "UtcDaliVisualFactoryGetSvgVisualOffStage: Request a svg visual which goes off stage before it's rasterized" );
+
+  VisualFactory factory = VisualFactory::Get();
+  Visual::Base visual = factory.CreateVisual( TEST_SVG_FILE_NAME, ImageDimensions() );
+  DALI_TEST_CHECK( visual );
+
+  Actor actor = Actor::New();
+  actor.SetSize( 200.f, 200.f );
+  Stage::GetCurrent().Add( actor );
+  visual.SetSize( Vector2( 200.f, 200.f ) );
+  visual.SetOnStage( actor );
+  DALI_TEST_CHECK( actor.GetRendererCount() == 1u );
+
+  // The rasterization is cancelled, but the document is still parsed.
+  visual.SetOffStage( actor );
+  DALI_TEST_CHECK( actor.GetRendererCount() == 0u );
+
+  application.SendNotification();
+  application.Render();
+
+  EventThreadCallback* eventTrigger = EventThreadCallback::Get();
+  CallbackBase* callback = eventTrigger->GetCallback();
+
+  eventTrigger->WaitingForTrigger( 1 );// waiting until the svg document is parsed.
+  CallbackBase::Execute( *callback );
+
+  // Nothing is applied to the visual off stage.
+  DALI_TEST_CHECK( actor.GetRendererCount() == 0u );
+
+  Vector2 naturalSize;
+  visual.GetNaturalSize( naturalSize );
+  DALI_TEST_EQUALS( naturalSize, Vector2( 100.f, 100.f ), Math::MACHINE_EPSILON_100, TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliVisualFactoryGetSvgVisualNaturalSizeChanged(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline( "UtcDaliVisualFactoryGetSvgVisualNaturalSizeChanged: Request a svg visual and get notified when its natural size is known" );
+
+  VisualFactory factory = VisualFactory::Get();
+  Visual::Base visual = factory.CreateVisual( TEST_SVG_FILE_NAME, ImageDimensions() );
+  DALI_TEST_CHECK( visual );
+
+  unsigned int naturalSizeChangedCount = 0u;
+  visual.NaturalSizeChangedSignal().Connect( &application, NaturalSizeChangedCallback( naturalSizeChangedCount ) );
+
+  Actor actor = Actor::New();
+  actor.SetSize( 200.f, 200.f );
+  Stage::GetCurrent().Add( actor );
+  visual.SetSize( Vector2( 200.f, 200.f ) );
+  visual.SetOnStage( actor );
+
+  // The document is parsed in a worker thread.
+  DALI_TEST_EQUALS( naturalSizeChangedCount, 0u, TEST_LOCATION );
+
+  application.SendNotification();
+  application.Render();
+
+  EventThreadCallback* eventTrigger = EventThreadCallback::Get();
+  CallbackBase* callback = eventTrigger->GetCallback();
+
+  eventTrigger->WaitingForTrigger( 2 );// waiting until the svg document is parsed and the svg image is rasterized.
+  CallbackBase::Execute( *callback );
+
+  // The signal is emitted once, when the document is parsed.
+  DALI_TEST_EQUALS( naturalSizeChangedCount, 1u, TEST_LOCATION );
+  Vector2 naturalSize;
+  visual.GetNaturalSize( naturalSize );
+  DALI_TEST_EQUALS( naturalSize, Vector2( 100.f, 100.f ), Math::MACHINE_EPSILON_100, TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliVisualFactoryGetSvgVisualSharedRasterization(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline( "UtcDaliVisualFactoryGetSvgVisualSharedRasterization: Request svg visuals with the same url and size sharing one rasterization" );
+
+  VisualFactory factory = VisualFactory::Get();
+  Visual::Base visual1 = factory.CreateVisual( TEST_SVG_FILE_NAME, ImageDimensions() );
+  Visual::Base visual2 = factory.CreateVisual( TEST_SVG_FILE_NAME, ImageDimensions() );
+  DALI_TEST_CHECK( visual1 );
+  DALI_TEST_CHECK( visual2 );
+
+  Actor actor1 = Actor::New();
+  actor1.SetSize( 200.f, 200.f );
+  Stage::GetCurrent().Add( actor1 );
+  visual1.SetSize( Vector2( 200.f, 200.f ) );
+  visual1.SetOnStage( actor1 );
+
+  Actor actor2 = Actor::New();
+  actor2.SetSize( 200.f, 200.f );
+  Stage::GetCurrent().Add( actor2 );
+  visual2.SetSize( Vector2( 200.f, 200.f ) );
+  visual2.SetOnStage( actor2 );
+
+  application.SendNotification();
+  application.Render();
+
+  EventThreadCallback* eventTrigger = EventThreadCallback::Get();
+  CallbackBase* callback = eventTrigger->GetCallback();
+
+  eventTrigger->WaitingForTrigger( 2 );// waiting until the shared svg document is parsed and the only task is rasterized.
+  CallbackBase::Execute( *callback );
+
+  DALI_TEST_EQUALS( actor1.GetRendererCount(), 1u, TEST_LOCATION );
+  DALI_TEST_EQUALS( actor2.GetRendererCount(), 1u, TEST_LOCATION );
+
+  // Both visuals show the same texture.
+  TextureSet textureSet1 = actor1.GetRendererAt( 0u ).GetTextures();
+  TextureSet textureSet2 = actor2.GetRendererAt( 0u ).GetTextures();
+  DALI_TEST_CHECK( textureSet1 == textureSet2 );
+
+  // A visual put on stage later uses the cached image without a new rasterization.
+  Visual::Base visual3 = factory.CreateVisual( TEST_SVG_FILE_NAME, ImageDimensions() );
+  Actor actor3 = Actor::New();
+  actor3.SetSize( 200.f, 200.f );
+  Stage::GetCurrent().Add( actor3 );
+  visual3.SetSize( Vector2( 200.f, 200.f ) );
+  visual3.SetOnStage( actor3 );
+
+  DALI_TEST_EQUALS( actor3.GetRendererCount(), 1u, TEST_LOCATION );
+  DALI_TEST_CHECK( actor3.GetRendererAt( 0u ).GetTextures() == textureSet1 );
+
+  visual1.SetOffStage( actor1 );
+  visual2.SetOffStage( actor2 );
+  visual3.SetOffStage( actor3 );
+
+  END_TEST;
+}
+
 //Creates a mesh renderer from the given propertyMap and tries to load it on stage in the given application.
 //This is expected to succeed, which will then pass the test.
 void MeshVisualLoadsCorrectlyTest( Property::Map& propertyMap, ToolkitTestApplication& application )
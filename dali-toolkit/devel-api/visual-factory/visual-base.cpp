@@ -103,6 +103,11 @@ void Base::CreatePropertyMap( Property::Map& map ) const
   GetImplementation( *this ).CreatePropertyMap( map );
 }
 
+Base::NaturalSizeChangedSignalType& Base::NaturalSizeChangedSignal()
+{
+  return GetImplementation( *this ).NaturalSizeChangedSignal();
+}
+
 } // namespace Visual
 
 } // namespace Toolkit
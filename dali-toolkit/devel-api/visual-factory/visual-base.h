@@ -20,6 +20,7 @@
 // EXTERNAL INCLUDES
 #include <dali/public-api/object/base-handle.h>
 #include <dali/public-api/actors/actor.h>
+#include <dali/public-api/signals/dali-signal.h>
 
 namespace Dali
 {
@@ -48,6 +49,8 @@ class DALI_IMPORT_API Base : public BaseHandle
 {
 public:
 
+  typedef Signal< void ( Base ) > NaturalSizeChangedSignalType; ///< Natural size changed signal type
+
   /**
    * @brief Create an empty Visual Handle
    */
@@ -150,6 +153,21 @@ public:
    */
   void CreatePropertyMap( Dali::Property::Map& map ) const;
 
+public: // Signals
+
+  /**
+   * @brief This signal is emitted when the natural size of the visual changes after it has been created,
+   * i.e. when its resource is loaded asynchronously.
+   *
+   * The control showing the visual should relayout.
+   * A callback of the following type may be connected:
+   * @code
+   *   void YourCallbackName( Visual::Base visual );
+   * @endcode
+   * @return The signal to connect to.
+   */
+  NaturalSizeChangedSignalType& NaturalSizeChangedSignal();
+
 public: // Not intended for application developers
 
   explicit DALI_INTERNAL Base(Internal::Visual::Base *impl);
@@ -83,6 +83,7 @@ void ImageView::SetImage( Image image )
 
     Actor self( Self() );
     InitializeVisual( self, mVisual, image );
+    ConnectVisualSignals();
     mImageSize = image ? ImageDimensions( image.GetWidth(), image.GetHeight() ) : ImageDimensions( 0, 0 );
 
     RelayoutRequest();
@@ -97,6 +98,7 @@ void ImageView::SetImage( Property::Map map )
 
   Actor self( Self() );
   InitializeVisual( self, mVisual, mPropertyMap );
+  ConnectVisualSignals();
 
   Property::Value* widthValue = mPropertyMap.Find( "width" );
   if( widthValue )
@@ -139,6 +141,7 @@ void ImageView::SetImage( const std::string& url, ImageDimensions size )
 
     Actor self( Self() );
     InitializeVisual( self, mVisual, url, size );
+    ConnectVisualSignals();
 
     mVisual.SetSize( mSizeSet );
 
@@ -242,6 +245,23 @@ void ImageView::OnStageConnection( int depth )
   }
 }
 
+void ImageView::OnNaturalSizeChanged( Toolkit::Visual::Base visual )
+{
+  if( visual == mVisual )
+  {
+    RelayoutRequest();
+  }
+}
+
+void ImageView::ConnectVisualSignals()
+{
+  if( mVisual )
+  {
+    // A visual reused by InitializeVisual() is only connected once.
+    mVisual.NaturalSizeChangedSignal().Connect( this, &ImageView::OnNaturalSizeChanged );
+  }
+}
+
 void ImageView::OnStageDisconnection()
 {
   if( mVisual )
@@ -152,6 +152,20 @@ private: // From Control
    */
   virtual float GetWidthForHeight( float height );
 
+private:
+
+  /**
+   * @brief Requests a relayout as the natural size of the visual has changed, i.e. it's been loaded asynchronously.
+   *
+   * @param[in] visual The visual whose natural size has changed.
+   */
+  void OnNaturalSizeChanged( Toolkit::Visual::Base visual );
+
+  /**
+   * @brief Connects to the natural size changed signal of the current visual.
+   */
+  void ConnectVisualSignals();
+
 private:
   // Undefined
   ImageView( const ImageView& );
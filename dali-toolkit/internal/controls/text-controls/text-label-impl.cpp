@@ -106,6 +106,7 @@ DALI_PROPERTY_REGISTRATION( Toolkit, TextLabel, "underline",            STRING,
 DALI_PROPERTY_REGISTRATION( Toolkit, TextLabel, "shadow",               STRING,  SHADOW                 )
 DALI_PROPERTY_REGISTRATION( Toolkit, TextLabel, "emboss",               STRING,  EMBOSS                 )
 DALI_PROPERTY_REGISTRATION( Toolkit, TextLabel, "outline",              STRING,  OUTLINE                )
+DALI_PROPERTY_REGISTRATION( Toolkit, TextLabel, "asyncLayout",          BOOLEAN, ASYNC_LAYOUT           )
 
 DALI_TYPE_REGISTRATION_END()
 
@@ -425,6 +426,11 @@ void TextLabel::SetProperty( BaseObject* object, Property::Index index, const Pr
         }
         break;
       }
+      case Toolkit::TextLabel::Property::ASYNC_LAYOUT:
+      {
+        impl.SetAsyncLayoutEnabled( value.Get< bool >() );
+        break;
+      }
     }
   }
 }
@@ -634,6 +640,11 @@ Property::Value TextLabel::GetProperty( BaseObject* object, Property::Index inde
         GetOutlineProperties( impl.mController, value, Text::EffectStyle::DEFAULT );
         break;
       }
+      case Toolkit::TextLabel::Property::ASYNC_LAYOUT:
+      {
+        value = impl.mAsyncLayout;
+        break;
+      }
     }
   }
 
@@ -699,11 +710,22 @@ void TextLabel::OnStyleChange( Toolkit::StyleManager styleManager, StyleChange::
 
 Vector3 TextLabel::GetNaturalSize()
 {
+  if( IsAsyncLayoutPending() )
+  {
+    // Do not shape the text now. The size is negotiated again once the text is laid-out.
+    return mController->GetEstimatedNaturalSize();
+  }
+
   return mController->GetNaturalSize();
 }
 
 float TextLabel::GetHeightForWidth( float width )
 {
+  if( IsAsyncLayoutPending() )
+  {
+    return mController->GetEstimatedNaturalSize().height;
+  }
+
   return mController->GetHeightForWidth( width );
 }
 
@@ -711,6 +733,40 @@ void TextLabel::OnRelayout( const Vector2& size, RelayoutContainer& container )
 {
   DALI_LOG_INFO( gLogFilter, Debug::General, "TextLabel::OnRelayout\n" );
 
+  if( IsAsyncLayoutPending() )
+  {
+    // Shape and lay-out the text in a later frame.
+    mAsyncLayoutSize = size;
+
+    if( !mLayoutQueue )
+    {
+      mLayoutQueue = TextLabelLayoutQueue::Get();
+    }
+
+    if( mLayoutQueue )
+    {
+      mLayoutQueue->Add( *this );
+      return;
+    }
+  }
+
+  RelayoutText( size );
+}
+
+void TextLabel::ProcessAsyncLayout()
+{
+  DALI_LOG_INFO( gLogFilter, Debug::General, "TextLabel::ProcessAsyncLayout [%p]\n", this );
+
+  mLayoutQueue.Reset();
+
+  RelayoutText( mAsyncLayoutSize );
+
+  // The size was negotiated with an estimation of the natural size.
+  RelayoutRequest();
+}
+
+void TextLabel::RelayoutText( const Vector2& size )
+{
   const Text::Controller::UpdateTextType updateTextType = mController->Relayout( size );
 
   if( ( Text::Controller::NONE_UPDATED != ( Text::Controller::MODEL_UPDATED & updateTextType ) ) ||
@@ -729,6 +785,27 @@ void TextLabel::RequestTextRelayout()
   RelayoutRequest();
 }
 
+void TextLabel::SetAsyncLayoutEnabled( bool enabled )
+{
+  if( enabled != mAsyncLayout )
+  {
+    mAsyncLayout = enabled;
+
+    if( !mAsyncLayout && mLayoutQueue )
+    {
+      // Lay-out the text in the next relayout.
+      mLayoutQueue->Remove( *this );
+      mLayoutQueue.Reset();
+      RelayoutRequest();
+    }
+  }
+}
+
+bool TextLabel::IsAsyncLayoutPending() const
+{
+  return mAsyncLayout && mController->IsShapingRequired();
+}
+
 void TextLabel::RenderText()
 {
   DALI_LOG_INFO( gLogFilter, Debug::General, "TextLabel::RenderText IsAutoScrollEnabled[%s] [%p]\n", ( mController->IsAutoScrollEnabled())?"true":"false", this );
@@ -741,23 +818,28 @@ void TextLabel::RenderText()
     renderableActor = mRenderer->Render( mController->GetView(), DepthIndex::TEXT );
   }
 
-  if( renderableActor != mRenderableActor )
+  // The renderer may return the actor of the previous render with an updated text.
+  const bool actorChanged = ( renderableActor != mRenderableActor );
+  if( actorChanged )
   {
     UnparentAndReset( mRenderableActor );
 
     if( renderableActor )
     {
-      const Vector2& scrollOffset = mController->GetScrollPosition();
-      renderableActor.SetPosition( scrollOffset.x, scrollOffset.y );
-
       self.Add( renderableActor );
     }
     mRenderableActor = renderableActor;
+  }
 
-    if ( mController->IsAutoScrollEnabled() )
-    {
-      SetUpAutoScrolling();
-    }
+  if( mRenderableActor )
+  {
+    const Vector2& scrollOffset = mController->GetScrollPosition();
+    mRenderableActor.SetPosition( scrollOffset.x, scrollOffset.y );
+  }
+
+  if( ( actorChanged || mRenderableActor ) && mController->IsAutoScrollEnabled() )
+  {
+    SetUpAutoScrolling();
   }
 }
 
@@ -832,12 +914,17 @@ void TextLabel::ScrollingFinished()
 TextLabel::TextLabel()
 : Control( ControlBehaviour( REQUIRES_STYLE_CHANGE_SIGNALS ) ),
   mRenderingBackend( DEFAULT_RENDERING_BACKEND ),
-  mHasBeenStaged( false )
+  mHasBeenStaged( false ),
+  mAsyncLayout( false )
 {
 }
 
 TextLabel::~TextLabel()
 {
+  if( mLayoutQueue )
+  {
+    mLayoutQueue->Remove( *this );
+  }
 }
 
 } // namespace Internal
@@ -21,6 +21,7 @@
 // INTERNAL INCLUDES
 #include <dali-toolkit/public-api/controls/control-impl.h>
 #include <dali-toolkit/public-api/controls/text-controls/text-label.h>
+#include <dali-toolkit/internal/controls/text-controls/text-label-layout-queue.h>
 #include <dali-toolkit/internal/text/text-controller.h>
 #include <dali-toolkit/internal/text/text-scroller-interface.h>
 #include <dali-toolkit/internal/text/rendering/text-renderer.h>
@@ -67,6 +68,13 @@ public:
    */
   static Property::Value GetProperty( BaseObject* object, Property::Index index );
 
+  /**
+   * @brief Lays-out and renders the text deferred by the async layout.
+   *
+   * Called by the TextLabelLayoutQueue.
+   */
+  void ProcessAsyncLayout();
+
 private: // From Control
 
   /**
@@ -147,6 +155,27 @@ private:
   // Connection needed to re-render text, when a Text Label returns to the stage
   void OnStageConnect( Dali::Actor actor );
 
+  /**
+   * @brief Lays-out the text for the given size and renders it if it has changed.
+   *
+   * @param[in] size The size of the label.
+   */
+  void RelayoutText( const Vector2& size );
+
+  /**
+   * @brief Enables or disables the async layout.
+   *
+   * @param[in] enabled Whether the layout is deferred to later frames.
+   */
+  void SetAsyncLayoutEnabled( bool enabled );
+
+  /**
+   * @brief Whether the text layout is deferred to later frames.
+   *
+   * @return @e true if the async layout is enabled and the text needs to be shaped.
+   */
+  bool IsAsyncLayoutPending() const;
+
   /**
    * @brief Render view, create and attach actor(s) to this Text Label
    */
@@ -162,9 +191,12 @@ private: // Data
   Text::ControllerPtr mController;
   Text::RendererPtr mRenderer;
   Text::TextScrollerPtr mTextScroller;
+  TextLabelLayoutQueuePtr mLayoutQueue; ///< The queue of deferred layouts while this label is in it.
   Actor mRenderableActor;
+  Vector2 mAsyncLayoutSize; ///< The size of the label to use in the deferred layout.
   int mRenderingBackend;
   bool mHasBeenStaged:1;
+  bool mAsyncLayout:1; ///< Whether the text layout is deferred to later frames.
 };
 
 } // namespace Internal
@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali-toolkit/internal/controls/text-controls/text-label-layout-queue.h>
+
+// EXTERNAL INCLUDES
+#include <algorithm>
+#include <dali/devel-api/adaptor-framework/singleton-service.h>
+#include <dali/integration-api/debug.h>
+
+// INTERNAL INCLUDES
+#include <dali-toolkit/internal/controls/text-controls/text-label-impl.h>
+
+namespace Dali
+{
+
+namespace Toolkit
+{
+
+namespace Internal
+{
+
+namespace
+{
+
+#if defined ( DEBUG_ENABLED )
+  Debug::Filter* gLogFilter = Debug::Filter::New(Debug::NoLogging, true, "LOG_TEXT_CONTROLS");
+#endif
+
+const unsigned int FRAME_INTERVAL = 16u;        ///< The queue is processed once per frame (in milliseconds).
+const unsigned int MAX_LABELS_PER_FRAME = 8u;   ///< Maximum number of labels laid-out per frame.
+
+} // namespace
+
+TextLabelLayoutQueuePtr TextLabelLayoutQueue::Get()
+{
+  TextLabelLayoutQueuePtr queue;
+
+  Dali::SingletonService service( SingletonService::Get() );
+  if( service )
+  {
+    // Check whether the singleton is already created
+    Dali::BaseHandle handle = service.GetSingleton( typeid( TextLabelLayoutQueue ) );
+    if( handle )
+    {
+      queue = dynamic_cast<TextLabelLayoutQueue*>( handle.GetObjectPtr() );
+    }
+    else // create and register the object
+    {
+      queue = new TextLabelLayoutQueue();
+      service.Register( typeid( TextLabelLayoutQueue ), Dali::BaseHandle( queue.Get() ) );
+    }
+  }
+
+  return queue;
+}
+
+void TextLabelLayoutQueue::Add( TextLabel& label )
+{
+  if( mLabels.End() == std::find( mLabels.Begin(), mLabels.End(), &label ) )
+  {
+    mLabels.PushBack( &label );
+  }
+
+  if( !mTimer )
+  {
+    mTimer = Timer::New( FRAME_INTERVAL );
+    mTimer.TickSignal().Connect( this, &TextLabelLayoutQueue::OnTick );
+  }
+
+  if( !mTimer.IsRunning() )
+  {
+    mTimer.Start();
+  }
+}
+
+void TextLabelLayoutQueue::Remove( TextLabel& label )
+{
+  Vector<TextLabel*>::Iterator it = std::find( mLabels.Begin(), mLabels.End(), &label );
+  if( mLabels.End() != it )
+  {
+    mLabels.Erase( it );
+  }
+}
+
+TextLabelLayoutQueue::TextLabelLayoutQueue()
+: mLabels(),
+  mTimer()
+{
+}
+
+TextLabelLayoutQueue::~TextLabelLayoutQueue()
+{
+}
+
+bool TextLabelLayoutQueue::OnTick()
+{
+  // The labels may release the last reference to the queue.
+  TextLabelLayoutQueuePtr keepAlive( this );
+
+  DALI_LOG_INFO( gLogFilter, Debug::General, "TextLabelLayoutQueue::OnTick labels in the queue: %d\n", static_cast<unsigned int>( mLabels.Count() ) );
+
+  for( unsigned int count = 0u; ( count < MAX_LABELS_PER_FRAME ) && !mLabels.Empty(); ++count )
+  {
+    // Remove the label before it's laid-out as it may be queued again.
+    TextLabel* label = *mLabels.Begin();
+    mLabels.Erase( mLabels.Begin() );
+
+    label->ProcessAsyncLayout();
+  }
+
+  return !mLabels.Empty();
+}
+
+} // namespace Internal
+
+} // namespace Toolkit
+
+} // namespace Dali
@@ -0,0 +1,111 @@
+#ifndef __DALI_TOOLKIT_INTERNAL_TEXT_LABEL_LAYOUT_QUEUE_H__
+#define __DALI_TOOLKIT_INTERNAL_TEXT_LABEL_LAYOUT_QUEUE_H__
+
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <dali/public-api/adaptor-framework/timer.h>
+#include <dali/public-api/common/dali-vector.h>
+#include <dali/public-api/common/intrusive-ptr.h>
+#include <dali/public-api/object/base-object.h>
+#include <dali/public-api/signals/connection-tracker.h>
+
+namespace Dali
+{
+
+namespace Toolkit
+{
+
+namespace Internal
+{
+
+class TextLabel;
+class TextLabelLayoutQueue;
+typedef IntrusivePtr<TextLabelLayoutQueue> TextLabelLayoutQueuePtr;
+
+/**
+ * @brief Defers the layout of text labels with the async layout enabled.
+ *
+ * The labels are laid-out in the event thread in later frames, a few of them per frame,
+ * so many labels appearing at once don't block a single frame.
+ */
+class TextLabelLayoutQueue : public BaseObject, public ConnectionTracker
+{
+public:
+
+  /**
+   * @brief Retrieves the queue shared by all the text labels.
+   *
+   * @return A pointer to the queue. It may be NULL if the singleton service is not available.
+   */
+  static TextLabelLayoutQueuePtr Get();
+
+  /**
+   * @brief Adds a label to the end of the queue.
+   *
+   * @param[in] label The text label to lay-out.
+   */
+  void Add( TextLabel& label );
+
+  /**
+   * @brief Removes a label from the queue.
+   *
+   * @param[in] label The text label.
+   */
+  void Remove( TextLabel& label );
+
+private:
+
+  /**
+   * @brief Constructor.
+   */
+  TextLabelLayoutQueue();
+
+  /**
+   * @brief A reference counted object may only be deleted by calling Unreference().
+   */
+  virtual ~TextLabelLayoutQueue();
+
+  /**
+   * @brief Lays-out the labels at the front of the queue.
+   *
+   * @return @e true if there are labels left in the queue.
+   */
+  bool OnTick();
+
+private:
+
+  // Undefined
+  TextLabelLayoutQueue( const TextLabelLayoutQueue& queue );
+
+  // Undefined
+  TextLabelLayoutQueue& operator=( const TextLabelLayoutQueue& queue );
+
+private:
+
+  Vector<TextLabel*> mLabels; ///< The labels waiting to be laid-out.
+  Timer              mTimer;  ///< Ticks once per frame while there are labels in the queue.
+};
+
+} // namespace Internal
+
+} // namespace Toolkit
+
+} // namespace Dali
+
+#endif // __DALI_TOOLKIT_INTERNAL_TEXT_LABEL_LAYOUT_QUEUE_H__
@@ -21,7 +21,6 @@
 // EXTERNAL INCLUDES
 #include <string.h>
 #include <dali/public-api/signals/callback.h>
-#include <dali/public-api/images/resource-image.h>
 #include <dali/integration-api/debug.h>
 
 namespace Dali
@@ -35,13 +34,13 @@ namespace Internal
 
 ImageAtlas::ImageAtlas( SizeType width, SizeType height, Pixel::Format pixelFormat )
 : mPacker( width, height ),
-  mLoadQueue(),
-  mCompleteQueue( new EventThreadCallback( MakeCallback( this, &ImageAtlas::UploadToAtlas ) ) ),
-  mLoadingThread( mLoadQueue, mCompleteQueue ),
+  mThreadPool( ImageLoadThreadPool::Get() ),
+  mLoadingTasks(),
+  mDimensionsCache( ImageDimensionsCache::Get() ),
+  mUploadObserver( NULL ),
   mBrokenImageUrl(""),
   mBrokenImageSize(),
-  mPixelFormat( pixelFormat ),
-  mLoadingThreadStarted( false )
+  mPixelFormat( pixelFormat )
 {
   mAtlas = Atlas::New( width, height, pixelFormat );
   mWidth = static_cast<float>(width);
@@ -50,15 +49,13 @@ ImageAtlas::ImageAtlas( SizeType width, SizeType height, Pixel::Format pixelForm
 
 ImageAtlas::~ImageAtlas()
 {
-  if( mLoadingThreadStarted )
+  // The atlas can still be used as texture after ImageAtlas has been thrown away,
+  // so make sure all the images of this atlas are loaded and uploaded to atlas.
+  // The completed tasks of other atlases are uploaded as well.
+  while( !mLoadingTasks.Empty() )
   {
-    // add an empty task would stop the loading thread from contional wait.
-    mLoadQueue.AddTask( NULL );
-    // stop the loading thread
-    mLoadingThread.Join();
-    // The atlas can still be used as texture after ImageAtlas has been thrown away,
-    // so make sure all the loaded bitmap been uploaded to atlas
-    UploadToAtlas();
+    mThreadPool->WaitForCompletedTask();
+    mThreadPool->UploadCompletedTasks();
   }
 }
 
@@ -75,7 +72,7 @@ Image ImageAtlas::GetAtlas()
 
 void ImageAtlas::SetBrokenImage( const std::string& brokenImageUrl )
 {
-  mBrokenImageSize = ResourceImage::GetImageSize( brokenImageUrl );
+  mBrokenImageSize = mDimensionsCache->GetImageSize( brokenImageUrl );
   if(mBrokenImageSize.GetWidth() > 0 && mBrokenImageSize.GetHeight() > 0 ) // check the url is valid
   {
     mBrokenImageUrl = brokenImageUrl;
@@ -92,7 +89,7 @@ bool ImageAtlas::Upload( Vector4& textureRect,
   ImageDimensions zero;
   if( size == zero ) // image size not provided
   {
-    dimensions = ResourceImage::GetImageSize( url );
+    dimensions = mDimensionsCache->GetImageSize( url );
     if( dimensions == zero ) // Fail to read the image & broken image file exists
     {
       if( !mBrokenImageUrl.empty() )
@@ -116,21 +113,12 @@ bool ImageAtlas::Upload( Vector4& textureRect,
   unsigned int packPositionY = 0;
   if( mPacker.Pack( dimensions.GetWidth(), dimensions.GetHeight(), packPositionX, packPositionY ) )
   {
-    if( !mLoadingThreadStarted )
-    {
-      mLoadingThread.Start();
-      mLoadingThreadStarted = true;
-    }
-
     LoadingTask* newTask = new LoadingTask(BitmapLoader::New(url, size, fittingMode, SamplingMode::BOX_THEN_LINEAR, orientationCorrection ),
-                                           packPositionX, packPositionY, dimensions.GetWidth(), dimensions.GetHeight());
-    mLoadQueue.AddTask( newTask );
+                                           this, packPositionX, packPositionY, dimensions.GetWidth(), dimensions.GetHeight());
+    mLoadingTasks.PushBack( newTask );
+    mThreadPool->AddTask( newTask );
 
-    // apply the half pixel correction
-    textureRect.x = ( static_cast<float>( packPositionX ) +0.5f ) / mWidth; // left
-    textureRect.y = ( static_cast<float>( packPositionY ) +0.5f ) / mHeight; // right
-    textureRect.z = ( static_cast<float>( packPositionX + dimensions.GetX() )-0.5f ) / mWidth; // right
-    textureRect.w = ( static_cast<float>( packPositionY + dimensions.GetY() )-0.5f ) / mHeight;// bottom
+    CalculateTextureRect( packPositionX, packPositionY, dimensions.GetWidth(), dimensions.GetHeight(), textureRect );
 
     return true;
   }
@@ -146,11 +134,7 @@ bool ImageAtlas::Upload( Vector4& textureRect, PixelData pixelData )
   {
     mAtlas.Upload( pixelData, packPositionX, packPositionY );
 
-    // apply the half pixel correction
-    textureRect.x = ( static_cast<float>( packPositionX ) +0.5f ) / mWidth; // left
-    textureRect.y = ( static_cast<float>( packPositionY ) +0.5f ) / mHeight; // right
-    textureRect.z = ( static_cast<float>( packPositionX + pixelData.GetWidth() )-0.5f ) / mWidth; // right
-    textureRect.w = ( static_cast<float>( packPositionY + pixelData.GetHeight() )-0.5f ) / mHeight;// bottom
+    CalculateTextureRect( packPositionX, packPositionY, pixelData.GetWidth(), pixelData.GetHeight(), textureRect );
 
     return true;
   }
@@ -160,41 +144,82 @@ bool ImageAtlas::Upload( Vector4& textureRect, PixelData pixelData )
 
 void ImageAtlas::Remove( const Vector4& textureRect )
 {
-  mPacker.DeleteBlock( static_cast<SizeType>(textureRect.x*mWidth),
-                       static_cast<SizeType>(textureRect.y*mHeight),
+  const SizeType packPositionX = static_cast<SizeType>(textureRect.x*mWidth);
+  const SizeType packPositionY = static_cast<SizeType>(textureRect.y*mHeight);
+
+  // Cancel the loading task if the image hasn't been uploaded yet, so it doesn't overwrite the next image packed in the same area.
+  for( Vector< LoadingTask* >::Iterator it = mLoadingTasks.Begin(), endIt = mLoadingTasks.End(); it != endIt; ++it )
+  {
+    if( (*it)->packRect.x == packPositionX && (*it)->packRect.y == packPositionY )
+    {
+      mThreadPool->CancelTask( *it );
+      mLoadingTasks.Erase( it );
+      break;
+    }
+  }
+
+  mPacker.DeleteBlock( packPositionX,
+                       packPositionY,
                        static_cast<SizeType>((textureRect.z-textureRect.x)*mWidth+1.f),
                        static_cast<SizeType>((textureRect.w-textureRect.y)*mHeight+1.f) );
 }
 
-void ImageAtlas::UploadToAtlas()
+void ImageAtlas::UploadToAtlas( const LoadingTask& task )
 {
-  while( LoadingTask* next = mCompleteQueue.NextTask() )
+  for( Vector< LoadingTask* >::Iterator it = mLoadingTasks.Begin(), endIt = mLoadingTasks.End(); it != endIt; ++it )
   {
-    if( ! next->loader.IsLoaded() )
+    if( *it == &task )
     {
-      if(!mBrokenImageUrl.empty()) // replace with the broken image
-      {
-        UploadBrokenImage( next->packRect );
-      }
-
-      DALI_LOG_ERROR( "Failed to load the image: %s\n", (next->loader.GetUrl()).c_str());
+      mLoadingTasks.Erase( it );
+      break;
     }
-    else
+  }
+
+  BitmapLoader loader = task.loader;
+  if( ! loader.IsLoaded() )
+  {
+    if(!mBrokenImageUrl.empty()) // replace with the broken image
     {
-      if( next->loader.GetPixelData().GetWidth() < next->packRect.width || next->loader.GetPixelData().GetHeight() < next->packRect.height  )
-      {
-        DALI_LOG_ERROR( "Can not upscale the image from actual loaded size [ %d, %d ] to specified size [ %d, %d ]\n",
-                        next->loader.GetPixelData().GetWidth(),
-                        next->loader.GetPixelData().GetHeight(),
-                        next->packRect.width,
-                        next->packRect.height );
-      }
+      UploadBrokenImage( task.packRect );
+    }
 
-      mAtlas.Upload( next->loader.GetPixelData(), next->packRect.x, next->packRect.y );
+    DALI_LOG_ERROR( "Failed to load the image: %s\n", (loader.GetUrl()).c_str());
+  }
+  else
+  {
+    if( loader.GetPixelData().GetWidth() < task.packRect.width || loader.GetPixelData().GetHeight() < task.packRect.height  )
+    {
+      DALI_LOG_ERROR( "Can not upscale the image from actual loaded size [ %d, %d ] to specified size [ %d, %d ]\n",
+                      loader.GetPixelData().GetWidth(),
+                      loader.GetPixelData().GetHeight(),
+                      task.packRect.width,
+                      task.packRect.height );
     }
 
-    delete next;
+    mAtlas.Upload( loader.GetPixelData(), task.packRect.x, task.packRect.y );
   }
+
+  if( mUploadObserver )
+  {
+    Vector4 textureRect;
+    CalculateTextureRect( task.packRect.x, task.packRect.y, task.packRect.width, task.packRect.height, textureRect );
+    mUploadObserver->UploadCompleted( *this, textureRect );
+  }
+}
+
+void ImageAtlas::SetUploadObserver( UploadObserver* observer )
+{
+  mUploadObserver = observer;
+}
+
+float ImageAtlas::GetOccupancy() const
+{
+  return 1.f - static_cast<float>( mPacker.GetAvailableArea() ) / ( mWidth * mHeight );
+}
+
+bool ImageAtlas::IsLoading() const
+{
+  return !mLoadingTasks.Empty();
 }
 
 void ImageAtlas::UploadBrokenImage( const Rect<SizeType>& area )
@@ -234,6 +259,15 @@ void ImageAtlas::UploadBrokenImage( const Rect<SizeType>& area )
   mAtlas.Upload( loader.GetPixelData(), packX, packY );
 }
 
+void ImageAtlas::CalculateTextureRect( SizeType packPositionX, SizeType packPositionY, SizeType width, SizeType height, Vector4& textureRect ) const
+{
+  // apply the half pixel correction
+  textureRect.x = ( static_cast<float>( packPositionX ) +0.5f ) / mWidth; // left
+  textureRect.y = ( static_cast<float>( packPositionY ) +0.5f ) / mHeight; // top
+  textureRect.z = ( static_cast<float>( packPositionX + width )-0.5f ) / mWidth; // right
+  textureRect.w = ( static_cast<float>( packPositionY + height )-0.5f ) / mHeight;// bottom
+}
+
 } // namespace Internal
 
 } // namespace Toolkit
@@ -25,6 +25,7 @@
 // INTERNAL INCLUDES
 #include <dali-toolkit/devel-api/image-atlas/image-atlas.h>
 #include <dali-toolkit/internal/image-atlas/atlas-packer.h>
+#include <dali-toolkit/internal/image-atlas/image-dimensions-cache.h>
 #include <dali-toolkit/internal/image-atlas/image-load-thread.h>
 
 namespace Dali
@@ -43,6 +44,29 @@ public:
 
   typedef Toolkit::ImageAtlas::SizeType SizeType;
 
+  /**
+   * The interface notified when the images loaded from url are uploaded to the atlas.
+   */
+  class UploadObserver
+  {
+  public:
+
+    /**
+     * Called in the main thread once the image loaded from url is uploaded, or replaced with the broken image.
+     *
+     * @param[in] atlas The atlas the image is uploaded to.
+     * @param[in] textureRect The texture area of the image, as returned by Upload().
+     */
+    virtual void UploadCompleted( ImageAtlas& atlas, const Vector4& textureRect ) = 0;
+
+  protected:
+
+    /**
+     * Virtual destructor.
+     */
+    virtual ~UploadObserver() {}
+  };
+
   /**
    * Constructor
    * @param [in] width          The atlas width in pixels.
@@ -82,9 +106,35 @@ public:
 
   /**
    * @copydoc Toolkit::ImageAtlas::Remove
+   *
+   * If the image is still being loaded, its loading task is cancelled.
    */
   void Remove( const Vector4& textureRect );
 
+  /**
+   * Upload the bitmap to atlas when the image is loaded in the worker thread. Called by the thread pool in the main thread.
+   *
+   * @param[in] task The loading task with the bitmap loaded.
+   */
+  void UploadToAtlas( const LoadingTask& task );
+
+  /**
+   * Set the observer notified when the images loaded from url are uploaded.
+   *
+   * @param[in] observer The observer, or NULL to stop notifying. It's not owned by the atlas.
+   */
+  void SetUploadObserver( UploadObserver* observer );
+
+  /**
+   * Retrieve the ratio of the atlas area packed with images, from 0 for an empty atlas to 1 for a full one.
+   */
+  float GetOccupancy() const;
+
+  /**
+   * Query whether some images of the atlas are still being loaded.
+   */
+  bool IsLoading() const;
+
 protected:
 
   /**
@@ -94,11 +144,6 @@ protected:
 
 private:
 
-  /**
-   * Upload the bitmap to atlas when the image is loaded in the worker thread.
-   */
-  void UploadToAtlas();
-
   /**
    * Upload broken image
    *
@@ -106,6 +151,17 @@ private:
    */
   void UploadBrokenImage( const Rect<SizeType>& area );
 
+  /**
+   * Calculate the texture area of a packed block, with the half pixel correction.
+   *
+   * @param[in] packPositionX The x coordinate of the block.
+   * @param[in] packPositionY The y coordinate of the block.
+   * @param[in] width The width of the block.
+   * @param[in] height The height of the block.
+   * @param[out] textureRect The texture area of the block.
+   */
+  void CalculateTextureRect( SizeType packPositionX, SizeType packPositionY, SizeType width, SizeType height, Vector4& textureRect ) const;
+
   // Undefined
   ImageAtlas( const ImageAtlas& imageAtlas);
 
@@ -117,16 +173,16 @@ private:
   Atlas                mAtlas;
   AtlasPacker          mPacker;
 
-  LoadQueue            mLoadQueue;
-  CompleteQueue        mCompleteQueue;
-  ImageLoadThread      mLoadingThread;
+  ImageLoadThreadPoolPtr  mThreadPool;      ///< The thread pool shared by all the atlases.
+  Vector< LoadingTask* >  mLoadingTasks;    ///< The tasks of this atlas not uploaded yet. They are owned by the thread pool.
+  ImageDimensionsCachePtr mDimensionsCache; ///< The image dimensions shared by all the atlases and visuals.
+  UploadObserver*         mUploadObserver;  ///< Notified when the images loaded from url are uploaded. Not owned.
 
   std::string          mBrokenImageUrl;
   ImageDimensions      mBrokenImageSize;
   float                mWidth;
   float                mHeight;
   Pixel::Format        mPixelFormat;
-  bool                 mLoadingThreadStarted;
 
 };
 
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include "image-dimensions-cache.h"
+
+// EXTERNAL INCLUDES
+#include <sys/stat.h>
+#include <dali/public-api/images/resource-image.h>
+
+namespace
+{
+Dali::Toolkit::Internal::ImageDimensionsCache* gImageDimensionsCache = NULL; ///< The cache shared by all the atlases and visuals. Only accessed by main thread.
+}
+
+namespace Dali
+{
+
+namespace Toolkit
+{
+
+namespace Internal
+{
+
+ImageDimensionsCachePtr ImageDimensionsCache::Get()
+{
+  if( !gImageDimensionsCache )
+  {
+    gImageDimensionsCache = new ImageDimensionsCache();
+  }
+  return ImageDimensionsCachePtr( gImageDimensionsCache );
+}
+
+ImageDimensionsCache::ImageDimensionsCache()
+: mEntries()
+{
+}
+
+ImageDimensionsCache::~ImageDimensionsCache()
+{
+  gImageDimensionsCache = NULL;
+}
+
+ImageDimensions ImageDimensionsCache::GetImageSize( const std::string& url )
+{
+  struct stat fileStatus;
+  if( 0 != stat( url.c_str(), &fileStatus ) )
+  {
+    // Not a local file, the platform knows how to read it.
+    mEntries.erase( url );
+    return ResourceImage::GetImageSize( url );
+  }
+
+  Entries::iterator it = mEntries.find( url );
+  if( ( it != mEntries.end() ) &&
+      ( it->second.modificationTime == fileStatus.st_mtime ) &&
+      ( it->second.fileSize == fileStatus.st_size ) )
+  {
+    return it->second.dimensions;
+  }
+
+  const ImageDimensions dimensions = ResourceImage::GetImageSize( url );
+  if( ( dimensions.GetWidth() > 0u ) && ( dimensions.GetHeight() > 0u ) )
+  {
+    Entry& entry = mEntries[ url ];
+    entry.dimensions = dimensions;
+    entry.modificationTime = fileStatus.st_mtime;
+    entry.fileSize = fileStatus.st_size;
+  }
+  else if( it != mEntries.end() )
+  {
+    // The file has been replaced by one which can't be read.
+    mEntries.erase( it );
+  }
+
+  return dimensions;
+}
+
+unsigned int ImageDimensionsCache::GetNumberOfEntries() const
+{
+  return mEntries.size();
+}
+
+} // namespace Internal
+
+} // namespace Toolkit
+
+} // namespace Dali
@@ -0,0 +1,118 @@
+#ifndef __DALI_TOOLKIT_IMAGE_DIMENSIONS_CACHE_H__
+#define __DALI_TOOLKIT_IMAGE_DIMENSIONS_CACHE_H__
+
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// EXTERNAL INCLUDES
+#include <map>
+#include <string>
+#include <sys/types.h>
+#include <dali/public-api/common/intrusive-ptr.h>
+#include <dali/public-api/images/image-operations.h>
+#include <dali/public-api/object/ref-object.h>
+
+namespace Dali
+{
+
+namespace Toolkit
+{
+
+namespace Internal
+{
+
+class ImageDimensionsCache;
+typedef IntrusivePtr< ImageDimensionsCache > ImageDimensionsCachePtr;
+
+/**
+ * Caches the dimensions of the image files, so the atlases and the visuals using the same url
+ * read the image header once instead of each time they need the size of the image.
+ *
+ * An entry is valid as long as the modification time and the size of the file don't change.
+ * Urls which are not local files and images which can't be read are not cached.
+ *
+ * The cache is shared by all the atlases and visuals and is only accessed by main thread.
+ */
+class ImageDimensionsCache : public RefObject
+{
+public:
+
+  /**
+   * Retrieves the cache shared by all the atlases and visuals. It's created if there isn't one.
+   *
+   * @return The cache.
+   */
+  static ImageDimensionsCachePtr Get();
+
+  /**
+   * Retrieves the dimensions of an image file. The image header is only read if the dimensions
+   * of the file are not in the cache or the file has been modified since they were read.
+   *
+   * @param[in] url The url of the image file.
+   *
+   * @return The dimensions of the image, or zero if the image can't be read.
+   */
+  ImageDimensions GetImageSize( const std::string& url );
+
+  /**
+   * Retrieves the number of the cached dimensions.
+   */
+  unsigned int GetNumberOfEntries() const;
+
+protected:
+
+  /**
+   * Constructor
+   */
+  ImageDimensionsCache();
+
+  /**
+   * A reference counted object may only be deleted by calling Unreference().
+   */
+  virtual ~ImageDimensionsCache();
+
+private:
+
+  // Undefined
+  ImageDimensionsCache( const ImageDimensionsCache& cache );
+
+  // Undefined
+  ImageDimensionsCache& operator=( const ImageDimensionsCache& cache );
+
+private:
+
+  /**
+   * The cached dimensions of a file, with the file status they were read with.
+   */
+  struct Entry
+  {
+    ImageDimensions dimensions;
+    time_t          modificationTime;
+    off_t           fileSize;
+  };
+
+  typedef std::map< std::string, Entry > Entries;
+
+  Entries mEntries; ///< The dimensions indexed by the url.
+};
+
+} // namespace Internal
+
+} // namespace Toolkit
+
+} // namespace Dali
+
+#endif // __DALI_TOOLKIT_IMAGE_DIMENSIONS_CACHE_H__
@@ -0,0 +1,440 @@
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include "image-disk-cache.h"
+
+// EXTERNAL INCLUDES
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <sstream>
+#include <vector>
+#include <dirent.h>
+#include <fcntl.h>
+#include <stdint.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <dali/devel-api/adaptor-framework/environment-variable.h>
+#include <dali/integration-api/debug.h>
+
+namespace
+{
+const char* const DALI_IMAGE_DISK_CACHE_DIR = "DALI_IMAGE_DISK_CACHE_DIR";
+const char* const DALI_IMAGE_DISK_CACHE_SIZE = "DALI_IMAGE_DISK_CACHE_SIZE";
+const char* const FILE_EXTENSION = ".pixels";
+const unsigned long long DEFAULT_BUDGET = 64ull * 1024ull * 1024ull; ///< The budget in bytes if it's not set with the environment variable.
+const uint32_t FILE_MAGIC = 0x44494331; ///< "DIC1"
+const uint32_t FILE_VERSION = 2u;
+
+Dali::Toolkit::Internal::ImageDiskCache* gImageDiskCache = NULL; ///< The cache set with the environment variable. Only accessed by main thread.
+
+/**
+ * The header at the start of each file, followed by the key string and the pixels.
+ */
+struct FileHeader
+{
+  uint32_t magic;
+  uint32_t version;
+  uint32_t width;
+  uint32_t height;
+  uint32_t pixelFormat;
+  uint32_t keyLength;
+  int64_t  modificationTime; ///< The modification time of the image file when the pixels were stored.
+  int64_t  fileSize;         ///< The size of the image file when the pixels were stored.
+};
+
+/**
+ * Converts the key to the string stored in the file, which tells apart the keys with the same hash.
+ */
+std::string ToString( const Dali::Toolkit::Internal::ImageDiskCache::Key& key )
+{
+  std::ostringstream stream;
+  stream << key.url << '\n'
+         << key.size.GetWidth() << 'x' << key.size.GetHeight() << ':'
+         << static_cast<int>( key.fittingMode ) << ':'
+         << static_cast<int>( key.samplingMode ) << ':'
+         << key.dpi;
+  return stream.str();
+}
+
+/**
+ * The 64 bit FNV-1a hash of the key string, which names the file.
+ */
+uint64_t Hash( const std::string& keyString )
+{
+  uint64_t hash = 14695981039346656037ULL;
+  for( std::string::const_iterator it = keyString.begin(), endIt = keyString.end(); it != endIt; ++it )
+  {
+    hash ^= static_cast<unsigned char>( *it );
+    hash *= 1099511628211ULL;
+  }
+  return hash;
+}
+
+/**
+ * Writes the whole buffer, retrying the interrupted and partial writes.
+ */
+bool WriteAll( int fd, const void* buffer, size_t size )
+{
+  const char* data = static_cast<const char*>( buffer );
+  while( size > 0u )
+  {
+    const ssize_t written = write( fd, data, size );
+    if( written < 0 )
+    {
+      if( EINTR == errno )
+      {
+        continue;
+      }
+      return false;
+    }
+    data += written;
+    size -= static_cast<size_t>( written );
+  }
+  return true;
+}
+
+/**
+ * Reads the whole buffer, retrying the interrupted and partial reads.
+ */
+bool ReadAll( int fd, void* buffer, size_t size )
+{
+  char* data = static_cast<char*>( buffer );
+  while( size > 0u )
+  {
+    const ssize_t bytesRead = read( fd, data, size );
+    if( bytesRead < 0 )
+    {
+      if( EINTR == errno )
+      {
+        continue;
+      }
+      return false;
+    }
+    if( 0 == bytesRead )
+    {
+      // The file is shorter than its header says.
+      return false;
+    }
+    data += bytesRead;
+    size -= static_cast<size_t>( bytesRead );
+  }
+  return true;
+}
+
+/**
+ * A file of the cache, sorted by the time it was last used.
+ */
+struct CacheFile
+{
+  std::string path;
+  time_t      seconds;
+  long        nanoseconds;
+  off_t       size;
+
+  bool operator<( const CacheFile& rhs ) const
+  {
+    return ( seconds < rhs.seconds ) || ( ( seconds == rhs.seconds ) && ( nanoseconds < rhs.nanoseconds ) );
+  }
+};
+
+/**
+ * Retrieves the budget set with the DALI_IMAGE_DISK_CACHE_SIZE environment variable.
+ */
+unsigned long long GetBudgetFromEnvironment()
+{
+  const char* size = Dali::EnvironmentVariable::GetEnvironmentVariable( DALI_IMAGE_DISK_CACHE_SIZE );
+  if( NULL != size )
+  {
+    const unsigned long long value = std::strtoull( size, NULL, 10 );
+    if( value > 0u )
+    {
+      return value;
+    }
+  }
+  return DEFAULT_BUDGET;
+}
+
+} // unnamed namespace
+
+namespace Dali
+{
+
+namespace Toolkit
+{
+
+namespace Internal
+{
+
+ImageDiskCache::Key::Key( const std::string& url, ImageDimensions size, FittingMode::Type fittingMode, SamplingMode::Type samplingMode, float dpi )
+: url( url ),
+  size( size ),
+  fittingMode( fittingMode ),
+  samplingMode( samplingMode ),
+  dpi( dpi )
+{
+}
+
+ImageDiskCachePtr ImageDiskCache::Get()
+{
+  if( !gImageDiskCache )
+  {
+    const char* directory = EnvironmentVariable::GetEnvironmentVariable( DALI_IMAGE_DISK_CACHE_DIR );
+    if( NULL != directory )
+    {
+      ImageDiskCachePtr cache = New( directory, GetBudgetFromEnvironment() );
+      gImageDiskCache = cache.Get();
+      return cache;
+    }
+  }
+  return ImageDiskCachePtr( gImageDiskCache );
+}
+
+ImageDiskCachePtr ImageDiskCache::New( const std::string& directory, unsigned long long budget )
+{
+  // Only absolute paths, the cache must not depend on the working directory.
+  if( directory.empty() || ( '/' != directory[0] ) )
+  {
+    DALI_LOG_ERROR( "The image disk cache directory must be an absolute path: %s\n", directory.c_str() );
+    return ImageDiskCachePtr();
+  }
+
+  if( ( 0 != mkdir( directory.c_str(), S_IRWXU ) ) && ( EEXIST != errno ) )
+  {
+    DALI_LOG_ERROR( "Can not create the image disk cache directory: %s\n", directory.c_str() );
+    return ImageDiskCachePtr();
+  }
+
+  return ImageDiskCachePtr( new ImageDiskCache( directory, budget ) );
+}
+
+ImageDiskCache::ImageDiskCache( const std::string& directory, unsigned long long budget )
+: mDirectory( directory ),
+  mBudget( budget ),
+  mMutex(),
+  mSize( 0u ),
+  mIsSizeKnown( false )
+{
+}
+
+ImageDiskCache::~ImageDiskCache()
+{
+  if( gImageDiskCache == this )
+  {
+    gImageDiskCache = NULL;
+  }
+}
+
+PixelData ImageDiskCache::Load( const Key& key ) const
+{
+  struct stat imageStatus;
+  if( 0 != stat( key.url.c_str(), &imageStatus ) )
+  {
+    return PixelData();
+  }
+
+  const std::string keyString = ToString( key );
+  const int fd = open( GetFilePath( keyString ).c_str(), O_RDONLY );
+  if( fd < 0 )
+  {
+    return PixelData();
+  }
+
+  PixelData pixelData;
+
+  FileHeader header;
+  std::string storedKeyString( keyString.size(), '\0' );
+  if( ReadAll( fd, &header, sizeof( FileHeader ) ) &&
+      ( FILE_MAGIC == header.magic ) &&
+      ( FILE_VERSION == header.version ) &&
+      ( static_cast<int64_t>( imageStatus.st_mtime ) == header.modificationTime ) &&
+      ( static_cast<int64_t>( imageStatus.st_size ) == header.fileSize ) &&
+      ( keyString.size() == header.keyLength ) &&
+      ReadAll( fd, &storedKeyString[0], storedKeyString.size() ) &&
+      ( keyString == storedKeyString ) )
+  {
+    const Pixel::Format pixelFormat = static_cast<Pixel::Format>( header.pixelFormat );
+    const size_t bufferSize = static_cast<size_t>( header.width ) * header.height * Pixel::GetBytesPerPixel( pixelFormat );
+    if( bufferSize > 0u )
+    {
+      // The pixels are read straight into the buffer owned by the pixel data.
+      unsigned char* buffer = new unsigned char[ bufferSize ];
+      if( ReadAll( fd, buffer, bufferSize ) )
+      {
+        pixelData = PixelData::New( buffer, bufferSize, header.width, header.height, pixelFormat, PixelData::DELETE_ARRAY );
+
+        // The modification time of the file tells when it was last used.
+        futimens( fd, NULL );
+      }
+      else
+      {
+        delete[] buffer;
+      }
+    }
+  }
+
+  close( fd );
+
+  return pixelData;
+}
+
+bool ImageDiskCache::Store( const Key& key, const unsigned char* pixels, unsigned int width, unsigned int height, Pixel::Format pixelFormat ) const
+{
+  struct stat imageStatus;
+  if( 0 != stat( key.url.c_str(), &imageStatus ) )
+  {
+    return false;
+  }
+
+  const std::string keyString = ToString( key );
+  const std::string filePath = GetFilePath( keyString );
+
+  // Write a temporary file and rename it, so the other threads and processes never load a partial file.
+  std::string temporaryPath = filePath + ".XXXXXX";
+  const int fd = mkstemp( &temporaryPath[0] );
+  if( fd < 0 )
+  {
+    return false;
+  }
+
+  FileHeader header;
+  memset( &header, 0, sizeof( FileHeader ) );
+  header.magic = FILE_MAGIC;
+  header.version = FILE_VERSION;
+  header.width = width;
+  header.height = height;
+  header.pixelFormat = static_cast<uint32_t>( pixelFormat );
+  header.keyLength = static_cast<uint32_t>( keyString.size() );
+  header.modificationTime = static_cast<int64_t>( imageStatus.st_mtime );
+  header.fileSize = static_cast<int64_t>( imageStatus.st_size );
+
+  const size_t bufferSize = static_cast<size_t>( width ) * height * Pixel::GetBytesPerPixel( pixelFormat );
+  const bool written = WriteAll( fd, &header, sizeof( FileHeader ) ) &&
+                       WriteAll( fd, keyString.data(), keyString.size() ) &&
+                       WriteAll( fd, pixels, bufferSize );
+
+  if( ( 0 != close( fd ) ) || !written || ( 0 != rename( temporaryPath.c_str(), filePath.c_str() ) ) )
+  {
+    unlink( temporaryPath.c_str() );
+    return false;
+  }
+
+  AddStoredFile( filePath, sizeof( FileHeader ) + keyString.size() + bufferSize );
+
+  return true;
+}
+
+const std::string& ImageDiskCache::GetDirectory() const
+{
+  return mDirectory;
+}
+
+unsigned long long ImageDiskCache::GetBudget() const
+{
+  return mBudget;
+}
+
+std::string ImageDiskCache::GetFilePath( const std::string& keyString ) const
+{
+  char fileName[32];
+  snprintf( fileName, sizeof( fileName ), "/%016llx%s", static_cast<unsigned long long>( Hash( keyString ) ), FILE_EXTENSION );
+  return mDirectory + fileName;
+}
+
+void ImageDiskCache::AddStoredFile( const std::string& filePath, unsigned long long fileSize ) const
+{
+  {
+    Mutex::ScopedLock lock( mMutex );
+
+    // The count is an estimate: a file replacing another one is counted twice and the files of the other
+    // processes are not counted. The directory is read again when the count goes over the budget, which corrects it.
+    mSize += fileSize;
+    if( mIsSizeKnown && ( mSize <= mBudget ) )
+    {
+      return;
+    }
+  }
+
+  const unsigned long long size = Trim( filePath );
+
+  Mutex::ScopedLock lock( mMutex );
+  mSize = size;
+  mIsSizeKnown = true;
+}
+
+unsigned long long ImageDiskCache::Trim( const std::string& keptFilePath ) const
+{
+  DIR* directory = opendir( mDirectory.c_str() );
+  if( NULL == directory )
+  {
+    return 0u;
+  }
+
+  // The temporary files being written by the other threads are not counted.
+  const size_t extensionLength = strlen( FILE_EXTENSION );
+  std::vector<CacheFile> files;
+  unsigned long long totalSize = 0u;
+  while( struct dirent* entry = readdir( directory ) )
+  {
+    const size_t nameLength = strlen( entry->d_name );
+    if( ( nameLength <= extensionLength ) || ( 0 != strcmp( entry->d_name + nameLength - extensionLength, FILE_EXTENSION ) ) )
+    {
+      continue;
+    }
+
+    CacheFile file;
+    file.path = mDirectory + '/' + entry->d_name;
+
+    struct stat fileStatus;
+    if( 0 == stat( file.path.c_str(), &fileStatus ) )
+    {
+      file.seconds = fileStatus.st_mtim.tv_sec;
+      file.nanoseconds = fileStatus.st_mtim.tv_nsec;
+      file.size = fileStatus.st_size;
+      totalSize += static_cast<unsigned long long>( file.size );
+      files.push_back( file );
+    }
+  }
+  closedir( directory );
+
+  if( totalSize <= mBudget )
+  {
+    return totalSize;
+  }
+
+  // Remove the least recently used files first. Another thread may have removed a file already.
+  std::sort( files.begin(), files.end() );
+  for( std::vector<CacheFile>::const_iterator it = files.begin(), endIt = files.end(); ( it != endIt ) && ( totalSize > mBudget ); ++it )
+  {
+    if( it->path != keptFilePath )
+    {
+      unlink( it->path.c_str() );
+      totalSize -= static_cast<unsigned long long>( it->size );
+    }
+  }
+
+  return totalSize;
+}
+
+} // namespace Internal
+
+} // namespace Toolkit
+
+} // namespace Dali
@@ -0,0 +1,203 @@
+#ifndef __DALI_TOOLKIT_IMAGE_DISK_CACHE_H__
+#define __DALI_TOOLKIT_IMAGE_DISK_CACHE_H__
+
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// EXTERNAL INCLUDES
+#include <string>
+#include <dali/public-api/common/intrusive-ptr.h>
+#include <dali/public-api/images/image-operations.h>
+#include <dali/public-api/images/pixel.h>
+#include <dali/public-api/images/pixel-data.h>
+#include <dali/public-api/object/ref-object.h>
+#include <dali/devel-api/threading/mutex.h>
+
+namespace Dali
+{
+
+namespace Toolkit
+{
+
+namespace Internal
+{
+
+class ImageDiskCache;
+typedef IntrusivePtr< ImageDiskCache > ImageDiskCachePtr;
+
+/**
+ * Keeps the rasterized pixels of the svg images in files, so they are not parsed and rasterized again
+ * the next time the application is launched.
+ *
+ * There is one file per url and load parameters. It contains a header, the key it was stored with and the pixels.
+ * The pixels are read straight into the buffer of the pixel data when they are loaded. A file is only used if the
+ * modification time and the size of the image file haven't changed since the pixels were stored.
+ *
+ * The files are trimmed to a budget in bytes when pixels are stored. The least recently used files are removed first,
+ * a file is touched when it's loaded so its modification time tells when it was last used. The size of the files is
+ * counted as they are stored, the directory is only read when the count goes over the budget.
+ *
+ * The cache is optional. It's enabled by setting the DALI_IMAGE_DISK_CACHE_DIR environment variable to the
+ * absolute path of the directory where the files are stored. The budget is set with the DALI_IMAGE_DISK_CACHE_SIZE
+ * environment variable, in bytes.
+ *
+ * Loading and storing can be called by the worker threads at the same time, only the count of the size is locked.
+ * A file is written under a temporary name and renamed, so a file being stored is never loaded.
+ */
+class ImageDiskCache : public RefObject
+{
+public:
+
+  /**
+   * The url and the load parameters of the pixels.
+   */
+  struct Key
+  {
+    /**
+     * Constructor.
+     *
+     * @param[in] url The url of the image file.
+     * @param[in] size The size the image is loaded at.
+     * @param[in] fittingMode The fitting mode used to load the image.
+     * @param[in] samplingMode The sampling mode used to load the image.
+     * @param[in] dpi The dpi a vector image is rasterized at, zero for the other images.
+     */
+    Key( const std::string& url,
+         ImageDimensions size,
+         FittingMode::Type fittingMode = FittingMode::DEFAULT,
+         SamplingMode::Type samplingMode = SamplingMode::DEFAULT,
+         float dpi = 0.f );
+
+    std::string        url;
+    ImageDimensions    size;
+    FittingMode::Type  fittingMode;
+    SamplingMode::Type samplingMode;
+    float              dpi;
+  };
+
+  /**
+   * Retrieves the cache set with the DALI_IMAGE_DISK_CACHE_DIR environment variable. Called by main thread.
+   *
+   * @return The cache, or an empty pointer if the disk cache is not enabled.
+   */
+  static ImageDiskCachePtr Get();
+
+  /**
+   * Creates a cache storing the files in the given directory. The directory is created if it doesn't exist.
+   *
+   * @param[in] directory The absolute path of the directory.
+   * @param[in] budget The maximum size of the files in bytes.
+   *
+   * @return The cache, or an empty pointer if the directory can't be created.
+   */
+  static ImageDiskCachePtr New( const std::string& directory, unsigned long long budget );
+
+  /**
+   * Loads the pixels stored with the given key. Called by the worker threads.
+   *
+   * @param[in] key The url and load parameters of the pixels.
+   *
+   * @return The pixels, or an empty handle if they are not stored or the image file has been modified since.
+   */
+  PixelData Load( const Key& key ) const;
+
+  /**
+   * Stores the pixels loaded with the given key, replacing the ones stored before. Called by the worker threads.
+   * The least recently used files are removed if the files are over the budget.
+   *
+   * @param[in] key The url and load parameters of the pixels.
+   * @param[in] pixels The pixels, without padding between the rows.
+   * @param[in] width The width of the pixels.
+   * @param[in] height The height of the pixels.
+   * @param[in] pixelFormat The format of the pixels.
+   *
+   * @return Whether the pixels have been stored.
+   */
+  bool Store( const Key& key, const unsigned char* pixels, unsigned int width, unsigned int height, Pixel::Format pixelFormat ) const;
+
+  /**
+   * Retrieves the directory where the files are stored.
+   */
+  const std::string& GetDirectory() const;
+
+  /**
+   * Retrieves the maximum size of the files in bytes.
+   */
+  unsigned long long GetBudget() const;
+
+protected:
+
+  /**
+   * Constructor
+   *
+   * @param[in] directory The absolute path of the directory.
+   * @param[in] budget The maximum size of the files in bytes.
+   */
+  ImageDiskCache( const std::string& directory, unsigned long long budget );
+
+  /**
+   * A reference counted object may only be deleted by calling Unreference().
+   */
+  virtual ~ImageDiskCache();
+
+private:
+
+  /**
+   * Retrieves the path of the file storing the pixels of the given key.
+   *
+   * @param[in] keyString The key converted to a string.
+   */
+  std::string GetFilePath( const std::string& keyString ) const;
+
+  /**
+   * Adds the size of a file just stored to the count, and trims the files if the count is over the budget.
+   *
+   * @param[in] filePath The path of the file just stored.
+   * @param[in] fileSize The size of the file in bytes.
+   */
+  void AddStoredFile( const std::string& filePath, unsigned long long fileSize ) const;
+
+  /**
+   * Removes the least recently used files until the files are within the budget.
+   *
+   * @param[in] keptFilePath The path of the file just stored, which is never removed.
+   *
+   * @return The size of the files left in bytes.
+   */
+  unsigned long long Trim( const std::string& keptFilePath ) const;
+
+  // Undefined
+  ImageDiskCache( const ImageDiskCache& cache );
+
+  // Undefined
+  ImageDiskCache& operator=( const ImageDiskCache& cache );
+
+private:
+
+  std::string                mDirectory;   ///< The directory where the files are stored.
+  unsigned long long         mBudget;      ///< The maximum size of the files in bytes.
+  mutable Mutex              mMutex;       ///< Locks the count of the size of the files.
+  mutable unsigned long long mSize;        ///< The size of the files in bytes, counted since the directory was last read.
+  mutable bool               mIsSizeKnown; ///< Whether the directory has been read, the size is unknown until then.
+};
+
+} // namespace Internal
+
+} // namespace Toolkit
+
+} // namespace Dali
+
+#endif // __DALI_TOOLKIT_IMAGE_DISK_CACHE_H__
@@ -18,6 +18,50 @@
 // CLASS HEADER
 #include "image-load-thread.h"
 
+// EXTERNAL INCLUDES
+#include <algorithm>
+#include <cstdlib>
+#include <unistd.h>
+#include <dali/public-api/signals/callback.h>
+#include <dali/devel-api/adaptor-framework/environment-variable.h>
+
+// INTERNAL INCLUDES
+#include <dali-toolkit/internal/image-atlas/image-atlas-impl.h>
+
+namespace
+{
+const char* const DALI_IMAGE_LOAD_THREADS = "DALI_IMAGE_LOAD_THREADS";
+const unsigned int MAX_NUMBER_OF_LOAD_THREADS = 8u;
+
+Dali::Toolkit::Internal::ImageLoadThreadPool* gThreadPool = NULL; ///< The thread pool shared by all the atlases. Only accessed by main thread.
+
+/**
+ * Retrieves the number of worker threads. One less than the number of cores, as the main thread
+ * is busy as well, unless it's set with the DALI_IMAGE_LOAD_THREADS environment variable.
+ */
+unsigned int GetNumberOfLoadThreads()
+{
+  const char* threads = Dali::EnvironmentVariable::GetEnvironmentVariable( DALI_IMAGE_LOAD_THREADS );
+  if( NULL != threads )
+  {
+    const long value = std::strtol( threads, NULL, 10 );
+    if( value > 0 )
+    {
+      return std::min( static_cast<unsigned int>( value ), MAX_NUMBER_OF_LOAD_THREADS );
+    }
+  }
+
+  const long numberOfCores = sysconf( _SC_NPROCESSORS_ONLN );
+  if( numberOfCores > 2 )
+  {
+    return std::min( static_cast<unsigned int>( numberOfCores - 1 ), MAX_NUMBER_OF_LOAD_THREADS );
+  }
+
+  return 1u;
+}
+
+} // unnamed namespace
+
 namespace Dali
 {
 
@@ -27,109 +71,223 @@ namespace Toolkit
 namespace Internal
 {
 
-LoadingTask::LoadingTask(BitmapLoader loader, uint32_t packPositionX, uint32_t packPositionY, uint32_t width, uint32_t height )
+LoadingTask::LoadingTask(BitmapLoader loader, ImageAtlas* atlas, uint32_t packPositionX, uint32_t packPositionY, uint32_t width, uint32_t height )
 : loader( loader ),
+  atlas( atlas ),
   packRect( packPositionX, packPositionY, width, height )
 {
 }
 
-LoadQueue::LoadQueue()
+ImageLoadThread::ImageLoadThread( ImageLoadThreadPool& threadPool )
+: mThreadPool( threadPool )
 {
 }
 
-LoadQueue::~LoadQueue()
+ImageLoadThread::~ImageLoadThread()
 {
 }
 
-LoadingTask* LoadQueue::NextTask()
+void ImageLoadThread::Run()
 {
-  // Lock while popping task out from the queue
-  ConditionalWait::ScopedLock lock( mConditionalWait );
-
-  while( mTasks.Empty() )
+  while( LoadingTask* task = mThreadPool.NextTaskToProcess() )
   {
-    mConditionalWait.Wait( lock );
+    task->loader.Load();
+    mThreadPool.AddCompletedTask( task );
   }
+}
 
-  Vector< LoadingTask* >::Iterator next = mTasks.Begin();
-  LoadingTask* nextTask = *next;
-  mTasks.Erase( next );
-
-  return nextTask;
+ImageLoadThreadPoolPtr ImageLoadThreadPool::Get()
+{
+  if( !gThreadPool )
+  {
+    gThreadPool = new ImageLoadThreadPool();
+  }
+  return ImageLoadThreadPoolPtr( gThreadPool );
 }
 
-void LoadQueue::AddTask( LoadingTask* task )
+ImageLoadThreadPool::ImageLoadThreadPool()
+: mTrigger( new EventThreadCallback( MakeCallback( this, &ImageLoadThreadPool::UploadCompletedTasks ) ) ),
+  mIsStarted( false ),
+  mIsTerminating( false )
 {
-  bool wasEmpty = false;
+  const unsigned int numberOfThreads = GetNumberOfLoadThreads();
+  mThreads.reserve( numberOfThreads );
+  for( unsigned int index = 0u; index < numberOfThreads; ++index )
+  {
+    mThreads.push_back( new ImageLoadThread( *this ) );
+  }
+}
 
+ImageLoadThreadPool::~ImageLoadThreadPool()
+{
+  if( mIsStarted )
   {
-    // Lock while adding task to the queue
-    ConditionalWait::ScopedLock lock( mConditionalWait );
-    wasEmpty = mTasks.Empty();
-    mTasks.PushBack( task );
+    {
+      // the terminating flag stops the threads from conditional wait.
+      ConditionalWait::ScopedLock lock( mConditionalWait );
+      mIsTerminating = true;
+    }
+
+    // stop the threads. Notify once per thread in case each notification wakes up only one of them.
+    for( std::vector< ImageLoadThread* >::iterator it = mThreads.begin(), endIt = mThreads.end(); it != endIt; ++it )
+    {
+      mConditionalWait.Notify();
+    }
+
+    for( std::vector< ImageLoadThread* >::iterator it = mThreads.begin(), endIt = mThreads.end(); it != endIt; ++it )
+    {
+      (*it)->Join();
+    }
   }
 
-  if( wasEmpty)
+  for( std::vector< ImageLoadThread* >::iterator it = mThreads.begin(), endIt = mThreads.end(); it != endIt; ++it )
   {
-    // wake up the image loading thread
-    mConditionalWait.Notify();
+    delete *it;
   }
-}
 
-CompleteQueue::CompleteQueue(EventThreadCallback* trigger)
-: mTrigger( trigger )
-{}
+  // All the atlases are deleted, so the remaining tasks have been cancelled.
+  for( TaskQueue::iterator it = mLoadTasks.begin(), endIt = mLoadTasks.end(); it != endIt; ++it )
+  {
+    delete *it;
+  }
+  for( TaskQueue::iterator it = mCompletedTasks.begin(), endIt = mCompletedTasks.end(); it != endIt; ++it )
+  {
+    delete *it;
+  }
+  DeleteCancelledTasks();
 
-CompleteQueue::~CompleteQueue()
-{
   delete mTrigger;
+
+  gThreadPool = NULL;
 }
 
-LoadingTask* CompleteQueue::NextTask()
+void ImageLoadThreadPool::AddTask( LoadingTask* task )
 {
-  // Lock while popping task out from the queue
-  Mutex::ScopedLock lock( mMutex );
+  if( !mIsStarted )
+  {
+    for( std::vector< ImageLoadThread* >::iterator it = mThreads.begin(), endIt = mThreads.end(); it != endIt; ++it )
+    {
+      (*it)->Start();
+    }
+    mIsStarted = true;
+  }
 
-  if( mTasks.Empty() )
   {
-    return NULL;
+    // Lock while adding task to the queue
+    ConditionalWait::ScopedLock lock( mConditionalWait );
+
+    DeleteCancelledTasks();
+
+    mLoadTasks.push_back( task );
   }
 
-  Vector< LoadingTask* >::Iterator next = mTasks.Begin();
-  LoadingTask* nextTask = *next;
-  mTasks.Erase( next );
+  // wake up a worker thread
+  mConditionalWait.Notify();
+}
+
+void ImageLoadThreadPool::CancelTask( LoadingTask* task )
+{
+  // Lock while cancelling the task, so the worker threads can't pop it at the same time.
+  ConditionalWait::ScopedLock lock( mConditionalWait );
+
+  // The task is left in the queue. It's skipped by the worker threads or deleted without uploading when it's completed.
+  task->atlas = NULL;
 
-  return nextTask;
+  DeleteCancelledTasks();
 }
 
-void CompleteQueue::AddTask( LoadingTask* task )
+void ImageLoadThreadPool::WaitForCompletedTask()
 {
-  // Lock while adding task to the queue
-  Mutex::ScopedLock lock( mMutex );
-  mTasks.PushBack( task );
+  ConditionalWait::ScopedLock lock( mCompletedWait );
 
-  // wake up the main thread
-  mTrigger->Trigger();
+  while( mCompletedTasks.empty() )
+  {
+    mCompletedWait.Wait( lock );
+  }
 }
 
+void ImageLoadThreadPool::UploadCompletedTasks()
+{
+  for( ;; )
+  {
+    LoadingTask* task = NULL;
+    {
+      // Lock while popping task out from the queue
+      ConditionalWait::ScopedLock lock( mCompletedWait );
+
+      if( mCompletedTasks.empty() )
+      {
+        break;
+      }
+
+      task = mCompletedTasks.front();
+      mCompletedTasks.pop_front();
+    }
+
+    // The atlas is NULL if the task has been cancelled while it was loaded.
+    if( task->atlas )
+    {
+      task->atlas->UploadToAtlas( *task );
+    }
+
+    delete task;
+  }
+}
 
-ImageLoadThread::ImageLoadThread( LoadQueue& loadQueue, CompleteQueue& completeQueue )
-: mLoadQueue( loadQueue ),
-  mCompleteQueue( completeQueue )
+unsigned int ImageLoadThreadPool::GetNumberOfThreads() const
 {
+  return mThreads.size();
 }
 
-ImageLoadThread::~ImageLoadThread()
+LoadingTask* ImageLoadThreadPool::NextTaskToProcess()
 {
+  // Lock while popping task out from the queue
+  ConditionalWait::ScopedLock lock( mConditionalWait );
+
+  while( !mIsTerminating )
+  {
+    while( !mLoadTasks.empty() )
+    {
+      LoadingTask* nextTask = mLoadTasks.front();
+      mLoadTasks.pop_front();
+
+      if( nextTask->atlas )
+      {
+        return nextTask;
+      }
+
+      // The cancelled tasks are deleted in the main thread.
+      mCancelledTasks.PushBack( nextTask );
+    }
+
+    mConditionalWait.Wait( lock );
+  }
+
+  return NULL;
 }
 
-void ImageLoadThread::Run()
+void ImageLoadThreadPool::AddCompletedTask( LoadingTask* task )
 {
-  while( LoadingTask* task = mLoadQueue.NextTask() )
   {
-    task->loader.Load();
-    mCompleteQueue.AddTask( task );
+    // Lock while adding task to the queue
+    ConditionalWait::ScopedLock lock( mCompletedWait );
+    mCompletedTasks.push_back( task );
+
+    // wake up the main thread
+    mTrigger->Trigger();
+  }
+
+  // wake up the main thread if it's waiting for the images of an atlas being deleted
+  mCompletedWait.Notify();
+}
+
+void ImageLoadThreadPool::DeleteCancelledTasks()
+{
+  for( Vector< LoadingTask* >::Iterator it = mCancelledTasks.Begin(), endIt = mCancelledTasks.End(); it != endIt; ++it )
+  {
+    delete *it;
   }
+  mCancelledTasks.Clear();
 }
 
 } // namespace Internal
@@ -18,7 +18,10 @@
  */
 
 // EXTERNAL INCLUDES
+#include <deque>
 #include <dali/public-api/common/dali-vector.h>
+#include <dali/public-api/common/intrusive-ptr.h>
+#include <dali/public-api/common/vector-wrapper.h>
 #include <dali/public-api/object/ref-object.h>
 #include <dali/devel-api/threading/conditional-wait.h>
 #include <dali/devel-api/threading/mutex.h>
@@ -35,15 +38,21 @@ namespace Toolkit
 namespace Internal
 {
 
+class ImageAtlas;
+class ImageLoadThreadPool;
+typedef IntrusivePtr< ImageLoadThreadPool > ImageLoadThreadPoolPtr;
+
 /**
  * The task of loading and packing an image into the atlas.
+ *
+ * The task is created and deleted in the main thread. The worker threads only load the bitmap.
  */
 struct LoadingTask
 {
   /**
    * Constructor.
    */
-  LoadingTask( BitmapLoader loader, uint32_t packPositionX, uint32_t packPositionY, uint32_t width, uint32_t height  );
+  LoadingTask( BitmapLoader loader, ImageAtlas* atlas, uint32_t packPositionX, uint32_t packPositionY, uint32_t width, uint32_t height  );
 
 private:
 
@@ -56,143 +65,166 @@ private:
 public:
 
   BitmapLoader   loader;    ///< The loader used to load the bitmap from URL
+  ImageAtlas*    atlas;     ///< The atlas which the bitmap is uploaded to. NULL if the task has been cancelled.
   Rect<uint32_t> packRect;  ///< The x coordinate of the position to pack the image.
 
 };
 
 /**
- * The queue of the tasks waiting to load the bitmap from the URL in the worker thread/
+ * A worker thread for image loading.
  */
-class LoadQueue //: public TaskQueue
+class ImageLoadThread : public Thread
 {
 public:
 
   /**
-   * Constructor
+   * Constructor.
+   *
+   * @param[in] threadPool The thread pool which provides the tasks.
    */
-  LoadQueue();
+  ImageLoadThread( ImageLoadThreadPool& threadPool );
 
   /**
    * Destructor.
    */
-  ~LoadQueue();
+  virtual ~ImageLoadThread();
 
-  /**
-   * Pop the next task out from the queue.
-   *
-   * @return The next task to be processed.
-   */
-  LoadingTask* NextTask();
+protected:
 
   /**
-   * Add a task in to the queue
-   *
-   * @param[in] task The task added to the queue.
+   * The entry function of the worker thread.
+   * It fetches loading task from the thread pool, loads the image and adds it back to the completed queue.
    */
-  void AddTask( LoadingTask* task );
+  virtual void Run();
 
 private:
 
   // Undefined
-  LoadQueue( const LoadQueue& queue );
+  ImageLoadThread( const ImageLoadThread& thread );
 
   // Undefined
-  LoadQueue& operator=( const LoadQueue& queue );
+  ImageLoadThread& operator=( const ImageLoadThread& thread );
 
 private:
 
-  Vector< LoadingTask* > mTasks;
-  ConditionalWait mConditionalWait;
+  ImageLoadThreadPool& mThreadPool; ///< The thread pool which provides the tasks.
 };
 
 /**
- * The queue of the tasks, with the image loaded, waiting for the main thread to upload the bitmap.
+ * The pool of worker threads loading the images of all the atlases.
+ *
+ * There is one pool shared by all the atlases. It's created with the first atlas and deleted with the last one.
+ * The worker threads take the tasks from one queue, so they're busy while there are images to load regardless of their atlas.
+ *
+ * A task is cancelled when its atlas area is removed before the image is loaded. The cancelled tasks are skipped by the
+ * worker threads, or not uploaded if they are being loaded, and they are deleted in the main thread.
+ *
+ * The number of worker threads is set with the DALI_IMAGE_LOAD_THREADS environment variable. By default it depends on the number of cores.
  */
-class CompleteQueue //: public TaskQueue
+class ImageLoadThreadPool : public RefObject
 {
 public:
 
   /**
-   * Constructor
+   * Retrieves the thread pool shared by all the atlases. It's created if there isn't one. Called by main thread.
    *
-   * @param[in] mTrigger The trigger to wake up the main thread.
+   * @return The thread pool.
    */
-  CompleteQueue( EventThreadCallback* mTrigger );
+  static ImageLoadThreadPoolPtr Get();
 
   /**
-   * Destructor.
+   * Add a loading task into the waiting queue, called by main thread. The worker threads are started with the first task.
+   *
+   * @param[in] task The task added to the queue. The pool takes the ownership.
    */
-  ~CompleteQueue();
+  void AddTask( LoadingTask* task );
 
   /**
-   * Pop the next task out from the queue.
+   * Cancel a task, called by main thread.
    *
-   * @return The next task to be processed.
+   * The task is left in the queue and skipped by the worker threads. If it's being loaded, the bitmap is not uploaded.
+   *
+   * @param[in] task The task to be cancelled.
    */
-  LoadingTask* NextTask();
+  void CancelTask( LoadingTask* task );
 
   /**
-   * Add a task in to the queue
+   * Block until a task has been loaded, called by main thread.
    *
-   * @param[in] task The task added to the queue.
+   * Used to upload all the images of an atlas before it's deleted.
    */
-  void AddTask( LoadingTask* task );
+  void WaitForCompletedTask();
 
-private:
+  /**
+   * Upload the loaded bitmaps to their atlases and delete the tasks, called by main thread.
+   */
+  void UploadCompletedTasks();
 
-  // Undefined
-  CompleteQueue( const CompleteQueue& queue );
+  /**
+   * Retrieves the number of worker threads.
+   */
+  unsigned int GetNumberOfThreads() const;
 
-  // Undefined
-  CompleteQueue& operator=( const CompleteQueue& queue );
+protected:
+
+  /**
+   * A reference counted object may only be deleted by calling Unreference().
+   * Terminates and joins the worker threads.
+   */
+  virtual ~ImageLoadThreadPool();
 
 private:
 
-  Vector< LoadingTask* > mTasks;
-  Dali::Mutex            mMutex;
-  EventThreadCallback*   mTrigger;
-};
-
-/**
- * The worker thread for image loading.
- */
-class ImageLoadThread : public Thread
-{
-public:
+  friend class ImageLoadThread;
 
   /**
    * Constructor.
-   *
-   * @param[in] loadQueue The task queue with images for loading.
-   * @param[in] completeQurue The task queue with images loaded.
    */
-  ImageLoadThread( LoadQueue& loadQueue, CompleteQueue& completeQueue );
+  ImageLoadThreadPool();
 
   /**
-   * Destructor.
+   * Pop the next task out from the waiting queue, called by the worker threads.
+   *
+   * The cancelled tasks are skipped.
+   *
+   * @return The next task to be processed or NULL if the threads are terminated.
    */
-  virtual ~ImageLoadThread();
-
-protected:
+  LoadingTask* NextTaskToProcess();
 
   /**
-   * The entry function of the worker thread.
-   * It fetches loading task from the loadQueue, loads the image and adds to the completeQueue.
+   * Add a task in to the completed queue, called by the worker threads.
+   *
+   * @param[in] task The task with the bitmap loaded.
    */
-  virtual void Run();
+  void AddCompletedTask( LoadingTask* task );
 
-private:
+  /**
+   * Delete the cancelled tasks skipped by the worker threads, called by main thread with the waiting queue locked.
+   */
+  void DeleteCancelledTasks();
 
   // Undefined
-  ImageLoadThread( const ImageLoadThread& thread );
+  ImageLoadThreadPool( const ImageLoadThreadPool& threadPool );
 
   // Undefined
-  ImageLoadThread& operator=( const ImageLoadThread& thread );
+  ImageLoadThreadPool& operator=( const ImageLoadThreadPool& threadPool );
 
 private:
 
-  LoadQueue& mLoadQueue;          ///<The task queue with images for loading.
-  CompleteQueue& mCompleteQueue;  ///<The task queue with images loaded.
+  typedef std::deque< LoadingTask* > TaskQueue;
+
+  TaskQueue                     mLoadTasks;          ///< The tasks waiting to load the image.
+  Vector< LoadingTask* >        mCancelledTasks;     ///< The cancelled tasks skipped by the worker threads, waiting to be deleted in main thread.
+  TaskQueue                     mCompletedTasks;     ///< The tasks with the image loaded, waiting to be uploaded in main thread.
+
+  std::vector<ImageLoadThread*> mThreads;            ///< The worker threads.
+
+  ConditionalWait               mConditionalWait;    ///< Locks the waiting queue and wakes up the worker threads.
+  ConditionalWait               mCompletedWait;      ///< Locks the completed queue and wakes up the main thread waiting for a completed task.
+  EventThreadCallback*          mTrigger;            ///< Wakes up the main thread to upload the completed tasks.
+
+  bool                          mIsStarted;
+  bool                          mIsTerminating;
 };
 
 } // namespace Internal
@@ -18,6 +18,15 @@
 // FILE HEADER
 #include <dali-toolkit/internal/text/character-set-conversion.h>
 
+// EXTERNAL INCLUDES
+// The vector paths are selected at compile time. SSE2 is part of x86-64 and NEON of AArch64.
+// On ARMv7 NEON is optional, it's used when the toolkit is configured with --enable-neon.
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON__) || defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
 namespace Dali
 {
 
@@ -72,6 +81,494 @@ namespace
 
   const uint8_t CR = 0xd;
   const uint8_t LF = 0xa;
+
+  const uint32_t REPLACEMENT_CHARACTER = 0xfffdu; ///< Replaces the non valid sequences.
+
+  const uint32_t BLOCK_SIZE = 16u; ///< The number of bytes checked and converted at once by the vector paths.
+
+#if !defined(__SSE2__) && ( defined(__ARM_NEON__) || defined(__ARM_NEON) )
+/**
+ * @brief Retrieves the greatest byte of a NEON vector.
+ *
+ * AArch64 has a horizontal maximum instruction. ARMv7 reduces the vector with pairwise maximums.
+ */
+inline uint8_t MaxByte( const uint8x16_t bytes )
+{
+#if defined(__aarch64__)
+  return vmaxvq_u8( bytes );
+#else
+  uint8x8_t max = vmax_u8( vget_low_u8( bytes ), vget_high_u8( bytes ) );
+  max = vpmax_u8( max, max );
+  max = vpmax_u8( max, max );
+  max = vpmax_u8( max, max );
+  return vget_lane_u8( max, 0 );
+#endif
+}
+
+/**
+ * @brief Retrieves a mask with a bit set for each byte of a NEON comparison result which is set, like _mm_movemask_epi8().
+ */
+inline uint32_t MoveMask( const uint8x16_t bytes )
+{
+  static const uint8_t BIT_WEIGHTS[BLOCK_SIZE] = { 1u, 2u, 4u, 8u, 16u, 32u, 64u, 128u, 1u, 2u, 4u, 8u, 16u, 32u, 64u, 128u };
+
+  // Add the weights of each half with pairwise additions.
+  const uint8x16_t bits = vandq_u8( bytes, vld1q_u8( BIT_WEIGHTS ) );
+  uint8x8_t sum = vpadd_u8( vget_low_u8( bits ), vget_high_u8( bits ) );
+  sum = vpadd_u8( sum, sum );
+  sum = vpadd_u8( sum, sum );
+  return static_cast<uint32_t>( vget_lane_u8( sum, 0 ) ) | ( static_cast<uint32_t>( vget_lane_u8( sum, 1 ) ) << 8u );
+}
+#endif
+
+/**
+ * @brief Whether all the bytes of a block are ASCII characters.
+ *
+ * @param[in] utf8 Pointer to a block of BLOCK_SIZE bytes.
+ *
+ * @return @e true if none of the bytes has the most significant bit set.
+ */
+inline bool IsAsciiBlock( const uint8_t* const utf8 )
+{
+#if defined(__SSE2__)
+  const __m128i block = _mm_loadu_si128( reinterpret_cast<const __m128i*>( utf8 ) );
+  return 0 == _mm_movemask_epi8( block );
+#elif defined(__ARM_NEON__) || defined(__ARM_NEON)
+  return MaxByte( vld1q_u8( utf8 ) ) < 0x80u;
+#else
+  uint8_t bits = 0u;
+  for( uint32_t index = 0u; index < BLOCK_SIZE; ++index )
+  {
+    bits |= utf8[index];
+  }
+  return bits < 0x80u;
+#endif
+}
+
+/**
+ * @brief Retrieves the number of bytes of a block of ASCII characters converted once its CR have been replaced by LF.
+ *
+ * The LF of a CR+LF pair is skipped, so the block is only converted up to the CR of the first pair.
+ *
+ * @param[in] utf8 Pointer to the block.
+ * @param[in] end Pointer to the end of the text, the byte after a CR at the end of the block may be a LF.
+ * @param[in] carriageReturns The mask of the CR of the block.
+ * @param[in] lineFeeds The mask of the LF of the block.
+ * @param[out] numberOfCharacters The number of characters converted.
+ *
+ * @return The number of bytes converted.
+ */
+inline uint32_t GetConvertedAsciiLength( const uint8_t* const utf8, const uint8_t* const end, uint32_t carriageReturns, uint32_t lineFeeds, uint32_t& numberOfCharacters )
+{
+  const uint32_t lastByte = 1u << ( BLOCK_SIZE - 1u );
+
+  uint32_t pairs = carriageReturns & ( lineFeeds >> 1u );
+  if( ( 0u != ( carriageReturns & lastByte ) ) && ( utf8 + BLOCK_SIZE < end ) && ( LF == utf8[BLOCK_SIZE] ) )
+  {
+    pairs |= lastByte;
+  }
+
+  if( 0u == pairs )
+  {
+    numberOfCharacters = BLOCK_SIZE;
+    return BLOCK_SIZE;
+  }
+
+  uint32_t index = 0u;
+  while( 0u == ( pairs & ( 1u << index ) ) )
+  {
+    ++index;
+  }
+
+  numberOfCharacters = index + 1u;
+  return index + 2u;
+}
+
+/**
+ * @brief Converts a block of ASCII characters to UTF32.
+ *
+ * The CR are replaced by LF. The block is converted up to the first CR+LF pair, which is replaced by a LF.
+ * The @p utf32 buffer must have room for BLOCK_SIZE characters.
+ *
+ * @param[in] utf8 Pointer to a block of BLOCK_SIZE bytes.
+ * @param[in] end Pointer to the end of the text.
+ * @param[out] utf32 Pointer to the converted characters.
+ * @param[out] numberOfCharacters The number of characters converted.
+ *
+ * @return The number of bytes converted, zero if the block has a non ASCII character.
+ */
+inline uint32_t AsciiBlockToUtf32( const uint8_t* const utf8, const uint8_t* const end, uint32_t* utf32, uint32_t& numberOfCharacters )
+{
+  uint32_t carriageReturns = 0u;
+  uint32_t lineFeeds = 0u;
+
+#if defined(__SSE2__)
+  __m128i block = _mm_loadu_si128( reinterpret_cast<const __m128i*>( utf8 ) );
+  if( 0 != _mm_movemask_epi8( block ) )
+  {
+    return 0u;
+  }
+
+  const __m128i carriageReturnBytes = _mm_cmpeq_epi8( block, _mm_set1_epi8( CR ) );
+  carriageReturns = _mm_movemask_epi8( carriageReturnBytes );
+  if( 0u != carriageReturns )
+  {
+    lineFeeds = _mm_movemask_epi8( _mm_cmpeq_epi8( block, _mm_set1_epi8( LF ) ) );
+    block = _mm_xor_si128( block, _mm_and_si128( carriageReturnBytes, _mm_set1_epi8( CR ^ LF ) ) );
+  }
+
+  // Widen the bytes to 32 bits interleaving zeros.
+  const __m128i zero = _mm_setzero_si128();
+  const __m128i low = _mm_unpacklo_epi8( block, zero );
+  const __m128i high = _mm_unpackhi_epi8( block, zero );
+
+  __m128i* output = reinterpret_cast<__m128i*>( utf32 );
+  _mm_storeu_si128( output,      _mm_unpacklo_epi16( low, zero ) );
+  _mm_storeu_si128( output + 1u, _mm_unpackhi_epi16( low, zero ) );
+  _mm_storeu_si128( output + 2u, _mm_unpacklo_epi16( high, zero ) );
+  _mm_storeu_si128( output + 3u, _mm_unpackhi_epi16( high, zero ) );
+#elif defined(__ARM_NEON__) || defined(__ARM_NEON)
+  uint8x16_t block = vld1q_u8( utf8 );
+  if( MaxByte( block ) >= 0x80u )
+  {
+    return 0u;
+  }
+
+  const uint8x16_t carriageReturnBytes = vceqq_u8( block, vdupq_n_u8( CR ) );
+  carriageReturns = MoveMask( carriageReturnBytes );
+  if( 0u != carriageReturns )
+  {
+    lineFeeds = MoveMask( vceqq_u8( block, vdupq_n_u8( LF ) ) );
+    block = veorq_u8( block, vandq_u8( carriageReturnBytes, vdupq_n_u8( CR ^ LF ) ) );
+  }
+
+  const uint16x8_t low = vmovl_u8( vget_low_u8( block ) );
+  const uint16x8_t high = vmovl_u8( vget_high_u8( block ) );
+
+  vst1q_u32( utf32,       vmovl_u16( vget_low_u16( low ) ) );
+  vst1q_u32( utf32 + 4u,  vmovl_u16( vget_high_u16( low ) ) );
+  vst1q_u32( utf32 + 8u,  vmovl_u16( vget_low_u16( high ) ) );
+  vst1q_u32( utf32 + 12u, vmovl_u16( vget_high_u16( high ) ) );
+#else
+  if( !IsAsciiBlock( utf8 ) )
+  {
+    return 0u;
+  }
+
+  for( uint32_t index = 0u; index < BLOCK_SIZE; ++index )
+  {
+    const uint8_t byte = utf8[index];
+    if( CR == byte )
+    {
+      carriageReturns |= 1u << index;
+      utf32[index] = LF;
+    }
+    else
+    {
+      if( LF == byte )
+      {
+        lineFeeds |= 1u << index;
+      }
+      utf32[index] = byte;
+    }
+  }
+#endif
+
+  return GetConvertedAsciiLength( utf8, end, carriageReturns, lineFeeds, numberOfCharacters );
+}
+
+/**
+ * @brief Converts a block of eight 2 bytes sequences to UTF32.
+ *
+ * @param[in] utf8 Pointer to a block of BLOCK_SIZE bytes.
+ * @param[out] utf32 Pointer to a buffer of BLOCK_SIZE / 2 characters.
+ *
+ * @return @e true if the block has been converted, i.e. all its sequences are 2 bytes long with valid continuation bytes.
+ */
+inline bool TwoByteBlockToUtf32( const uint8_t* const utf8, uint32_t* utf32 )
+{
+#if defined(__SSE2__)
+  // Each 16 bits lane has a lead byte in its low byte and a continuation byte in its high byte.
+  const __m128i block = _mm_loadu_si128( reinterpret_cast<const __m128i*>( utf8 ) );
+  const __m128i valid = _mm_cmpeq_epi16( _mm_and_si128( block, _mm_set1_epi16( static_cast<short>( 0xc0e0 ) ) ),
+                                         _mm_set1_epi16( static_cast<short>( 0x80c0 ) ) );
+  if( 0xffff != _mm_movemask_epi8( valid ) )
+  {
+    return false;
+  }
+
+  const __m128i codes = _mm_or_si128( _mm_slli_epi16( _mm_and_si128( block, _mm_set1_epi16( 0x1f ) ), 6 ),
+                                      _mm_and_si128( _mm_srli_epi16( block, 8 ), _mm_set1_epi16( 0x3f ) ) );
+
+  const __m128i zero = _mm_setzero_si128();
+  __m128i* output = reinterpret_cast<__m128i*>( utf32 );
+  _mm_storeu_si128( output,      _mm_unpacklo_epi16( codes, zero ) );
+  _mm_storeu_si128( output + 1u, _mm_unpackhi_epi16( codes, zero ) );
+
+  return true;
+#elif defined(__ARM_NEON__) || defined(__ARM_NEON)
+  // Each 16 bits lane has a lead byte in its low byte and a continuation byte in its high byte.
+  const uint16x8_t block = vreinterpretq_u16_u8( vld1q_u8( utf8 ) );
+  const uint16x8_t valid = vceqq_u16( vandq_u16( block, vdupq_n_u16( 0xc0e0u ) ), vdupq_n_u16( 0x80c0u ) );
+  if( 0xffffu != MoveMask( vreinterpretq_u8_u16( valid ) ) )
+  {
+    return false;
+  }
+
+  const uint16x8_t codes = vorrq_u16( vshlq_n_u16( vandq_u16( block, vdupq_n_u16( 0x1fu ) ), 6 ),
+                                      vandq_u16( vshrq_n_u16( block, 8 ), vdupq_n_u16( 0x3fu ) ) );
+
+  vst1q_u32( utf32,      vmovl_u16( vget_low_u16( codes ) ) );
+  vst1q_u32( utf32 + 4u, vmovl_u16( vget_high_u16( codes ) ) );
+
+  return true;
+#else
+  for( uint32_t index = 0u; index < BLOCK_SIZE; index += 2u )
+  {
+    if( ( 0xc0u != ( utf8[index] & 0xe0u ) ) || ( 0x80u != ( utf8[index + 1u] & 0xc0u ) ) )
+    {
+      return false;
+    }
+  }
+
+  for( uint32_t index = 0u; index < BLOCK_SIZE; index += 2u )
+  {
+    *utf32++ = ( static_cast<uint32_t>( utf8[index] & 0x1fu ) << 6u ) | ( utf8[index + 1u] & 0x3fu );
+  }
+
+  return true;
+#endif
+}
+
+/**
+ * @brief Converts the four 3 bytes sequences at the start of a block to UTF32.
+ *
+ * @param[in] utf8 Pointer to a block of BLOCK_SIZE bytes. Only the first twelve are converted.
+ * @param[out] utf32 Pointer to a buffer of four characters.
+ *
+ * @return @e true if the sequences have been converted, i.e. they are all 3 bytes long with valid continuation bytes.
+ */
+inline bool ThreeByteBlockToUtf32( const uint8_t* const utf8, uint32_t* utf32 )
+{
+#if defined(__SSE2__)
+  // SSE2 has no byte shuffle. Each sequence is moved to its 32 bits lane with a byte shift, and the other bytes are masked out.
+  const __m128i block = _mm_loadu_si128( reinterpret_cast<const __m128i*>( utf8 ) );
+  const __m128i lanes = _mm_or_si128( _mm_or_si128( _mm_and_si128( block, _mm_set_epi32( 0, 0, 0, 0x00ffffff ) ),
+                                                    _mm_and_si128( _mm_slli_si128( block, 1 ), _mm_set_epi32( 0, 0, 0x00ffffff, 0 ) ) ),
+                                      _mm_or_si128( _mm_and_si128( _mm_slli_si128( block, 2 ), _mm_set_epi32( 0, 0x00ffffff, 0, 0 ) ),
+                                                    _mm_and_si128( _mm_slli_si128( block, 3 ), _mm_set_epi32( 0x00ffffff, 0, 0, 0 ) ) ) );
+
+  const __m128i valid = _mm_cmpeq_epi32( _mm_and_si128( lanes, _mm_set1_epi32( 0x00c0c0f0 ) ), _mm_set1_epi32( 0x008080e0 ) );
+  if( 0xffff != _mm_movemask_epi8( valid ) )
+  {
+    return false;
+  }
+
+  const __m128i codes = _mm_or_si128( _mm_or_si128( _mm_slli_epi32( _mm_and_si128( lanes, _mm_set1_epi32( 0x0f ) ), 12 ),
+                                                    _mm_srli_epi32( _mm_and_si128( lanes, _mm_set1_epi32( 0x3f00 ) ), 2 ) ),
+                                      _mm_srli_epi32( _mm_and_si128( lanes, _mm_set1_epi32( 0x3f0000 ) ), 16 ) );
+
+  _mm_storeu_si128( reinterpret_cast<__m128i*>( utf32 ), codes );
+
+  return true;
+#elif defined(__ARM_NEON__) || defined(__ARM_NEON)
+  // Move each sequence to its 32 bits lane with a table lookup. The out of range indices give zeros.
+  static const uint8_t THREE_BYTE_LANES[BLOCK_SIZE] = { 0u, 1u, 2u, 0xffu, 3u, 4u, 5u, 0xffu, 6u, 7u, 8u, 0xffu, 9u, 10u, 11u, 0xffu };
+
+  const uint8x16_t block = vld1q_u8( utf8 );
+  uint8x8x2_t table;
+  table.val[0] = vget_low_u8( block );
+  table.val[1] = vget_high_u8( block );
+  const uint32x4_t lanes = vreinterpretq_u32_u8( vcombine_u8( vtbl2_u8( table, vld1_u8( THREE_BYTE_LANES ) ),
+                                                              vtbl2_u8( table, vld1_u8( THREE_BYTE_LANES + 8u ) ) ) );
+
+  const uint32x4_t valid = vceqq_u32( vandq_u32( lanes, vdupq_n_u32( 0x00c0c0f0u ) ), vdupq_n_u32( 0x008080e0u ) );
+  if( 0xffffu != MoveMask( vreinterpretq_u8_u32( valid ) ) )
+  {
+    return false;
+  }
+
+  const uint32x4_t codes = vorrq_u32( vorrq_u32( vshlq_n_u32( vandq_u32( lanes, vdupq_n_u32( 0x0fu ) ), 12 ),
+                                                 vshrq_n_u32( vandq_u32( lanes, vdupq_n_u32( 0x3f00u ) ), 2 ) ),
+                                      vshrq_n_u32( vandq_u32( lanes, vdupq_n_u32( 0x3f0000u ) ), 16 ) );
+
+  vst1q_u32( utf32, codes );
+
+  return true;
+#else
+  for( uint32_t index = 0u; index < 12u; index += 3u )
+  {
+    if( ( 0xe0u != ( utf8[index] & 0xf0u ) ) || ( 0x80u != ( utf8[index + 1u] & 0xc0u ) ) || ( 0x80u != ( utf8[index + 2u] & 0xc0u ) ) )
+    {
+      return false;
+    }
+  }
+
+  for( uint32_t index = 0u; index < 12u; index += 3u )
+  {
+    *utf32++ = ( static_cast<uint32_t>( utf8[index] & 0x0fu ) << 12u ) | ( static_cast<uint32_t>( utf8[index + 1u] & 0x3fu ) << 6u ) | ( utf8[index + 2u] & 0x3fu );
+  }
+
+  return true;
+#endif
+}
+
+/**
+ * @brief Converts a block of four 4 bytes sequences to UTF32.
+ *
+ * @param[in] utf8 Pointer to a block of BLOCK_SIZE bytes.
+ * @param[out] utf32 Pointer to a buffer of four characters.
+ *
+ * @return @e true if the block has been converted, i.e. all its sequences are 4 bytes long with valid continuation bytes.
+ */
+inline bool FourByteBlockToUtf32( const uint8_t* const utf8, uint32_t* utf32 )
+{
+#if defined(__SSE2__)
+  // Each 32 bits lane has a lead byte in its low byte and the continuation bytes above.
+  const __m128i lanes = _mm_loadu_si128( reinterpret_cast<const __m128i*>( utf8 ) );
+  const __m128i valid = _mm_cmpeq_epi32( _mm_and_si128( lanes, _mm_set1_epi32( static_cast<int>( 0xc0c0c0f8 ) ) ),
+                                         _mm_set1_epi32( static_cast<int>( 0x808080f0 ) ) );
+  if( 0xffff != _mm_movemask_epi8( valid ) )
+  {
+    return false;
+  }
+
+  const __m128i codes = _mm_or_si128( _mm_or_si128( _mm_slli_epi32( _mm_and_si128( lanes, _mm_set1_epi32( 0x07 ) ), 18 ),
+                                                    _mm_slli_epi32( _mm_and_si128( lanes, _mm_set1_epi32( 0x3f00 ) ), 4 ) ),
+                                      _mm_or_si128( _mm_srli_epi32( _mm_and_si128( lanes, _mm_set1_epi32( 0x3f0000 ) ), 10 ),
+                                                    _mm_and_si128( _mm_srli_epi32( lanes, 24 ), _mm_set1_epi32( 0x3f ) ) ) );
+
+  _mm_storeu_si128( reinterpret_cast<__m128i*>( utf32 ), codes );
+
+  return true;
+#elif defined(__ARM_NEON__) || defined(__ARM_NEON)
+  // Each 32 bits lane has a lead byte in its low byte and the continuation bytes above.
+  const uint32x4_t lanes = vreinterpretq_u32_u8( vld1q_u8( utf8 ) );
+  const uint32x4_t valid = vceqq_u32( vandq_u32( lanes, vdupq_n_u32( 0xc0c0c0f8u ) ), vdupq_n_u32( 0x808080f0u ) );
+  if( 0xffffu != MoveMask( vreinterpretq_u8_u32( valid ) ) )
+  {
+    return false;
+  }
+
+  const uint32x4_t codes = vorrq_u32( vorrq_u32( vshlq_n_u32( vandq_u32( lanes, vdupq_n_u32( 0x07u ) ), 18 ),
+                                                 vshlq_n_u32( vandq_u32( lanes, vdupq_n_u32( 0x3f00u ) ), 4 ) ),
+                                      vorrq_u32( vshrq_n_u32( vandq_u32( lanes, vdupq_n_u32( 0x3f0000u ) ), 10 ),
+                                                 vandq_u32( vshrq_n_u32( lanes, 24 ), vdupq_n_u32( 0x3fu ) ) ) );
+
+  vst1q_u32( utf32, codes );
+
+  return true;
+#else
+  for( uint32_t index = 0u; index < BLOCK_SIZE; index += 4u )
+  {
+    if( ( 0xf0u != ( utf8[index] & 0xf8u ) ) ||
+        ( 0x80u != ( utf8[index + 1u] & 0xc0u ) ) || ( 0x80u != ( utf8[index + 2u] & 0xc0u ) ) || ( 0x80u != ( utf8[index + 3u] & 0xc0u ) ) )
+    {
+      return false;
+    }
+  }
+
+  for( uint32_t index = 0u; index < BLOCK_SIZE; index += 4u )
+  {
+    *utf32++ = ( static_cast<uint32_t>( utf8[index] & 0x07u ) << 18u ) | ( static_cast<uint32_t>( utf8[index + 1u] & 0x3fu ) << 12u ) |
+               ( static_cast<uint32_t>( utf8[index + 2u] & 0x3fu ) << 6u ) | ( utf8[index + 3u] & 0x3fu );
+  }
+
+  return true;
+#endif
+}
+
+/**
+ * @brief Converts the block of characters at the given position if they all have the same number of bytes.
+ *
+ * @param[in,out] begin Pointer to the block, moved past the bytes converted.
+ * @param[in] end Pointer to the end of the text. There must be BLOCK_SIZE bytes or more from @p begin.
+ * @param[in,out] utf32 Pointer to the converted characters, moved past the characters converted.
+ *
+ * @return @e true if the block has been converted.
+ */
+inline bool BlockToUtf32( const uint8_t*& begin, const uint8_t* const end, uint32_t*& utf32 )
+{
+  uint32_t numberOfBytes = 0u;
+  uint32_t numberOfCharacters = 0u;
+
+  switch( UTF8_LENGTH[*begin] )
+  {
+    case U1:
+    {
+      numberOfBytes = AsciiBlockToUtf32( begin, end, utf32, numberOfCharacters );
+      break;
+    }
+    case U2:
+    {
+      if( TwoByteBlockToUtf32( begin, utf32 ) )
+      {
+        numberOfBytes = BLOCK_SIZE;
+        numberOfCharacters = BLOCK_SIZE / U2;
+      }
+      break;
+    }
+    case U3:
+    {
+      if( ThreeByteBlockToUtf32( begin, utf32 ) )
+      {
+        numberOfBytes = 12u;
+        numberOfCharacters = 4u;
+      }
+      break;
+    }
+    case U4:
+    {
+      if( FourByteBlockToUtf32( begin, utf32 ) )
+      {
+        numberOfBytes = BLOCK_SIZE;
+        numberOfCharacters = BLOCK_SIZE / U4;
+      }
+      break;
+    }
+  }
+
+  begin += numberOfBytes;
+  utf32 += numberOfCharacters;
+
+  return 0u != numberOfBytes;
+}
+
+/**
+ * @brief Retrieves the number of bytes of the character at the given position, and whether it's a valid sequence.
+ *
+ * A non valid lead byte, or a lead byte followed by a byte which is not a continuation byte, is one byte long.
+ * The decoding resumes from the next byte. A sequence truncated by the end of the text is as long as the bytes left.
+ *
+ * @param[in] begin Pointer to the lead byte.
+ * @param[in] end Pointer to the end of the text.
+ * @param[out] isValid Whether the sequence is valid. The non valid ones are replaced by the replacement character.
+ *
+ * @return The number of bytes of the character.
+ */
+inline uint32_t GetSequenceLength( const uint8_t* const begin, const uint8_t* const end, bool& isValid )
+{
+  const uint8_t utf8Length = UTF8_LENGTH[*begin];
+  if( U0 == utf8Length )
+  {
+    isValid = false;
+    return U1;
+  }
+
+  const uint32_t numberOfBytes = ( end - begin < utf8Length ) ? static_cast<uint32_t>( end - begin ) : utf8Length;
+  for( uint32_t index = 1u; index < numberOfBytes; ++index )
+  {
+    if( 0x80u != ( begin[index] & 0xc0u ) )
+    {
+      isValid = false;
+      return U1;
+    }
+  }
+
+  isValid = ( numberOfBytes == utf8Length );
+  return numberOfBytes;
+}
+
 } // namespace
 
 uint8_t GetUtf8Length( uint8_t utf8LeadByte )
@@ -86,7 +583,21 @@ uint32_t GetNumberOfUtf8Characters( const uint8_t* const utf8, uint32_t length )
   const uint8_t* begin = utf8;
   const uint8_t* end = utf8 + length;
 
-  for( ; begin < end ; begin += UTF8_LENGTH[*begin], ++numberOfCharacters );
+  while( begin < end )
+  {
+    // Count whole blocks of ASCII characters at once.
+    if( ( end - begin >= static_cast<int>( BLOCK_SIZE ) ) && IsAsciiBlock( begin ) )
+    {
+      begin += BLOCK_SIZE;
+      numberOfCharacters += BLOCK_SIZE;
+      continue;
+    }
+
+    // A non valid sequence is counted as one character, the same way it's replaced when converted.
+    bool isValid = false;
+    begin += GetSequenceLength( begin, end, isValid );
+    ++numberOfCharacters;
+  }
 
   return numberOfCharacters;
 }
@@ -125,16 +636,33 @@ uint32_t GetNumberOfUtf8Bytes( const uint32_t* const utf32, uint32_t numberOfCha
 
 uint32_t Utf8ToUtf32( const uint8_t* const utf8, uint32_t length, uint32_t* utf32 )
 {
-  uint32_t numberOfCharacters = 0u;
+  const uint32_t* const utf32Begin = utf32;
 
   const uint8_t* begin = utf8;
   const uint8_t* end = utf8 + length;
 
-  for( ; begin < end ; ++numberOfCharacters )
+  while( begin < end )
   {
+    // Convert whole blocks of characters with the same number of bytes at once.
+    if( ( end - begin >= static_cast<int>( BLOCK_SIZE ) ) && BlockToUtf32( begin, end, utf32 ) )
+    {
+      continue;
+    }
+
     const uint8_t leadByte = *begin;
 
-    switch( UTF8_LENGTH[leadByte] )
+    bool isValid = false;
+    const uint32_t numberOfBytes = GetSequenceLength( begin, end, isValid );
+
+    if( !isValid )
+    {
+      // Non valid lead byte, non valid continuation byte or truncated sequence at the end of the buffer.
+      *utf32++ = REPLACEMENT_CHARACTER;
+      begin += numberOfBytes;
+      continue;
+    }
+
+    switch( numberOfBytes )
     {
       case U1:
       {
@@ -199,7 +727,7 @@ uint32_t Utf8ToUtf32( const uint8_t* const utf8, uint32_t length, uint32_t* utf3
     }
   }
 
-  return numberOfCharacters;
+  return static_cast<uint32_t>( utf32 - utf32Begin );
 }
 
 uint32_t Utf32ToUtf8( const uint32_t* const utf32, uint32_t numberOfCharacters, uint8_t* utf8 )
@@ -67,6 +67,8 @@ uint32_t GetNumberOfUtf8Bytes( const uint32_t* const utf32, uint32_t numberOfCha
  *
  * If the text contains a single 'CR' character or a pair 'CR'+'LF', they are replaced by a 'LF'.
  *
+ * Non valid lead bytes and a truncated sequence at the end of the array are replaced by the U+FFFD replacement character.
+ *
  * @note GetNumberOfUtf8Characters() does not convert 'CR' or 'CR'+'LF' to 'LF' so the return number
  * of characters of that method may be higher than the number of characters returned by this one.
  *
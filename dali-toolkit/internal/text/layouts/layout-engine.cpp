@@ -19,7 +19,10 @@
 #include <dali-toolkit/internal/text/layouts/layout-engine.h>
 
 // EXTERNAL INCLUDES
+#include <algorithm>
+#include <cstring>
 #include <limits>
+#include <dali/public-api/math/math-utils.h>
 #include <dali/integration-api/debug.h>
 #include <dali/devel-api/text-abstraction/font-client.h>
 
@@ -50,8 +53,116 @@ const bool RTL = true;
 const float CURSOR_WIDTH = 1.f;
 const float LINE_SPACING= 0.f;
 
+/**
+ * @brief Combines a value into a hash.
+ *
+ * @param[in] hash The current hash.
+ * @param[in] value The value to combine.
+ *
+ * @return The new hash.
+ */
+uint64_t HashCombine( uint64_t hash, uint32_t value )
+{
+  hash ^= static_cast<uint64_t>( value ) + 0x9e3779b97f4a7c15ull + ( hash << 6u ) + ( hash >> 2u );
+  return hash;
+}
+
+/**
+ * @brief Combines a float value into a hash.
+ *
+ * @param[in] hash The current hash.
+ * @param[in] value The value to combine.
+ *
+ * @return The new hash.
+ */
+uint64_t HashCombine( uint64_t hash, float value )
+{
+  uint32_t bits = 0u;
+  memcpy( &bits, &value, sizeof( uint32_t ) );
+  return HashCombine( hash, bits );
+}
+
 } //namespace
 
+/**
+ * @brief The lines and glyph positions of a paragraph laid-out by a previous layout.
+ *
+ * The indices of the lines are relative to the first glyph and character of the paragraph.
+ */
+struct ParagraphLayout
+{
+  ParagraphLayout()
+  : hash( 0u ),
+    numberOfGlyphs( 0u ),
+    numberOfCharacters( 0u ),
+    lineIndex( 0u ),
+    numberOfLines( 0u ),
+    glyphPositionIndex( 0u ),
+    characterIndex( 0u ),
+    direction( false )
+  {}
+
+  bool operator<( const ParagraphLayout& rhs ) const
+  {
+    return hash < rhs.hash;
+  }
+
+  uint64_t   hash;               ///< Hash of the glyphs, characters and break info of the paragraph.
+  Length     numberOfGlyphs;     ///< The number of glyphs of the paragraph.
+  Length     numberOfCharacters; ///< The number of characters of the paragraph.
+  LineIndex  lineIndex;          ///< Index to the first line of the paragraph within the cached lines.
+  Length     numberOfLines;      ///< The number of lines of the paragraph.
+  GlyphIndex glyphPositionIndex; ///< Index to the first glyph position of the paragraph within the cached positions and glyphs.
+  CharacterIndex characterIndex; ///< Index to the first character of the paragraph within the cached characters.
+  CharacterDirection direction;  ///< The direction of the paragraph.
+};
+
+/**
+ * @brief Caches the layout of the paragraphs of the last complete layout.
+ *
+ * The line breaks of a paragraph only depend on its own glyphs and the width of the box.
+ * A paragraph found in the cache is copied instead of being laid-out again, i.e. when only
+ * the height of the box changes, or when the size is calculated before the text is laid-out.
+ */
+struct ParagraphLayoutCache
+{
+  ParagraphLayoutCache()
+  : width( 0.f ),
+    cursorWidth( 0.f )
+  {}
+
+  void Swap( ParagraphLayoutCache& cache )
+  {
+    paragraphs.Swap( cache.paragraphs );
+    lines.Swap( cache.lines );
+    glyphPositions.Swap( cache.glyphPositions );
+    glyphs.Swap( cache.glyphs );
+    glyphsToCharacters.Swap( cache.glyphsToCharacters );
+    charactersPerGlyph.Swap( cache.charactersPerGlyph );
+    characters.Swap( cache.characters );
+    lineBreakInfo.Swap( cache.lineBreakInfo );
+    wordBreakInfo.Swap( cache.wordBreakInfo );
+    characterDirections.Swap( cache.characterDirections );
+    std::swap( width, cache.width );
+    std::swap( cursorWidth, cache.cursorWidth );
+  }
+
+  Vector<ParagraphLayout> paragraphs;     ///< The cached paragraphs, sorted by hash.
+  Vector<LineRun>         lines;          ///< The lines of the cached paragraphs.
+  Vector<Vector2>         glyphPositions; ///< The glyph positions of the cached paragraphs.
+
+  // The input of the layout of the cached paragraphs, compared when the hash matches.
+  Vector<GlyphInfo>          glyphs;              ///< The glyphs of the cached paragraphs.
+  Vector<CharacterIndex>     glyphsToCharacters;  ///< The first character of each glyph, relative to its paragraph.
+  Vector<Length>             charactersPerGlyph;  ///< The number of characters of each glyph.
+  Vector<Character>          characters;          ///< The characters of the cached paragraphs.
+  Vector<LineBreakInfo>      lineBreakInfo;       ///< The line break info of the characters.
+  Vector<WordBreakInfo>      wordBreakInfo;       ///< The word break info of the characters.
+  Vector<CharacterDirection> characterDirections; ///< The direction of the characters. Left to right if the text has no directions.
+  float                   width;          ///< The width of the box used to lay out the paragraphs.
+  float                   cursorWidth;    ///< The width of the cursor used to lay out the paragraphs.
+};
+
 /**
  * @brief Stores temporary layout info of the line.
  */
@@ -606,6 +717,33 @@ struct LayoutEngine::Impl
     return ellipsis;
   }
 
+  /**
+   * @brief Calculates the width of a laid-out line.
+   *
+   * @param[in] layoutParameters The parameters needed to layout the text.
+   * @param[in] layout The line layout.
+   * @param[in] isLastLine Whether the laid-out line is the last one.
+   *
+   * @return The width of the line.
+   */
+  float CalculateLineWidth( const LayoutParameters& layoutParameters,
+                            const LineLayout& layout,
+                            bool isLastLine )
+  {
+    if( isLastLine && !layoutParameters.isLastNewParagraph )
+    {
+      const float width = layout.extraBearing + layout.length + layout.extraWidth + layout.wsLengthEndOfLine;
+      if( MULTI_LINE_BOX == mLayout )
+      {
+        return ( width > layoutParameters.boundingBox.width ) ? layoutParameters.boundingBox.width : width;
+      }
+
+      return width;
+    }
+
+    return layout.extraBearing + layout.length + layout.extraWidth;
+  }
+
   /**
    * @brief Updates the text layout with a new laid-out line.
    *
@@ -632,23 +770,13 @@ struct LayoutEngine::Impl
     lineRun.glyphRun.numberOfGlyphs = layout.numberOfGlyphs;
     lineRun.characterRun.characterIndex = layout.characterIndex;
     lineRun.characterRun.numberOfCharacters = layout.numberOfCharacters;
+    lineRun.width = CalculateLineWidth( layoutParameters, layout, isLastLine );
     if( isLastLine && !layoutParameters.isLastNewParagraph )
     {
-      const float width = layout.extraBearing + layout.length + layout.extraWidth + layout.wsLengthEndOfLine;
-      if( MULTI_LINE_BOX == mLayout )
-      {
-        lineRun.width = ( width > layoutParameters.boundingBox.width ) ? layoutParameters.boundingBox.width : width;
-      }
-      else
-      {
-        lineRun.width = width;
-      }
-
       lineRun.extraLength = 0.f;
     }
     else
     {
-      lineRun.width = layout.extraBearing + layout.length + layout.extraWidth;
       lineRun.extraLength = ( layout.wsLengthEndOfLine > 0.f ) ? layout.wsLengthEndOfLine - layout.extraWidth : 0.f;
     }
     lineRun.ascender = layout.ascender;
@@ -760,6 +888,379 @@ struct LayoutEngine::Impl
     }
   }
 
+  /**
+   * @brief Retrieves the glyphs and characters of the paragraph starting at the given glyph.
+   *
+   * @param[in] layoutParameters The parameters needed to layout the text.
+   * @param[in] glyphIndex The first glyph of the paragraph.
+   * @param[in] lastGlyphPlusOne Index to the glyph after the last one to be laid-out.
+   * @param[out] paragraphEndGlyphIndex Index to the glyph after the last one of the paragraph.
+   * @param[out] numberOfCharacters The number of characters of the paragraph.
+   *
+   * @return Whether the layout of the paragraph can be cached. The last paragraph of the text is never cached.
+   */
+  bool GetParagraph( const LayoutParameters& layoutParameters,
+                     GlyphIndex glyphIndex,
+                     GlyphIndex lastGlyphPlusOne,
+                     GlyphIndex& paragraphEndGlyphIndex,
+                     Length& numberOfCharacters )
+  {
+    // Stops looking for paragraphs if the layout of this one can't be cached.
+    paragraphEndGlyphIndex = lastGlyphPlusOne;
+    numberOfCharacters = 0u;
+
+    const GlyphIndex lastGlyphIndex = layoutParameters.totalNumberOfGlyphs - 1u;
+    const Length totalNumberOfCharacters = *( layoutParameters.glyphsToCharactersBuffer + lastGlyphIndex ) + *( layoutParameters.charactersPerGlyphBuffer + lastGlyphIndex );
+    const CharacterIndex characterIndex = *( layoutParameters.glyphsToCharactersBuffer + glyphIndex );
+
+    // Find the new paragraph character.
+    CharacterIndex lastCharacterIndex = characterIndex;
+    while( ( lastCharacterIndex < totalNumberOfCharacters ) &&
+           ( TextAbstraction::LINE_MUST_BREAK != *( layoutParameters.lineBreakInfoBuffer + lastCharacterIndex ) ) )
+    {
+      ++lastCharacterIndex;
+    }
+
+    if( lastCharacterIndex >= totalNumberOfCharacters )
+    {
+      return false;
+    }
+
+    const GlyphIndex endGlyphIndex = *( layoutParameters.charactersToGlyphsBuffer + lastCharacterIndex ) + *( layoutParameters.glyphsPerCharacterBuffer + lastCharacterIndex );
+
+    if( ( endGlyphIndex <= glyphIndex ) ||
+        ( endGlyphIndex > lastGlyphPlusOne ) ||
+        ( endGlyphIndex >= layoutParameters.totalNumberOfGlyphs ) ||
+        ( *( layoutParameters.glyphsToCharactersBuffer + endGlyphIndex - 1u ) + *( layoutParameters.charactersPerGlyphBuffer + endGlyphIndex - 1u ) != lastCharacterIndex + 1u ) )
+    {
+      // Either is the last paragraph or the last glyph doesn't end with the new paragraph character.
+      return false;
+    }
+
+    paragraphEndGlyphIndex = endGlyphIndex;
+    numberOfCharacters = 1u + lastCharacterIndex - characterIndex;
+
+    return true;
+  }
+
+  /**
+   * @brief Calculates a hash of all the data used to lay out a paragraph.
+   *
+   * @param[in] layoutParameters The parameters needed to layout the text.
+   * @param[in] glyphIndex The first glyph of the paragraph.
+   * @param[in] numberOfGlyphs The number of glyphs of the paragraph.
+   * @param[in] characterIndex The first character of the paragraph.
+   * @param[in] numberOfCharacters The number of characters of the paragraph.
+   * @param[in] paragraphDirection The direction of the paragraph.
+   *
+   * @return The hash.
+   */
+  uint64_t HashParagraph( const LayoutParameters& layoutParameters,
+                          GlyphIndex glyphIndex,
+                          Length numberOfGlyphs,
+                          CharacterIndex characterIndex,
+                          Length numberOfCharacters,
+                          CharacterDirection paragraphDirection )
+  {
+    uint64_t hash = HashCombine( 0u, static_cast<uint32_t>( paragraphDirection ) );
+
+    for( GlyphIndex index = glyphIndex, endIndex = glyphIndex + numberOfGlyphs; index < endIndex; ++index )
+    {
+      const GlyphInfo& glyph = *( layoutParameters.glyphsBuffer + index );
+
+      hash = HashCombine( hash, glyph.fontId );
+      hash = HashCombine( hash, glyph.width );
+      hash = HashCombine( hash, glyph.advance );
+      hash = HashCombine( hash, glyph.xBearing );
+      hash = HashCombine( hash, glyph.yBearing );
+      hash = HashCombine( hash, *( layoutParameters.glyphsToCharactersBuffer + index ) - characterIndex );
+      hash = HashCombine( hash, *( layoutParameters.charactersPerGlyphBuffer + index ) );
+    }
+
+    for( CharacterIndex index = characterIndex, endIndex = characterIndex + numberOfCharacters; index < endIndex; ++index )
+    {
+      hash = HashCombine( hash, *( layoutParameters.textBuffer + index ) );
+      hash = HashCombine( hash, static_cast<uint32_t>( *( layoutParameters.lineBreakInfoBuffer + index ) ) );
+      hash = HashCombine( hash, static_cast<uint32_t>( *( layoutParameters.wordBreakInfoBuffer + index ) ) );
+
+      if( NULL != layoutParameters.characterDirectionBuffer )
+      {
+        hash = HashCombine( hash, static_cast<uint32_t>( *( layoutParameters.characterDirectionBuffer + index ) ) );
+      }
+    }
+
+    return hash;
+  }
+
+  /**
+   * @brief Whether a cached paragraph has been laid-out from the same glyphs, characters and break info.
+   *
+   * @param[in] paragraph The cached paragraph, with the same hash, number of glyphs and number of characters.
+   * @param[in] layoutParameters The parameters needed to layout the text.
+   * @param[in] glyphIndex The first glyph of the paragraph.
+   * @param[in] characterIndex The first character of the paragraph.
+   * @param[in] paragraphDirection The direction of the paragraph.
+   *
+   * @return @e true if the layout of the cached paragraph can be reused.
+   */
+  bool ParagraphLayoutMatches( const ParagraphLayout& paragraph,
+                               const LayoutParameters& layoutParameters,
+                               GlyphIndex glyphIndex,
+                               CharacterIndex characterIndex,
+                               CharacterDirection paragraphDirection ) const
+  {
+    if( paragraph.direction != paragraphDirection )
+    {
+      return false;
+    }
+
+    const GlyphInfo* const cachedGlyphsBuffer = mParagraphLayoutCache.glyphs.Begin() + paragraph.glyphPositionIndex;
+    const CharacterIndex* const cachedGlyphsToCharactersBuffer = mParagraphLayoutCache.glyphsToCharacters.Begin() + paragraph.glyphPositionIndex;
+    const Length* const cachedCharactersPerGlyphBuffer = mParagraphLayoutCache.charactersPerGlyph.Begin() + paragraph.glyphPositionIndex;
+    for( Length index = 0u; index < paragraph.numberOfGlyphs; ++index )
+    {
+      const GlyphInfo& glyph = *( layoutParameters.glyphsBuffer + glyphIndex + index );
+      const GlyphInfo& cachedGlyph = *( cachedGlyphsBuffer + index );
+
+      if( ( glyph.fontId != cachedGlyph.fontId ) ||
+          ( glyph.width != cachedGlyph.width ) ||
+          ( glyph.advance != cachedGlyph.advance ) ||
+          ( glyph.xBearing != cachedGlyph.xBearing ) ||
+          ( glyph.yBearing != cachedGlyph.yBearing ) ||
+          ( *( layoutParameters.glyphsToCharactersBuffer + glyphIndex + index ) - characterIndex != *( cachedGlyphsToCharactersBuffer + index ) ) ||
+          ( *( layoutParameters.charactersPerGlyphBuffer + glyphIndex + index ) != *( cachedCharactersPerGlyphBuffer + index ) ) )
+      {
+        return false;
+      }
+    }
+
+    const Length numberOfCharacters = paragraph.numberOfCharacters;
+    if( ( 0 != memcmp( layoutParameters.textBuffer + characterIndex,
+                       mParagraphLayoutCache.characters.Begin() + paragraph.characterIndex,
+                       numberOfCharacters * sizeof( Character ) ) ) ||
+        ( 0 != memcmp( layoutParameters.lineBreakInfoBuffer + characterIndex,
+                       mParagraphLayoutCache.lineBreakInfo.Begin() + paragraph.characterIndex,
+                       numberOfCharacters * sizeof( LineBreakInfo ) ) ) ||
+        ( 0 != memcmp( layoutParameters.wordBreakInfoBuffer + characterIndex,
+                       mParagraphLayoutCache.wordBreakInfo.Begin() + paragraph.characterIndex,
+                       numberOfCharacters * sizeof( WordBreakInfo ) ) ) )
+    {
+      return false;
+    }
+
+    const CharacterDirection* const cachedCharacterDirectionsBuffer = mParagraphLayoutCache.characterDirections.Begin() + paragraph.characterIndex;
+    for( Length index = 0u; index < numberOfCharacters; ++index )
+    {
+      const CharacterDirection direction = ( NULL == layoutParameters.characterDirectionBuffer ) ? false : *( layoutParameters.characterDirectionBuffer + characterIndex + index );
+      if( direction != *( cachedCharacterDirectionsBuffer + index ) )
+      {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+  /**
+   * @brief Finds a paragraph in the cache of the paragraph layouts.
+   *
+   * Two different paragraphs may have the same hash, so the input of the layout is compared too.
+   *
+   * @param[in] hash The hash of the paragraph.
+   * @param[in] layoutParameters The parameters needed to layout the text.
+   * @param[in] glyphIndex The first glyph of the paragraph.
+   * @param[in] numberOfGlyphs The number of glyphs of the paragraph.
+   * @param[in] characterIndex The first character of the paragraph.
+   * @param[in] numberOfCharacters The number of characters of the paragraph.
+   * @param[in] paragraphDirection The direction of the paragraph.
+   *
+   * @return A pointer to the cached paragraph or NULL if it's not cached.
+   */
+  const ParagraphLayout* FindParagraphLayout( uint64_t hash,
+                                              const LayoutParameters& layoutParameters,
+                                              GlyphIndex glyphIndex,
+                                              Length numberOfGlyphs,
+                                              CharacterIndex characterIndex,
+                                              Length numberOfCharacters,
+                                              CharacterDirection paragraphDirection ) const
+  {
+    ParagraphLayout key;
+    key.hash = hash;
+
+    for( Vector<ParagraphLayout>::ConstIterator it = std::lower_bound( mParagraphLayoutCache.paragraphs.Begin(), mParagraphLayoutCache.paragraphs.End(), key ),
+           endIt = mParagraphLayoutCache.paragraphs.End();
+         ( it != endIt ) && ( it->hash == hash );
+         ++it )
+    {
+      if( ( it->numberOfGlyphs == numberOfGlyphs ) &&
+          ( it->numberOfCharacters == numberOfCharacters ) &&
+          ParagraphLayoutMatches( *it, layoutParameters, glyphIndex, characterIndex, paragraphDirection ) )
+      {
+        return it;
+      }
+    }
+
+    return NULL;
+  }
+
+  /**
+   * @brief Whether all the lines of a cached paragraph fit in the height of the box.
+   *
+   * @param[in] paragraph The cached paragraph.
+   * @param[in] penY The vertical layout position.
+   * @param[in] height The height of the box.
+   *
+   * @return @e true if no line of the paragraph needs to be ellipsized.
+   */
+  bool ParagraphLayoutFits( const ParagraphLayout& paragraph,
+                            float penY,
+                            float height ) const
+  {
+    for( Vector<LineRun>::ConstIterator it = mParagraphLayoutCache.lines.Begin() + paragraph.lineIndex,
+           endIt = it + paragraph.numberOfLines;
+         it != endIt;
+         ++it )
+    {
+      penY += it->ascender;
+
+      if( penY - it->descender > height )
+      {
+        return false;
+      }
+
+      penY += -it->descender;
+    }
+
+    return true;
+  }
+
+  /**
+   * @brief Copies the lines and glyph positions of a cached paragraph.
+   *
+   * @param[in] paragraph The cached paragraph.
+   * @param[in] glyphIndex The first glyph of the paragraph within the text.
+   * @param[in] characterIndex The first character of the paragraph within the text.
+   * @param[in,out] layoutSize The text's layout size.
+   * @param[out] linesBuffer Pointer to the line's buffer where to copy the lines.
+   * @param[out] glyphPositionsBuffer Pointer to the position's buffer where to copy the glyph positions.
+   * @param[in,out] penY The vertical layout position.
+   */
+  void CopyParagraphLayout( const ParagraphLayout& paragraph,
+                            GlyphIndex glyphIndex,
+                            CharacterIndex characterIndex,
+                            Size& layoutSize,
+                            LineRun* linesBuffer,
+                            Vector2* glyphPositionsBuffer,
+                            float& penY )
+  {
+    const LineRun* const cachedLinesBuffer = mParagraphLayoutCache.lines.Begin() + paragraph.lineIndex;
+    for( Length index = 0u; index < paragraph.numberOfLines; ++index )
+    {
+      LineRun& line = *( linesBuffer + index );
+      line = *( cachedLinesBuffer + index );
+
+      line.glyphRun.glyphIndex += glyphIndex;
+      line.characterRun.characterIndex += characterIndex;
+
+      if( line.width > layoutSize.width )
+      {
+        layoutSize.width = line.width;
+      }
+
+      layoutSize.height += ( line.ascender + -line.descender );
+      penY += ( line.ascender + -line.descender );
+    }
+
+    memcpy( glyphPositionsBuffer,
+            mParagraphLayoutCache.glyphPositions.Begin() + paragraph.glyphPositionIndex,
+            paragraph.numberOfGlyphs * sizeof( Vector2 ) );
+  }
+
+  /**
+   * @brief Adds the lines and glyph positions of a laid-out paragraph to a paragraph layout cache.
+   *
+   * @param[in,out] cache The paragraph layout cache.
+   * @param[in] hash The hash of the paragraph.
+   * @param[in] layoutParameters The parameters needed to layout the text.
+   * @param[in] paragraphDirection The direction of the paragraph.
+   * @param[in] glyphIndex The first glyph of the paragraph within the text.
+   * @param[in] numberOfGlyphs The number of glyphs of the paragraph.
+   * @param[in] characterIndex The first character of the paragraph within the text.
+   * @param[in] numberOfCharacters The number of characters of the paragraph.
+   * @param[in] linesBuffer Pointer to the first line of the paragraph.
+   * @param[in] numberOfLines The number of lines of the paragraph.
+   * @param[in] glyphPositionsBuffer Pointer to the position of the first glyph of the paragraph.
+   */
+  void StoreParagraphLayout( ParagraphLayoutCache& cache,
+                             uint64_t hash,
+                             const LayoutParameters& layoutParameters,
+                             CharacterDirection paragraphDirection,
+                             GlyphIndex glyphIndex,
+                             Length numberOfGlyphs,
+                             CharacterIndex characterIndex,
+                             Length numberOfCharacters,
+                             const LineRun* const linesBuffer,
+                             Length numberOfLines,
+                             const Vector2* const glyphPositionsBuffer )
+  {
+    ParagraphLayout paragraph;
+    paragraph.hash = hash;
+    paragraph.numberOfGlyphs = numberOfGlyphs;
+    paragraph.numberOfCharacters = numberOfCharacters;
+    paragraph.lineIndex = cache.lines.Count();
+    paragraph.numberOfLines = numberOfLines;
+    paragraph.glyphPositionIndex = cache.glyphPositions.Count();
+    paragraph.characterIndex = cache.characters.Count();
+    paragraph.direction = paragraphDirection;
+    cache.paragraphs.PushBack( paragraph );
+
+    for( Length index = 0u; index < numberOfLines; ++index )
+    {
+      LineRun line = *( linesBuffer + index );
+
+      line.glyphRun.glyphIndex -= glyphIndex;
+      line.characterRun.characterIndex -= characterIndex;
+
+      cache.lines.PushBack( line );
+    }
+
+    cache.glyphPositions.Insert( cache.glyphPositions.End(),
+                                 glyphPositionsBuffer,
+                                 glyphPositionsBuffer + numberOfGlyphs );
+
+    // Keep the input of the layout to compare it when the hash matches.
+    cache.glyphs.Insert( cache.glyphs.End(),
+                         layoutParameters.glyphsBuffer + glyphIndex,
+                         layoutParameters.glyphsBuffer + glyphIndex + numberOfGlyphs );
+    cache.charactersPerGlyph.Insert( cache.charactersPerGlyph.End(),
+                                     layoutParameters.charactersPerGlyphBuffer + glyphIndex,
+                                     layoutParameters.charactersPerGlyphBuffer + glyphIndex + numberOfGlyphs );
+    for( Length index = 0u; index < numberOfGlyphs; ++index )
+    {
+      cache.glyphsToCharacters.PushBack( *( layoutParameters.glyphsToCharactersBuffer + glyphIndex + index ) - characterIndex );
+    }
+
+    cache.characters.Insert( cache.characters.End(),
+                             layoutParameters.textBuffer + characterIndex,
+                             layoutParameters.textBuffer + characterIndex + numberOfCharacters );
+    cache.lineBreakInfo.Insert( cache.lineBreakInfo.End(),
+                                layoutParameters.lineBreakInfoBuffer + characterIndex,
+                                layoutParameters.lineBreakInfoBuffer + characterIndex + numberOfCharacters );
+    cache.wordBreakInfo.Insert( cache.wordBreakInfo.End(),
+                                layoutParameters.wordBreakInfoBuffer + characterIndex,
+                                layoutParameters.wordBreakInfoBuffer + characterIndex + numberOfCharacters );
+    if( NULL == layoutParameters.characterDirectionBuffer )
+    {
+      cache.characterDirections.Resize( cache.characterDirections.Count() + numberOfCharacters, false );
+    }
+    else
+    {
+      cache.characterDirections.Insert( cache.characterDirections.End(),
+                                        layoutParameters.characterDirectionBuffer + characterIndex,
+                                        layoutParameters.characterDirectionBuffer + characterIndex + numberOfCharacters );
+    }
+  }
+
   bool LayoutText( const LayoutParameters& layoutParameters,
                    Vector<Vector2>& glyphPositions,
                    Vector<LineRun>& lines,
@@ -853,8 +1354,108 @@ struct LayoutEngine::Impl
     float penY = CalculateLineOffset( lines,
                                       layoutParameters.startLineIndex );
 
+    // Paragraphs laid-out with the same width by a previous layout are copied from the cache.
+    // The cache is rebuilt when the whole text is laid-out.
+    const bool useParagraphLayoutCache = ( MULTI_LINE_BOX == mLayout );
+    const bool isParagraphLayoutCacheValid = useParagraphLayoutCache &&
+                                             Equals( mParagraphLayoutCache.width, layoutParameters.boundingBox.width ) &&
+                                             Equals( mParagraphLayoutCache.cursorWidth, mCursorWidth );
+    ParagraphLayoutCache newParagraphLayoutCache;
+
+    GlyphIndex paragraphGlyphIndex = layoutParameters.startGlyphIndex;
+    GlyphIndex paragraphEndGlyphIndex = layoutParameters.startGlyphIndex;
+    CharacterIndex paragraphCharacterIndex = 0u;
+    Length paragraphNumberOfCharacters = 0u;
+    LineIndex paragraphLineIndex = 0u;
+    uint64_t paragraphHash = 0u;
+    CharacterDirection paragraphStartDirection = paragraphDirection;
+    bool isParagraphCacheable = false;
+
     for( GlyphIndex index = layoutParameters.startGlyphIndex; index < lastGlyphPlusOne; )
     {
+      if( useParagraphLayoutCache && ( index >= paragraphEndGlyphIndex ) )
+      {
+        // A new paragraph starts.
+        paragraphGlyphIndex = index;
+        paragraphCharacterIndex = *( layoutParameters.glyphsToCharactersBuffer + index );
+        paragraphLineIndex = numberOfLines;
+        paragraphStartDirection = paragraphDirection;
+
+        isParagraphCacheable = GetParagraph( layoutParameters,
+                                             index,
+                                             lastGlyphPlusOne,
+                                             paragraphEndGlyphIndex,
+                                             paragraphNumberOfCharacters );
+
+        if( isParagraphCacheable )
+        {
+          const Length paragraphNumberOfGlyphs = paragraphEndGlyphIndex - paragraphGlyphIndex;
+
+          paragraphHash = HashParagraph( layoutParameters,
+                                         paragraphGlyphIndex,
+                                         paragraphNumberOfGlyphs,
+                                         paragraphCharacterIndex,
+                                         paragraphNumberOfCharacters,
+                                         paragraphDirection );
+
+          const ParagraphLayout* const paragraph = isParagraphLayoutCacheValid ? FindParagraphLayout( paragraphHash,
+                                                                                                      layoutParameters,
+                                                                                                      paragraphGlyphIndex,
+                                                                                                      paragraphNumberOfGlyphs,
+                                                                                                      paragraphCharacterIndex,
+                                                                                                      paragraphNumberOfCharacters,
+                                                                                                      paragraphDirection ) : NULL;
+
+          if( ( NULL != paragraph ) &&
+              ( !mEllipsisEnabled || ParagraphLayoutFits( *paragraph, penY, layoutParameters.boundingBox.height ) ) )
+          {
+            DALI_LOG_INFO( gLogFilter, Debug::Verbose, "  paragraph layout cached, glyph index %d, number of lines %d\n", paragraphGlyphIndex, paragraph->numberOfLines );
+
+            while( numberOfLines + paragraph->numberOfLines > linesCapacity )
+            {
+              // Reserve more space for the paragraph's lines.
+              linesBuffer = ResizeLinesBuffer( lines,
+                                               newLines,
+                                               linesCapacity,
+                                               updateCurrentBuffer );
+            }
+
+            CopyParagraphLayout( *paragraph,
+                                 paragraphGlyphIndex,
+                                 paragraphCharacterIndex,
+                                 layoutSize,
+                                 linesBuffer + numberOfLines,
+                                 glyphPositionsBuffer + paragraphGlyphIndex - layoutParameters.startGlyphIndex,
+                                 penY );
+            numberOfLines += paragraph->numberOfLines;
+
+            if( !updateCurrentBuffer )
+            {
+              StoreParagraphLayout( newParagraphLayoutCache,
+                                    paragraphHash,
+                                    layoutParameters,
+                                    paragraphStartDirection,
+                                    paragraphGlyphIndex,
+                                    paragraphNumberOfGlyphs,
+                                    paragraphCharacterIndex,
+                                    paragraphNumberOfCharacters,
+                                    linesBuffer + paragraphLineIndex,
+                                    paragraph->numberOfLines,
+                                    glyphPositionsBuffer + paragraphGlyphIndex - layoutParameters.startGlyphIndex );
+            }
+
+            // Set the next paragraph's direction.
+            if( NULL != layoutParameters.characterDirectionBuffer )
+            {
+              paragraphDirection = *( layoutParameters.characterDirectionBuffer + paragraphCharacterIndex + paragraphNumberOfCharacters );
+            }
+
+            index = paragraphEndGlyphIndex;
+            continue;
+          }
+        }
+      }
+
       CharacterDirection currentParagraphDirection = paragraphDirection;
 
       // Get the layout for the line.
@@ -965,6 +1566,22 @@ struct LayoutEngine::Impl
 
         // Increase the glyph index.
         index = nextIndex;
+
+        if( isParagraphCacheable && !updateCurrentBuffer && ( index == paragraphEndGlyphIndex ) )
+        {
+          // The paragraph has been laid-out. Keep its layout for the next time the whole text is laid-out.
+          StoreParagraphLayout( newParagraphLayoutCache,
+                                paragraphHash,
+                                layoutParameters,
+                                paragraphStartDirection,
+                                paragraphGlyphIndex,
+                                paragraphEndGlyphIndex - paragraphGlyphIndex,
+                                paragraphCharacterIndex,
+                                paragraphNumberOfCharacters,
+                                linesBuffer + paragraphLineIndex,
+                                numberOfLines - paragraphLineIndex,
+                                glyphPositionsBuffer + paragraphGlyphIndex - layoutParameters.startGlyphIndex );
+        }
       } // no ellipsis
     } // end for() traversing glyphs.
 
@@ -1004,6 +1621,15 @@ struct LayoutEngine::Impl
     else
     {
       lines.Resize( numberOfLines );
+
+      if( useParagraphLayoutCache )
+      {
+        // Replace the paragraph layouts of the previous layout.
+        std::sort( newParagraphLayoutCache.paragraphs.Begin(), newParagraphLayoutCache.paragraphs.End() );
+        newParagraphLayoutCache.width = layoutParameters.boundingBox.width;
+        newParagraphLayoutCache.cursorWidth = mCursorWidth;
+        mParagraphLayoutCache.Swap( newParagraphLayoutCache );
+      }
     }
 
     DALI_LOG_INFO( gLogFilter, Debug::Verbose, "<--LayoutText\n\n" );
@@ -1011,6 +1637,68 @@ struct LayoutEngine::Impl
     return true;
   }
 
+  bool CalculateLayoutSize( const LayoutParameters& layoutParameters,
+                            Size& layoutSize,
+                            Length& numberOfLines )
+  {
+    DALI_LOG_INFO( gLogFilter, Debug::Verbose, "-->CalculateLayoutSize\n" );
+
+    layoutSize = Size::ZERO;
+    numberOfLines = 0u;
+
+    // Set the first paragraph's direction.
+    CharacterDirection paragraphDirection = ( NULL != layoutParameters.characterDirectionBuffer ) ? *layoutParameters.characterDirectionBuffer : !RTL;
+
+    for( GlyphIndex index = 0u; index < layoutParameters.totalNumberOfGlyphs; )
+    {
+      // Get the layout for the line.
+      LineLayout layout;
+      layout.glyphIndex = index;
+      GetLineLayoutForBox( layoutParameters,
+                           layout,
+                           paragraphDirection,
+                           false );
+
+      if( 0u == layout.numberOfGlyphs )
+      {
+        // The width is too small and no characters are laid-out.
+        DALI_LOG_INFO( gLogFilter, Debug::Verbose, "<--CalculateLayoutSize width too small!\n\n" );
+        return false;
+      }
+
+      const GlyphIndex nextIndex = index + layout.numberOfGlyphs;
+      const bool isLastLine = nextIndex == layoutParameters.totalNumberOfGlyphs;
+
+      const float width = CalculateLineWidth( layoutParameters, layout, isLastLine );
+      if( width > layoutSize.width )
+      {
+        layoutSize.width = width;
+      }
+      layoutSize.height += ( layout.ascender + -layout.descender );
+      ++numberOfLines;
+
+      if( isLastLine &&
+          layoutParameters.isLastNewParagraph &&
+          ( MULTI_LINE_BOX == mLayout ) )
+      {
+        // The extra line with no characters added after the last new paragraph character.
+        const GlyphInfo& glyphInfo = *( layoutParameters.glyphsBuffer + layoutParameters.totalNumberOfGlyphs - 1u );
+
+        Text::FontMetrics fontMetrics;
+        mMetrics->GetFontMetrics( glyphInfo.fontId, fontMetrics );
+
+        layoutSize.height += ( fontMetrics.ascender + -fontMetrics.descender );
+        ++numberOfLines;
+      }
+
+      index = nextIndex;
+    }
+
+    DALI_LOG_INFO( gLogFilter, Debug::Verbose, "<--CalculateLayoutSize size %f,%f lines %d\n\n", layoutSize.width, layoutSize.height, numberOfLines );
+
+    return true;
+  }
+
   void ReLayoutRightToLeftLines( const LayoutParameters& layoutParameters,
                                  CharacterIndex startIndex,
                                  Length numberOfCharacters,
@@ -1196,6 +1884,8 @@ struct LayoutEngine::Impl
 
   IntrusivePtr<Metrics> mMetrics;
 
+  ParagraphLayoutCache mParagraphLayoutCache; ///< The layout of the paragraphs of the last complete layout.
+
   bool mEllipsisEnabled:1;
 };
 
@@ -1278,6 +1968,15 @@ bool LayoutEngine::LayoutText( const LayoutParameters& layoutParameters,
                             layoutSize );
 }
 
+bool LayoutEngine::CalculateLayoutSize( const LayoutParameters& layoutParameters,
+                                        Size& layoutSize,
+                                        Length& numberOfLines )
+{
+  return mImpl->CalculateLayoutSize( layoutParameters,
+                                     layoutSize,
+                                     numberOfLines );
+}
+
 void LayoutEngine::ReLayoutRightToLeftLines( const LayoutParameters& layoutParameters,
                                              CharacterIndex startIndex,
                                              Length numberOfCharacters,
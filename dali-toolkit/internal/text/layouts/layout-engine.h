@@ -164,6 +164,22 @@ public:
                    Vector<LineRun>& lines,
                    Size& layoutSize );
 
+  /**
+   * @brief Calculates the size of the whole text without setting the positions of the glyphs.
+   *
+   * The text is split in lines as LayoutText() does but neither the lines nor the positions are stored.
+   * The ellipsis is not done.
+   *
+   * @param[in] layoutParameters The parameters needed to layout the text.
+   * @param[out] layoutSize The size of the text after it has been laid-out.
+   * @param[out] numberOfLines The number of lines.
+   *
+   * @return \e false if the given width is too small to layout even a single character.
+   */
+  bool CalculateLayoutSize( const LayoutParameters& layoutParameters,
+                            Size& layoutSize,
+                            Length& numberOfLines );
+
   /**
    * @brief Re-lays out those lines with right to left characters.
    *
@@ -51,18 +51,10 @@ LogicalModelPtr LogicalModel::New()
 
 Script LogicalModel::GetScript( CharacterIndex characterIndex ) const
 {
-  // If this operation is too slow, consider a binary search.
-
-  const ScriptRun* const scriptRunBuffer = mScriptRuns.Begin();
-  for( Length index = 0u, length = mScriptRuns.Count(); index < length; ++index )
+  ScriptRunIndex scriptIndex = 0u;
+  if( FindCharacterRun( mScriptRuns, characterIndex, scriptIndex ) )
   {
-    const ScriptRun* const scriptRun = scriptRunBuffer + index;
-
-    if( ( scriptRun->characterRun.characterIndex <= characterIndex ) &&
-        ( characterIndex < scriptRun->characterRun.characterIndex + scriptRun->characterRun.numberOfCharacters ) )
-    {
-      return scriptRun->script;
-    }
+    return ( *( mScriptRuns.Begin() + scriptIndex ) ).script;
   }
 
   return TextAbstraction::UNKNOWN;
@@ -470,20 +462,15 @@ void LogicalModel::CreateParagraphInfo( CharacterIndex startIndex,
 
   if( updateCurrentParagraphs )
   {
-    for( Vector<ParagraphRun>::ConstIterator it = mParagraphInfo.Begin(),
-           endIt = mParagraphInfo.Begin() + totalNumberOfParagraphs - numberOfNewParagraphs;
-         it != endIt;
-         ++it )
-    {
-      const ParagraphRun& paragraph( *it );
+    // The new paragraphs are not set yet at the end of the buffer.
+    const Length numberOfCurrentParagraphs = totalNumberOfParagraphs - numberOfNewParagraphs;
+    paragraphIndex = FindFirstCharacterRun( mParagraphInfo.Begin(),
+                                            numberOfCurrentParagraphs,
+                                            startIndex );
 
-      if( startIndex < paragraph.characterRun.characterIndex + paragraph.characterRun.numberOfCharacters )
-      {
-        firstIndex = paragraph.characterRun.characterIndex;
-        break;
-      }
-
-      ++paragraphIndex;
+    if( paragraphIndex < numberOfCurrentParagraphs )
+    {
+      firstIndex = ( *( mParagraphInfo.Begin() + paragraphIndex ) ).characterRun.characterIndex;
     }
   }
 
@@ -534,19 +521,22 @@ void LogicalModel::FindParagraphs( CharacterIndex index,
   paragraphs.Reserve( mParagraphInfo.Count() );
 
   // Traverse the paragraphs to find which ones contain the given characters.
-  ParagraphRunIndex paragraphIndex = 0u;
-  for( Vector<ParagraphRun>::ConstIterator it = mParagraphInfo.Begin(),
+  // The paragraphs before the one found with the binary search end before the given characters.
+  ParagraphRunIndex paragraphIndex = FindFirstCharacterRun( mParagraphInfo, index );
+  for( Vector<ParagraphRun>::ConstIterator it = mParagraphInfo.Begin() + paragraphIndex,
          endIt = mParagraphInfo.End();
        it != endIt;
        ++it, ++paragraphIndex )
   {
     const ParagraphRun& paragraph( *it );
 
-    if( ( paragraph.characterRun.characterIndex + paragraph.characterRun.numberOfCharacters > index ) &&
-        ( paragraph.characterRun.characterIndex < index + numberOfCharacters ) )
+    if( paragraph.characterRun.characterIndex >= index + numberOfCharacters )
     {
-      paragraphs.PushBack( paragraphIndex );
+      // The next paragraphs start after the given characters.
+      break;
     }
+
+    paragraphs.PushBack( paragraphIndex );
   }
 }
 
@@ -55,6 +55,8 @@ const char SLASH          = '/';
 const char BACK_SLASH     = '\\';
 
 const char WHITE_SPACE    = 0x20; // ASCII value of the white space.
+const char CR             = 0xd;
+const char LF             = 0xa;
 
 const unsigned int MAX_NUM_OF_ATTRIBUTES =  5u; ///< The font tag has the 'family', 'size' 'weight', 'width' and 'slant' attrubutes.
 const unsigned int DEFAULT_VECTOR_SIZE   = 16u; ///< Default size of run vectors.
@@ -358,9 +360,10 @@ bool IsTag( const char*& markupStringBuffer,
 
 void ProcessMarkupString( const std::string& markupString, MarkupProcessData& markupProcessData )
 {
-  // Reserve space for the plain text.
+  // Reserve space for the plain text. The number of utf32 characters is never bigger than the number of utf8 bytes.
   const Length markupStringSize = markupString.size();
-  markupProcessData.markupProcessedText.reserve( markupStringSize );
+  markupProcessData.text.Resize( markupStringSize );
+  Character* const textBuffer = markupProcessData.text.Begin();
 
   // Stores a struct with the index to the first character of the run, the type of run and its parameters.
   StyleStack styleStack;
@@ -379,6 +382,10 @@ void ProcessMarkupString( const std::string& markupString, MarkupProcessData& ma
 
   Tag tag;
   CharacterIndex characterIndex = 0u;
+
+  // Whether the last converted character is a 'CR'. A 'LF' after it is removed even if there are tags in between.
+  bool isPreviousCarriageReturn = false;
+
   for( ; markupStringBuffer < markupStringEndBuffer; )
   {
     if( IsTag( markupStringBuffer,
@@ -547,14 +554,19 @@ void ProcessMarkupString( const std::string& markupString, MarkupProcessData& ma
         }
       } // <outline></outline>
     }  // end if( IsTag() )
-    else
+    else if( markupStringBuffer >= markupStringEndBuffer )
     {
-      unsigned char character = *markupStringBuffer;
+      // A '<' without a closing '>'. The rest of the string has been traversed by IsTag().
+      break;
+    }
+    else if( BACK_SLASH == *markupStringBuffer )
+    {
+      Character character = BACK_SLASH;
 
-      if( ( BACK_SLASH == character ) && ( markupStringBuffer + 1u < markupStringEndBuffer ) )
+      if( markupStringBuffer + 1u < markupStringEndBuffer )
       {
         // Adding < or > special character.
-        const unsigned char nextCharacter = *( markupStringBuffer + 1u );
+        const char nextCharacter = *( markupStringBuffer + 1u );
         if( ( LESS_THAN == nextCharacter ) || ( GREATER_THAN == nextCharacter ) )
         {
           character = nextCharacter;
@@ -562,20 +574,45 @@ void ProcessMarkupString( const std::string& markupString, MarkupProcessData& ma
         }
       }
 
-      const unsigned char numberOfBytes = GetUtf8Length( character );
+      *( textBuffer + characterIndex ) = character;
 
-      markupProcessData.markupProcessedText.push_back( character );
-      for( unsigned char i = 1u; i < numberOfBytes; ++i )
+      ++characterIndex;
+      ++markupStringBuffer;
+      isPreviousCarriageReturn = false;
+    }
+    else
+    {
+      if( isPreviousCarriageReturn && ( LF == *markupStringBuffer ) )
       {
+        // The 'CR' has already been replaced by a 'LF'.
         ++markupStringBuffer;
-        markupProcessData.markupProcessedText.push_back( *markupStringBuffer );
+        isPreviousCarriageReturn = false;
       }
 
-      ++characterIndex;
-      ++markupStringBuffer;
+      // Find the plain text until the next tag or escaped character.
+      // The '<' and '\' characters are never part of a multi-byte utf8 character.
+      const char* const plainTextBuffer = markupStringBuffer;
+      for( ; ( markupStringBuffer < markupStringEndBuffer ) &&
+             ( LESS_THAN != *markupStringBuffer ) &&
+             ( BACK_SLASH != *markupStringBuffer );
+           ++markupStringBuffer );
+
+      const Length plainTextSize = markupStringBuffer - plainTextBuffer;
+      if( 0u != plainTextSize )
+      {
+        // Convert the plain text straight into the model.
+        characterIndex += Utf8ToUtf32( reinterpret_cast<const uint8_t*>( plainTextBuffer ),
+                                       plainTextSize,
+                                       textBuffer + characterIndex );
+
+        isPreviousCarriageReturn = CR == *( markupStringBuffer - 1u );
+      }
     }
   }
 
+  // Set the actual number of characters.
+  markupProcessData.text.Resize( characterIndex );
+
   // Resize the model's vectors.
   if( 0u == fontRunIndex )
   {
@@ -36,26 +36,31 @@ namespace Text
 {
 
 /**
- * @brief Keeps the plain text and references to vectors from the model which stores runs with text styles.
+ * @brief Keeps references to vectors from the model which stores the plain text and the runs with text styles.
  */
 struct MarkupProcessData
 {
 MarkupProcessData( Vector<ColorRun>& colorRuns,
-                   Vector<FontDescriptionRun>& fontRuns )
+                   Vector<FontDescriptionRun>& fontRuns,
+                   Vector<Character>& text )
   : colorRuns( colorRuns ),
     fontRuns( fontRuns ),
-    markupProcessedText()
+    text( text )
   {}
 
-  Vector<ColorRun>&           colorRuns;           ///< The color runs.
-  Vector<FontDescriptionRun>& fontRuns;            ///< The font description runs.
-
-  std::string                 markupProcessedText; ///< The mark-up string.
+  Vector<ColorRun>&           colorRuns; ///< The color runs.
+  Vector<FontDescriptionRun>& fontRuns;  ///< The font description runs.
+  Vector<Character>&          text;      ///< The plain text encoded in utf32.
 };
 
 /**
  * @brief Process the mark-up string.
  *
+ * The mark-up string is traversed once. The plain text between the tags is converted to utf32 straight
+ * into the @e text vector and the style runs are set with the utf32 character indices.
+ *
+ * If the text contains a single 'CR' character or a pair 'CR'+'LF', they are replaced by a 'LF'. @see Utf8ToUtf32()
+ *
  * @param[in] markupString The mark-up string.
  * @param[out] markupProcessData The plain text and the style.
  */
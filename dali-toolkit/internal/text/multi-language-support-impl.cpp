@@ -25,6 +25,7 @@
 
 // INTERNAL INCLUDES
 #include <dali-toolkit/internal/text/multi-language-helper-functions.h>
+#include <dali-toolkit/internal/text/text-run-container.h>
 
 namespace Dali
 {
@@ -39,6 +40,22 @@ Debug::Filter* gLogFilter = Debug::Filter::New(Debug::NoLogging, true, "LOG_MULT
 #endif
 
 const Dali::Toolkit::Text::Character UTF32_A = 0x0041;
+
+const unsigned int FONT_FALLBACK_CACHE_SIZE = 1024u; ///< The number of items of the font fallback cache. It must be a power of two.
+
+/**
+ * @brief Retrieves the index to the item of the font fallback cache for the given font and character.
+ *
+ * @param[in] requestedFontId The font requested for the character.
+ * @param[in] character The character.
+ *
+ * @return The index to the item.
+ */
+inline unsigned int GetFontFallbackCacheIndex( Dali::Toolkit::Text::FontId requestedFontId, Dali::Toolkit::Text::Character character )
+{
+  // Consecutive characters of a block are mapped to consecutive items.
+  return ( character ^ ( requestedFontId * 0x9e3779b1u ) ) & ( FONT_FALLBACK_CACHE_SIZE - 1u );
+}
 }
 
 namespace Text
@@ -80,9 +97,47 @@ FontId DefaultFonts::FindFont( TextAbstraction::FontClient& fontClient, PointSiz
   return 0u;
 }
 
+FontFallbackCache::FontFallbackCache()
+: mItems(),
+  mNumberOfHits( 0u ),
+  mNumberOfMisses( 0u )
+{
+  // Font ids start from one so a zero initialized item doesn't match any requested font.
+  Item item;
+  item.requestedFontId = 0u;
+  item.character = 0u;
+  item.fontId = 0u;
+  mItems.Resize( FONT_FALLBACK_CACHE_SIZE, item );
+}
+
+FontId FontFallbackCache::FindFont( FontId requestedFontId, Character character )
+{
+  const Item& item = *( mItems.Begin() + GetFontFallbackCacheIndex( requestedFontId, character ) );
+
+  if( ( requestedFontId == item.requestedFontId ) &&
+      ( character == item.character ) )
+  {
+    ++mNumberOfHits;
+    return item.fontId;
+  }
+
+  ++mNumberOfMisses;
+  return 0u;
+}
+
+void FontFallbackCache::AddFont( FontId requestedFontId, Character character, FontId fontId )
+{
+  Item& item = *( mItems.Begin() + GetFontFallbackCacheIndex( requestedFontId, character ) );
+
+  item.requestedFontId = requestedFontId;
+  item.character = character;
+  item.fontId = fontId;
+}
+
 MultilanguageSupport::MultilanguageSupport()
 : mDefaultFontPerScriptCache(),
-  mValidFontsPerScriptCache()
+  mValidFontsPerScriptCache(),
+  mFontFallbackCache()
 {
   // Initializes the default font cache to zero (invalid font).
   // Reserves space to cache the default fonts and access them with the script as an index.
@@ -154,18 +209,7 @@ void MultilanguageSupport::SetScripts( const Vector<Character>& text,
   ScriptRunIndex scriptIndex = 0u;
   if( 0u != startIndex )
   {
-    for( Vector<ScriptRun>::ConstIterator it = scripts.Begin(),
-           endIt = scripts.End();
-         it != endIt;
-         ++it, ++scriptIndex )
-    {
-      const ScriptRun& run = *it;
-      if( startIndex < run.characterRun.characterIndex + run.characterRun.numberOfCharacters )
-      {
-        // Run found.
-        break;
-      }
-    }
+    scriptIndex = FindFirstCharacterRun( scripts, startIndex );
   }
 
   // Stores the current script run.
@@ -175,7 +219,7 @@ void MultilanguageSupport::SetScripts( const Vector<Character>& text,
   currentScriptRun.script = TextAbstraction::UNKNOWN;
 
   // Reserve some space to reduce the number of reallocations.
-  scripts.Reserve( text.Count() << 2u );
+  scripts.Reserve( scripts.Count() + ( numberOfCharacters >> 2u ) );
 
   // Whether the first valid script needs to be set.
   bool isFirstScriptToBeSet = true;
@@ -392,18 +436,7 @@ void MultilanguageSupport::ValidateFonts( const Vector<Character>& text,
   FontRunIndex fontIndex = 0u;
   if( 0u != startIndex )
   {
-    for( Vector<FontRun>::ConstIterator it = fonts.Begin(),
-           endIt = fonts.End();
-         it != endIt;
-         ++it, ++fontIndex )
-    {
-      const FontRun& run = *it;
-      if( startIndex < run.characterRun.characterIndex + run.characterRun.numberOfCharacters )
-      {
-        // Run found.
-        break;
-      }
-    }
+    fontIndex = FindFirstCharacterRun( fonts, startIndex );
   }
 
   // Traverse the characters and validate/set the fonts.
@@ -449,7 +482,7 @@ void MultilanguageSupport::ValidateFonts( const Vector<Character>& text,
   const Character* const textBuffer = text.Begin();
   const FontId* const fontIdsBuffer = fontIds.Begin();
   const bool* const isDefaultFontBuffer = isDefaultFont.Begin();
-  Vector<ScriptRun>::ConstIterator scriptRunIt = scripts.Begin();
+  Vector<ScriptRun>::ConstIterator scriptRunIt = scripts.Begin() + FindFirstCharacterRun( scripts, startIndex );
   Vector<ScriptRun>::ConstIterator scriptRunEndIt = scripts.End();
   bool isNewParagraphCharacter = false;
 
@@ -581,6 +614,21 @@ void MultilanguageSupport::ValidateFonts( const Vector<Character>& text,
           isValidFont = validateFontsPerScript->IsValidFont( fontId );
         }
 
+        // The font requested for the character.
+        const FontId requestedFontId = fontId;
+
+        if( !isValidFont )
+        {
+          // Check in the cache of fonts resolved for characters not supported by the requested font.
+          const FontId fallbackFontId = mFontFallbackCache.FindFont( requestedFontId, character );
+
+          if( 0u != fallbackFontId )
+          {
+            fontId = fallbackFontId;
+            isValidFont = true;
+          }
+        }
+
         if( !isValidFont ) // (2)
         {
           // Use the font client to validate the font.
@@ -661,6 +709,9 @@ void MultilanguageSupport::ValidateFonts( const Vector<Character>& text,
               }
               defaultFontsPerScript->mFonts.PushBack( fontId );
             }
+
+            // Cache the font resolved for the character.
+            mFontFallbackCache.AddFont( requestedFontId, character, fontId );
           } // !isValidFont (3)
         } // !isValidFont (2)
       } // !isCommonScript
@@ -743,9 +794,20 @@ void MultilanguageSupport::ValidateFonts( const Vector<Character>& text,
     }
   }
 
+  DALI_LOG_INFO( gLogFilter, Debug::General, "  font fallback cache hits : %d, misses : %d\n", mFontFallbackCache.mNumberOfHits, mFontFallbackCache.mNumberOfMisses );
   DALI_LOG_INFO( gLogFilter, Debug::General, "<--MultilanguageSupport::ValidateFonts\n" );
 }
 
+unsigned int MultilanguageSupport::GetNumberOfFontFallbackCacheHits() const
+{
+  return mFontFallbackCache.mNumberOfHits;
+}
+
+unsigned int MultilanguageSupport::GetNumberOfFontFallbackCacheMisses() const
+{
+  return mFontFallbackCache.mNumberOfMisses;
+}
+
 } // namespace Internal
 
 } // namespace Text
@@ -103,6 +103,59 @@ struct DefaultFonts
   Vector<FontId> mFonts;
 };
 
+/**
+ * @brief Caches the fonts resolved for the characters not supported by the requested font.
+ *
+ * The requested font id identifies the font description and the point size. It's a direct mapped
+ * cache so its size is bounded. An item is replaced by the next one added with the same hash.
+ */
+struct FontFallbackCache
+{
+  /**
+   * @brief A resolved font.
+   */
+  struct Item
+  {
+    FontId    requestedFontId; ///< The font requested for the character.
+    Character character;       ///< The character.
+    FontId    fontId;          ///< The font resolved for the character.
+  };
+
+  /**
+   * Default constructor.
+   */
+  FontFallbackCache();
+
+  /**
+   * Default destructor.
+   */
+  ~FontFallbackCache()
+  {}
+
+  /**
+   * @brief Finds the font resolved for a character not supported by the requested font.
+   *
+   * @param[in] requestedFontId The font requested for the character.
+   * @param[in] character The character.
+   *
+   * @return The resolved font id. If there isn't any font cached it returns 0.
+   */
+  FontId FindFont( FontId requestedFontId, Character character );
+
+  /**
+   * @brief Adds the font resolved for a character not supported by the requested font.
+   *
+   * @param[in] requestedFontId The font requested for the character.
+   * @param[in] character The character.
+   * @param[in] fontId The resolved font.
+   */
+  void AddFont( FontId requestedFontId, Character character, FontId fontId );
+
+  Vector<Item> mItems;          ///< The cached fonts.
+  unsigned int mNumberOfHits;   ///< The number of characters found in the cache.
+  unsigned int mNumberOfMisses; ///< The number of characters not found in the cache.
+};
+
 /**
  * @brief Multi-language support implementation. @see Text::MultilanguageSupport.
  */
@@ -146,9 +199,20 @@ public:
                       Length numberOfCharacters,
                       Vector<FontRun>& fonts );
 
+  /**
+   * @copydoc Dali::MultilanguageSupport::GetNumberOfFontFallbackCacheHits()
+   */
+  unsigned int GetNumberOfFontFallbackCacheHits() const;
+
+  /**
+   * @copydoc Dali::MultilanguageSupport::GetNumberOfFontFallbackCacheMisses()
+   */
+  unsigned int GetNumberOfFontFallbackCacheMisses() const;
+
 private:
   Vector<DefaultFonts*>           mDefaultFontPerScriptCache; ///< Caches default fonts for a script.
   Vector<ValidateFontsPerScript*> mValidFontsPerScriptCache;  ///< Caches valid fonts for a script.
+  FontFallbackCache               mFontFallbackCache;         ///< Caches the fonts resolved for the characters not supported by the requested font.
 };
 
 } // namespace Internal
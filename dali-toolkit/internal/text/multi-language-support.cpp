@@ -76,6 +76,16 @@ void MultilanguageSupport::ValidateFonts( const Vector<Character>& text,
                                             fonts );
 }
 
+unsigned int MultilanguageSupport::GetNumberOfFontFallbackCacheHits() const
+{
+  return GetImplementation( *this ).GetNumberOfFontFallbackCacheHits();
+}
+
+unsigned int MultilanguageSupport::GetNumberOfFontFallbackCacheMisses() const
+{
+  return GetImplementation( *this ).GetNumberOfFontFallbackCacheMisses();
+}
+
 } // namespace Text
 
 } // namespace Toolkit
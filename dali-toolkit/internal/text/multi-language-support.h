@@ -125,6 +125,24 @@ public:
                       CharacterIndex startIndex,
                       Length numberOfCharacters,
                       Vector<FontRun>& fonts );
+
+  /**
+   * @brief Retrieves the number of characters not supported by the requested font whose font has been found in the font fallback cache.
+   *
+   * The font fallback cache is shared by all the texts.
+   *
+   * @return The number of cache hits.
+   */
+  unsigned int GetNumberOfFontFallbackCacheHits() const;
+
+  /**
+   * @brief Retrieves the number of characters whose font has been validated with the font client.
+   *
+   * The font fallback cache is shared by all the texts.
+   *
+   * @return The number of cache misses.
+   */
+  unsigned int GetNumberOfFontFallbackCacheMisses() const;
 };
 
 } // namespace Text
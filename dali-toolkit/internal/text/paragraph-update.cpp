@@ -0,0 +1,536 @@
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// FILE HEADER
+#include <dali-toolkit/internal/text/paragraph-update.h>
+
+// EXTERNAL INCLUDES
+#include <algorithm>
+#include <cstdlib>
+#include <vector>
+#include <dali/devel-api/adaptor-framework/environment-variable.h>
+#include <dali/devel-api/text-abstraction/script.h>
+#include <dali/devel-api/text-abstraction/segmentation.h>
+#include <dali/devel-api/threading/thread.h>
+#include <dali/integration-api/debug.h>
+
+// INTERNAL INCLUDES
+#include <dali-toolkit/internal/text/character-run.h>
+#include <dali-toolkit/internal/text/multi-language-support.h>
+#include <dali-toolkit/internal/text/text-run-container.h>
+
+namespace Dali
+{
+
+namespace Toolkit
+{
+
+namespace Text
+{
+
+namespace
+{
+
+#if defined(DEBUG_ENABLED)
+Debug::Filter* gLogFilter = Debug::Filter::New(Debug::NoLogging, true, "LOG_TEXT_PARAGRAPH_UPDATE");
+#endif
+
+const char* const DALI_TEXT_UPDATE_THREADS = "DALI_TEXT_UPDATE_THREADS";
+const unsigned int MAX_NUMBER_OF_UPDATE_THREADS = 8u;
+const Length MINIMUM_NUMBER_OF_CHARACTERS_PER_GROUP = 4096u; ///< Smaller groups of paragraphs are not worth a thread.
+
+const Character CHAR_CR = 0x000D;
+const Character CHAR_LF = 0x000A;
+
+ParagraphUpdateThreadPool* gThreadPool = NULL; ///< The thread pool shared by all the text controllers. Only accessed by the event thread.
+
+} // namespace
+
+/**
+ * @brief The paragraphs updated by one thread.
+ */
+struct ParagraphGroup
+{
+  ParagraphGroup( const Vector<Character>& text,
+                  TextAbstraction::Segmentation segmentation,
+                  MultilanguageSupport multilanguageSupport )
+  : text( &text ),
+    segmentation( segmentation ),
+    multilanguageSupport( multilanguageSupport ),
+    lineBreakInfoBuffer( NULL ),
+    wordBreakInfoBuffer( NULL ),
+    setScripts( false )
+  {
+    characterRun.characterIndex = 0u;
+    characterRun.numberOfCharacters = 0u;
+  }
+
+  const Vector<Character>*      text;                 ///< The whole text.
+  TextAbstraction::Segmentation segmentation;         ///< Handle retrieved in the event thread.
+  MultilanguageSupport          multilanguageSupport; ///< Handle retrieved in the event thread.
+  CharacterRun                  characterRun;         ///< The characters of the paragraphs.
+  LineBreakInfo*                lineBreakInfoBuffer;  ///< Where to set the line break info of the paragraphs. NULL if it's not set.
+  WordBreakInfo*                wordBreakInfoBuffer;  ///< Where to set the word break info of the paragraphs. NULL if it's not set.
+  Vector<ScriptRun>             scripts;              ///< The script runs of the paragraphs.
+  bool                          setScripts;           ///< Whether to set the scripts.
+};
+
+namespace
+{
+
+/**
+ * @brief Sets the break info and the scripts of a group of paragraphs.
+ *
+ * @param[in,out] group The group of paragraphs.
+ */
+void UpdateParagraphGroup( ParagraphGroup& group )
+{
+  const Character* const textBuffer = group.text->Begin() + group.characterRun.characterIndex;
+
+  if( NULL != group.lineBreakInfoBuffer )
+  {
+    group.segmentation.GetLineBreakPositions( textBuffer,
+                                              group.characterRun.numberOfCharacters,
+                                              group.lineBreakInfoBuffer );
+  }
+
+  if( NULL != group.wordBreakInfoBuffer )
+  {
+    group.segmentation.GetWordBreakPositions( textBuffer,
+                                              group.characterRun.numberOfCharacters,
+                                              group.wordBreakInfoBuffer );
+  }
+
+  if( group.setScripts )
+  {
+    group.multilanguageSupport.SetScripts( *group.text,
+                                           group.characterRun.characterIndex,
+                                           group.characterRun.numberOfCharacters,
+                                           group.scripts );
+  }
+}
+
+/**
+ * @brief Finds the end of the paragraph which contains the given character.
+ *
+ * @param[in] textBuffer The text.
+ * @param[in] index The character.
+ * @param[in] lastCharacterPlusOne Index to the character after the last one to look at.
+ *
+ * @return Index to the character after the new paragraph character, or @p lastCharacterPlusOne.
+ */
+CharacterIndex FindParagraphEnd( const Character* const textBuffer,
+                                 CharacterIndex index,
+                                 CharacterIndex lastCharacterPlusOne )
+{
+  for( ; index < lastCharacterPlusOne; ++index )
+  {
+    const Character character = *( textBuffer + index );
+    if( TextAbstraction::IsNewParagraph( character ) )
+    {
+      // Do not split a CR+LF sequence.
+      if( ( CHAR_CR == character ) &&
+          ( index + 1u < lastCharacterPlusOne ) &&
+          ( CHAR_LF == *( textBuffer + index + 1u ) ) )
+      {
+        ++index;
+      }
+
+      return index + 1u;
+    }
+  }
+
+  return lastCharacterPlusOne;
+}
+
+/**
+ * @brief Inserts the break info of the updated characters into the break info of the whole text.
+ *
+ * @param[in] startIndex The first updated character.
+ * @param[in] totalNumberOfCharacters The number of characters of the text.
+ * @param[in,out] newInfo The break info of the updated characters.
+ * @param[in,out] info The break info of the whole text.
+ */
+template< typename T >
+void InsertBreakInfo( CharacterIndex startIndex,
+                      Length totalNumberOfCharacters,
+                      Vector<T>& newInfo,
+                      Vector<T>& info )
+{
+  if( newInfo.Count() < totalNumberOfCharacters )
+  {
+    info.Insert( info.Begin() + startIndex,
+                 newInfo.Begin(),
+                 newInfo.End() );
+    info.Resize( totalNumberOfCharacters );
+  }
+  else
+  {
+    info.Swap( newInfo );
+  }
+}
+
+} // namespace
+
+/**
+ * @brief Worker thread which updates the groups of paragraphs queued in the thread pool.
+ */
+class ParagraphUpdateThread : public Thread
+{
+public:
+
+  /**
+   * @brief Constructor.
+   *
+   * @param[in] threadPool The thread pool which owns this thread.
+   */
+  ParagraphUpdateThread( ParagraphUpdateThreadPool& threadPool )
+  : mThreadPool( threadPool )
+  {
+  }
+
+  /**
+   * @brief Destructor.
+   */
+  virtual ~ParagraphUpdateThread()
+  {
+  }
+
+protected:
+
+  /**
+   * @copydoc Dali::Thread::Run()
+   */
+  virtual void Run()
+  {
+    while( ParagraphGroup* group = mThreadPool.NextGroupToUpdate() )
+    {
+      UpdateParagraphGroup( *group );
+      mThreadPool.GroupUpdated();
+    }
+  }
+
+private:
+
+  // Undefined
+  ParagraphUpdateThread( const ParagraphUpdateThread& thread );
+
+  // Undefined
+  ParagraphUpdateThread& operator=( const ParagraphUpdateThread& thread );
+
+private:
+
+  ParagraphUpdateThreadPool& mThreadPool; ///< The thread pool which owns this thread.
+};
+
+unsigned int GetNumberOfParagraphUpdateThreads()
+{
+  static unsigned int numberOfThreads = 0u;
+  static bool initialized = false;
+
+  if( !initialized )
+  {
+    const char* threads = EnvironmentVariable::GetEnvironmentVariable( DALI_TEXT_UPDATE_THREADS );
+    if( NULL != threads )
+    {
+      const long value = std::strtol( threads, NULL, 10 );
+      numberOfThreads = ( value > 0 ) ? std::min( static_cast<unsigned int>( value ), MAX_NUMBER_OF_UPDATE_THREADS ) : 0u;
+    }
+    initialized = true;
+  }
+
+  return numberOfThreads;
+}
+
+ParagraphUpdateThreadPoolPtr ParagraphUpdateThreadPool::Get()
+{
+  const unsigned int numberOfThreads = GetNumberOfParagraphUpdateThreads();
+  if( 0u == numberOfThreads )
+  {
+    return ParagraphUpdateThreadPoolPtr();
+  }
+
+  if( !gThreadPool )
+  {
+    gThreadPool = new ParagraphUpdateThreadPool( numberOfThreads );
+  }
+  return ParagraphUpdateThreadPoolPtr( gThreadPool );
+}
+
+ParagraphUpdateThreadPool::ParagraphUpdateThreadPool( unsigned int numberOfThreads )
+: mGroups(),
+  mThreads(),
+  mConditionalWait(),
+  mCompletedWait(),
+  mNumberOfPendingGroups( 0u ),
+  mIsStarted( false ),
+  mIsTerminating( false )
+{
+  mThreads.reserve( numberOfThreads );
+  for( unsigned int index = 0u; index < numberOfThreads; ++index )
+  {
+    mThreads.push_back( new ParagraphUpdateThread( *this ) );
+  }
+}
+
+ParagraphUpdateThreadPool::~ParagraphUpdateThreadPool()
+{
+  if( mIsStarted )
+  {
+    {
+      // the terminating flag stops the threads from conditional wait.
+      ConditionalWait::ScopedLock lock( mConditionalWait );
+      mIsTerminating = true;
+    }
+
+    // stop the threads. Notify once per thread in case each notification wakes up only one of them.
+    for( std::vector<ParagraphUpdateThread*>::iterator it = mThreads.begin(), endIt = mThreads.end(); it != endIt; ++it )
+    {
+      mConditionalWait.Notify();
+    }
+
+    for( std::vector<ParagraphUpdateThread*>::iterator it = mThreads.begin(), endIt = mThreads.end(); it != endIt; ++it )
+    {
+      (*it)->Join();
+    }
+  }
+
+  for( std::vector<ParagraphUpdateThread*>::iterator it = mThreads.begin(), endIt = mThreads.end(); it != endIt; ++it )
+  {
+    delete *it;
+  }
+
+  gThreadPool = NULL;
+}
+
+bool ParagraphUpdateThreadPool::UpdateParagraphs( const Vector<Character>& text,
+                                                  CharacterIndex startIndex,
+                                                  Length numberOfCharacters,
+                                                  bool setLineBreakInfo,
+                                                  bool setWordBreakInfo,
+                                                  bool setScripts,
+                                                  Vector<LineBreakInfo>& lineBreakInfo,
+                                                  Vector<WordBreakInfo>& wordBreakInfo,
+                                                  Vector<ScriptRun>& scripts )
+{
+  if( !( setLineBreakInfo || setWordBreakInfo || setScripts ) )
+  {
+    return false;
+  }
+
+  // The calling thread updates a group of paragraphs as well.
+  const Length numberOfGroups = std::min( static_cast<Length>( mThreads.size() ) + 1u, numberOfCharacters / MINIMUM_NUMBER_OF_CHARACTERS_PER_GROUP );
+  if( numberOfGroups < 2u )
+  {
+    return false;
+  }
+
+  const Length totalNumberOfCharacters = text.Count();
+  const Character* const textBuffer = text.Begin();
+  const CharacterIndex lastCharacterPlusOne = startIndex + numberOfCharacters;
+  const Length numberOfCharactersPerGroup = numberOfCharacters / numberOfGroups;
+
+  // Split the characters in groups of paragraphs of similar size.
+  // The handles are retrieved in the event thread.
+  TextAbstraction::Segmentation segmentation = TextAbstraction::Segmentation::Get();
+  MultilanguageSupport multilanguageSupport = MultilanguageSupport::Get();
+
+  std::vector<ParagraphGroup> groups;
+  groups.reserve( numberOfGroups );
+
+  for( CharacterIndex index = startIndex; index < lastCharacterPlusOne; )
+  {
+    const CharacterIndex endIndex = FindParagraphEnd( textBuffer,
+                                                      std::min( index + numberOfCharactersPerGroup, lastCharacterPlusOne ) - 1u,
+                                                      lastCharacterPlusOne );
+
+    ParagraphGroup group( text, segmentation, multilanguageSupport );
+    group.characterRun.characterIndex = index;
+    group.characterRun.numberOfCharacters = endIndex - index;
+    group.setScripts = setScripts;
+    groups.push_back( group );
+
+    index = endIndex;
+  }
+
+  if( groups.size() < 2u )
+  {
+    // A single paragraph. Not worth to use a thread.
+    return false;
+  }
+
+  DALI_LOG_INFO( gLogFilter, Debug::General, "ParagraphUpdateThreadPool::UpdateParagraphs characters: %d, groups: %d\n", numberOfCharacters, static_cast<unsigned int>( groups.size() ) );
+
+  Vector<LineBreakInfo> newLineBreakInfo;
+  if( setLineBreakInfo )
+  {
+    lineBreakInfo.Resize( totalNumberOfCharacters, TextAbstraction::LINE_NO_BREAK );
+    newLineBreakInfo.Resize( numberOfCharacters );
+  }
+
+  Vector<WordBreakInfo> newWordBreakInfo;
+  if( setWordBreakInfo )
+  {
+    wordBreakInfo.Resize( totalNumberOfCharacters, TextAbstraction::WORD_NO_BREAK );
+    newWordBreakInfo.Resize( numberOfCharacters );
+  }
+
+  for( std::vector<ParagraphGroup>::iterator it = groups.begin(),
+         endIt = groups.end();
+       it != endIt;
+       ++it )
+  {
+    ParagraphGroup& group = *it;
+
+    const Length offset = group.characterRun.characterIndex - startIndex;
+    group.lineBreakInfoBuffer = setLineBreakInfo ? newLineBreakInfo.Begin() + offset : NULL;
+    group.wordBreakInfoBuffer = setWordBreakInfo ? newWordBreakInfo.Begin() + offset : NULL;
+  }
+
+  if( !mIsStarted )
+  {
+    for( std::vector<ParagraphUpdateThread*>::iterator it = mThreads.begin(), endIt = mThreads.end(); it != endIt; ++it )
+    {
+      (*it)->Start();
+    }
+    mIsStarted = true;
+  }
+
+  // Queue all the groups but the first one, which is updated in this thread while the other ones are updated by the worker threads.
+  {
+    ConditionalWait::ScopedLock lock( mCompletedWait );
+    mNumberOfPendingGroups = groups.size() - 1u;
+  }
+
+  {
+    ConditionalWait::ScopedLock lock( mConditionalWait );
+    for( std::vector<ParagraphGroup>::iterator it = groups.begin() + 1u,
+           endIt = groups.end();
+         it != endIt;
+         ++it )
+    {
+      mGroups.push_back( &( *it ) );
+    }
+  }
+
+  // Notify once per group in case each notification wakes up only one thread.
+  for( std::vector<ParagraphGroup>::const_iterator it = groups.begin() + 1u,
+         endIt = groups.end();
+       it != endIt;
+       ++it )
+  {
+    mConditionalWait.Notify();
+  }
+
+  UpdateParagraphGroup( groups.front() );
+
+  {
+    // Wait for the worker threads.
+    ConditionalWait::ScopedLock lock( mCompletedWait );
+    while( 0u != mNumberOfPendingGroups )
+    {
+      mCompletedWait.Wait( lock );
+    }
+  }
+
+  // Merge the results.
+  if( setLineBreakInfo )
+  {
+    InsertBreakInfo( startIndex, totalNumberOfCharacters, newLineBreakInfo, lineBreakInfo );
+  }
+
+  if( setWordBreakInfo )
+  {
+    InsertBreakInfo( startIndex, totalNumberOfCharacters, newWordBreakInfo, wordBreakInfo );
+  }
+
+  if( setScripts )
+  {
+    // Find the first index where to insert the scripts.
+    ScriptRunIndex scriptIndex = FindFirstCharacterRun( scripts, startIndex );
+
+    CharacterIndex nextCharacterIndex = startIndex;
+    for( std::vector<ParagraphGroup>::const_iterator it = groups.begin(),
+           endIt = groups.end();
+         it != endIt;
+         ++it )
+    {
+      const Vector<ScriptRun>& groupScripts = it->scripts;
+
+      scripts.Insert( scripts.Begin() + scriptIndex,
+                      groupScripts.Begin(),
+                      groupScripts.End() );
+      scriptIndex += groupScripts.Count();
+      nextCharacterIndex += it->characterRun.numberOfCharacters;
+    }
+
+    // Update the indices of the next script runs.
+    for( Vector<ScriptRun>::Iterator it = scripts.Begin() + scriptIndex,
+           endIt = scripts.End();
+         it != endIt;
+         ++it )
+    {
+      ScriptRun& run = *it;
+      run.characterRun.characterIndex = nextCharacterIndex;
+      nextCharacterIndex += run.characterRun.numberOfCharacters;
+    }
+  }
+
+  return true;
+}
+
+unsigned int ParagraphUpdateThreadPool::GetNumberOfThreads() const
+{
+  return mThreads.size();
+}
+
+ParagraphGroup* ParagraphUpdateThreadPool::NextGroupToUpdate()
+{
+  // Lock while popping the group out from the queue
+  ConditionalWait::ScopedLock lock( mConditionalWait );
+
+  while( !mIsTerminating )
+  {
+    if( !mGroups.empty() )
+    {
+      ParagraphGroup* nextGroup = mGroups.front();
+      mGroups.pop_front();
+      return nextGroup;
+    }
+
+    mConditionalWait.Wait( lock );
+  }
+
+  return NULL;
+}
+
+void ParagraphUpdateThreadPool::GroupUpdated()
+{
+  {
+    ConditionalWait::ScopedLock lock( mCompletedWait );
+    --mNumberOfPendingGroups;
+  }
+
+  // wake up the calling thread
+  mCompletedWait.Notify();
+}
+
+} // namespace Text
+
+} // namespace Toolkit
+
+} // namespace Dali
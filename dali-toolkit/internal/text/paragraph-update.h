@@ -0,0 +1,168 @@
+#ifndef __DALI_TOOLKIT_TEXT_PARAGRAPH_UPDATE_H__
+#define __DALI_TOOLKIT_TEXT_PARAGRAPH_UPDATE_H__
+
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <deque>
+#include <dali/public-api/common/dali-vector.h>
+#include <dali/public-api/common/intrusive-ptr.h>
+#include <dali/public-api/common/vector-wrapper.h>
+#include <dali/public-api/object/ref-object.h>
+#include <dali/devel-api/threading/conditional-wait.h>
+
+// INTERNAL INCLUDES
+#include <dali-toolkit/internal/text/script-run.h>
+#include <dali-toolkit/internal/text/text-definitions.h>
+
+namespace Dali
+{
+
+namespace Toolkit
+{
+
+namespace Text
+{
+
+struct ParagraphGroup;
+class ParagraphUpdateThread;
+class ParagraphUpdateThreadPool;
+typedef IntrusivePtr< ParagraphUpdateThreadPool > ParagraphUpdateThreadPoolPtr;
+
+/**
+ * @brief Retrieves the number of worker threads used to update the paragraphs of a text in parallel.
+ *
+ * It's set with the DALI_TEXT_UPDATE_THREADS environment variable. By default is zero and the text is updated
+ * in the event thread only.
+ *
+ * @return The number of worker threads.
+ */
+unsigned int GetNumberOfParagraphUpdateThreads();
+
+/**
+ * @brief The worker threads which update the paragraphs of the large texts in parallel.
+ *
+ * There is one pool shared by all the text controllers. It's created with the first controller and deleted with the last one.
+ * The worker threads are started with the first update and they wait for the next one afterwards.
+ */
+class ParagraphUpdateThreadPool : public RefObject
+{
+public:
+
+  /**
+   * @brief Retrieves the thread pool shared by all the text controllers. It's created if there isn't one. Called by the event thread.
+   *
+   * @return The thread pool, or an empty pointer if the parallel update is disabled.
+   */
+  static ParagraphUpdateThreadPoolPtr Get();
+
+  /**
+   * @brief Sets the line break info, the word break info and the scripts of a large text in parallel.
+   *
+   * The characters to update are split in groups of whole paragraphs. Each group is processed either by
+   * a worker thread or by the calling thread and the results are merged afterwards.
+   *
+   * The font validation, the bidirectional info and the shaping are not done here as the font client,
+   * the shaper and the bidirectional support keep state which is not thread safe.
+   *
+   * Nothing is done if the number of characters is too small or if they are a single paragraph.
+   *
+   * @param[in] text Vector of UTF-32 characters.
+   * @param[in] startIndex The first character to update. It must be the first character of a paragraph.
+   * @param[in] numberOfCharacters The number of characters to update.
+   * @param[in] setLineBreakInfo Whether to set the line break info.
+   * @param[in] setWordBreakInfo Whether to set the word break info.
+   * @param[in] setScripts Whether to set the scripts.
+   * @param[in,out] lineBreakInfo The line break info.
+   * @param[in,out] wordBreakInfo The word break info.
+   * @param[in,out] scripts Vector containing the script runs for the whole text.
+   *
+   * @return @e true if the text has been updated.
+   */
+  bool UpdateParagraphs( const Vector<Character>& text,
+                         CharacterIndex startIndex,
+                         Length numberOfCharacters,
+                         bool setLineBreakInfo,
+                         bool setWordBreakInfo,
+                         bool setScripts,
+                         Vector<LineBreakInfo>& lineBreakInfo,
+                         Vector<WordBreakInfo>& wordBreakInfo,
+                         Vector<ScriptRun>& scripts );
+
+  /**
+   * @brief Retrieves the number of worker threads.
+   */
+  unsigned int GetNumberOfThreads() const;
+
+protected:
+
+  /**
+   * @brief A reference counted object may only be deleted by calling Unreference().
+   * Terminates and joins the worker threads.
+   */
+  virtual ~ParagraphUpdateThreadPool();
+
+private:
+
+  friend class ParagraphUpdateThread;
+
+  /**
+   * @brief Constructor.
+   *
+   * @param[in] numberOfThreads The number of worker threads.
+   */
+  ParagraphUpdateThreadPool( unsigned int numberOfThreads );
+
+  /**
+   * @brief Pops the next group of paragraphs out from the queue, called by the worker threads.
+   *
+   * @return The next group to update or NULL if the threads are terminated.
+   */
+  ParagraphGroup* NextGroupToUpdate();
+
+  /**
+   * @brief Wakes up the calling thread when all the groups queued have been updated, called by the worker threads.
+   */
+  void GroupUpdated();
+
+  // Undefined
+  ParagraphUpdateThreadPool( const ParagraphUpdateThreadPool& threadPool );
+
+  // Undefined
+  ParagraphUpdateThreadPool& operator=( const ParagraphUpdateThreadPool& threadPool );
+
+private:
+
+  std::deque<ParagraphGroup*>         mGroups;                 ///< The groups waiting to be updated by the worker threads.
+  std::vector<ParagraphUpdateThread*> mThreads;                ///< The worker threads.
+
+  ConditionalWait                     mConditionalWait;        ///< Locks the queue and wakes up the worker threads.
+  ConditionalWait                     mCompletedWait;          ///< Locks the number of groups being updated and wakes up the calling thread.
+  unsigned int                        mNumberOfPendingGroups;  ///< The number of groups queued which haven't been updated yet.
+
+  bool                                mIsStarted;
+  bool                                mIsTerminating;
+};
+
+} // namespace Text
+
+} // namespace Toolkit
+
+} // namespace Dali
+
+#endif // __DALI_TOOLKIT_TEXT_PARAGRAPH_UPDATE_H__
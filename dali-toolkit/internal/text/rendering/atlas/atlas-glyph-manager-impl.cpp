@@ -18,11 +18,15 @@
 #include <dali-toolkit/internal/text/rendering/atlas/atlas-glyph-manager-impl.h>
 
 // EXTERNAL INCLUDES
+#include <algorithm>
 #include <dali/integration-api/debug.h>
 
 namespace
 {
 
+const uint32_t INITIAL_GLYPH_RECORD_TABLE_SIZE = 256u; ///< Must be a power of two.
+const uint32_t MIN_STALE_UNREFERENCED_GLYPHS = 64u;    ///< The list of unreferenced glyphs is compacted when it has more stale entries than valid ones, and at least this number.
+
 #if defined(DEBUG_ENABLED)
   Debug::Filter* gLogFilter = Debug::Filter::New(Debug::Concise, true, "LOG_TEXT_RENDERING");
 #endif
@@ -70,6 +74,51 @@ void main()
 }
 );
 
+/**
+ * @brief An unreferenced glyph which may be evicted.
+ */
+struct EvictionCandidate
+{
+  Dali::Toolkit::Text::FontId fontId;
+  Dali::Toolkit::Text::GlyphIndex index;
+  uint32_t atlasId;
+};
+
+/**
+ * @brief An atlas which only stores unreferenced glyphs.
+ */
+struct AtlasUsage
+{
+  uint32_t atlasId;
+  uint32_t lastUse;             ///< The most recent time stamp of the unreferenced glyphs
+
+  bool operator<( const AtlasUsage& rhs ) const
+  {
+    return lastUse < rhs.lastUse;
+  }
+};
+
+/**
+ * @brief Hashes a ( font id, glyph index ) pair.
+ *
+ * @param[in] fontId The font id.
+ * @param[in] index The glyph index.
+ *
+ * @return The hash value.
+ */
+inline uint32_t HashGlyph( Dali::Toolkit::Text::FontId fontId, Dali::Toolkit::Text::GlyphIndex index )
+{
+  // Mix both values with the 64 bit finalizer of MurmurHash3.
+  uint64_t key = ( static_cast<uint64_t>( fontId ) << 32u ) | static_cast<uint64_t>( index );
+  key ^= key >> 33u;
+  key *= 0xff51afd7ed558ccdULL;
+  key ^= key >> 33u;
+  key *= 0xc4ceb9fe1a85ec53ULL;
+  key ^= key >> 33u;
+
+  return static_cast<uint32_t>( key );
+}
+
 } // unnamed namespace
 
 namespace Dali
@@ -82,10 +131,21 @@ namespace Internal
 {
 
 AtlasGlyphManager::AtlasGlyphManager()
+: mGlyphRecordCount( 0u ),
+  mUnreferencedGlyphCount( 0u ),
+  mUseStamp( 0u ),
+  mMemoryBudget( 0u ),
+  mMemoryBudgetExceeded( false )
 {
+  GlyphRecordEntry emptyRecord = { 0u, 0u, 0u, 0, 0u };
+  mGlyphRecords.Resize( INITIAL_GLYPH_RECORD_TABLE_SIZE, emptyRecord );
+
   mShaderL8 = Shader::New( VERTEX_SHADER, FRAGMENT_SHADER_L8 );
   mShaderRgba = Shader::New( VERTEX_SHADER, FRAGMENT_SHADER_RGBA );
   mAtlasManager = Dali::Toolkit::AtlasManager::New();
+
+  // Glyphs have very different sizes, so each one uses an area of its own size rather than a block sized to the largest glyph.
+  mAtlasManager.SetPackingMode( Toolkit::AtlasManager::PACK_VARIABLE_SIZE );
 }
 
 void AtlasGlyphManager::Add( const Text::GlyphInfo& glyph,
@@ -94,41 +154,47 @@ void AtlasGlyphManager::Add( const Text::GlyphInfo& glyph,
 {
   DALI_LOG_INFO( gLogFilter, Debug::General, "Added glyph, font: %d index: %d\n", glyph.fontId, glyph.index );
 
-  if ( mAtlasManager.Add( bitmap, slot ) )
+  slot.mImageId = 0u;
+  if( mMemoryBudgetExceeded && ( 0u != mUnreferencedGlyphCount ) )
+  {
+    // Over budget: reuse the areas of the least recently used glyphs before another atlas is created.
+    // Only as many glyphs as needed for the new one to fit are evicted.
+    mAtlasManager.SetAddPolicy( Toolkit::AtlasManager::FAIL_ON_ADD_FAILS );
+    mAtlasManager.Add( bitmap, slot );
+    while( ( 0u == slot.mImageId ) && mMemoryBudgetExceeded && EvictLeastRecentlyUsedGlyph() )
+    {
+      mAtlasManager.Add( bitmap, slot );
+    }
+    mAtlasManager.SetAddPolicy( Toolkit::AtlasManager::FAIL_ON_ADD_CREATES );
+  }
+
+  if( ( 0u == slot.mImageId ) && mAtlasManager.Add( bitmap, slot ) )
   {
     // A new atlas was created so set the texture set details for the atlas
     Dali::Texture atlas = mAtlasManager.GetAtlasContainer( slot.mAtlasId );
     TextureSet textureSet = TextureSet::New();
     textureSet.SetTexture( 0u, atlas );
     mAtlasManager.SetTextures( slot.mAtlasId, textureSet );
+
+    // The unreferenced glyphs are evicted the next time a glyph stops being used or doesn't fit.
+    mMemoryBudgetExceeded = ( 0u != mMemoryBudget ) && ( mAtlasManager.GetTextureMemoryUsed() > mMemoryBudget );
+  }
+
+  if( 0u == slot.mImageId )
+  {
+    // The glyph couldn't be placed in an atlas.
+    return;
   }
 
   GlyphRecordEntry record;
+  record.mFontId = glyph.fontId;
   record.mIndex = glyph.index;
   record.mImageId = slot.mImageId;
   record.mCount = 1;
+  record.mLastUse = 0u;
 
-  // Have glyph records been created for this fontId ?
-  bool foundGlyph = false;
-  for ( std::vector< FontGlyphRecord >::iterator fontGlyphRecordIt = mFontGlyphRecords.begin();
-        fontGlyphRecordIt != mFontGlyphRecords.end(); ++fontGlyphRecordIt )
-  {
-    if ( fontGlyphRecordIt->mFontId == glyph.fontId )
-    {
-      fontGlyphRecordIt->mGlyphRecords.PushBack( record );
-      foundGlyph = true;
-      break;
-    }
-  }
-
-  if ( !foundGlyph )
-  {
-    // We need to add a new font entry
-    FontGlyphRecord fontGlyphRecord;
-    fontGlyphRecord.mFontId = glyph.fontId;
-    fontGlyphRecord.mGlyphRecords.PushBack( record );
-    mFontGlyphRecords.push_back( fontGlyphRecord );
-  }
+  InsertGlyphRecord( record );
+  AdjustReferencedGlyphCount( slot.mImageId, 1 );
 }
 
 void AtlasGlyphManager::GenerateMeshData( uint32_t imageId,
@@ -143,25 +209,16 @@ bool AtlasGlyphManager::IsCached( Text::FontId fontId,
                                 Text::GlyphIndex index,
                                 Dali::Toolkit::AtlasManager::AtlasSlot& slot )
 {
-  for ( std::vector< FontGlyphRecord >::iterator fontGlyphRecordIt = mFontGlyphRecords.begin();
-        fontGlyphRecordIt != mFontGlyphRecords.end();
-        ++fontGlyphRecordIt )
+  const GlyphRecordEntry* const record = FindGlyphRecord( fontId, index );
+  if( NULL != record )
   {
-    if ( fontGlyphRecordIt->mFontId == fontId )
-    {
-      for ( Vector< GlyphRecordEntry >::Iterator glyphRecordIt = fontGlyphRecordIt->mGlyphRecords.Begin();
-            glyphRecordIt != fontGlyphRecordIt->mGlyphRecords.End();
-            ++glyphRecordIt )
-      {
-        if ( glyphRecordIt->mIndex == index )
-        {
-          slot.mImageId = glyphRecordIt->mImageId;
-          slot.mAtlasId = mAtlasManager.GetAtlas( slot.mImageId );
-          return true;
-        }
-      }
-    }
+    ++mMetrics.mCacheHits;
+    slot.mImageId = record->mImageId;
+    slot.mAtlasId = mAtlasManager.GetAtlas( slot.mImageId );
+    return true;
   }
+
+  ++mMetrics.mCacheMisses;
   slot.mImageId = 0;
   return false;
 }
@@ -191,23 +248,20 @@ const Toolkit::AtlasGlyphManager::Metrics& AtlasGlyphManager::GetMetrics()
 {
   std::ostringstream verboseMetrics;
 
-  mMetrics.mGlyphCount = 0u;
-  for ( std::vector< FontGlyphRecord >::iterator fontGlyphRecordIt = mFontGlyphRecords.begin();
-        fontGlyphRecordIt != mFontGlyphRecords.end();
-        ++fontGlyphRecordIt )
+  mMetrics.mGlyphCount = mGlyphRecordCount;
+  for( Vector< GlyphRecordEntry >::ConstIterator it = mGlyphRecords.Begin(),
+         endIt = mGlyphRecords.End();
+       it != endIt;
+       ++it )
   {
-    mMetrics.mGlyphCount += fontGlyphRecordIt->mGlyphRecords.Size();
-
-    verboseMetrics << "[FontId " << fontGlyphRecordIt->mFontId << " Glyph ";
-    for ( Vector< GlyphRecordEntry >::Iterator glyphRecordEntryIt = fontGlyphRecordIt->mGlyphRecords.Begin();
-          glyphRecordEntryIt != fontGlyphRecordIt->mGlyphRecords.End();
-          ++glyphRecordEntryIt )
+    if( 0u != it->mImageId )
     {
-      verboseMetrics << glyphRecordEntryIt->mIndex << "(" << glyphRecordEntryIt->mCount << ") ";
+      verboseMetrics << "[FontId " << it->mFontId << " Glyph " << it->mIndex << "(" << it->mCount << ")] ";
     }
-    verboseMetrics << "] ";
   }
   mMetrics.mVerboseGlyphCounts = verboseMetrics.str();
+  mMetrics.mUnreferencedGlyphCount = mUnreferencedGlyphCount;
+  mMetrics.mMemoryBudget = mMemoryBudget;
 
   mAtlasManager.GetMetrics( mMetrics.mAtlasMetrics );
 
@@ -220,30 +274,36 @@ void AtlasGlyphManager::AdjustReferenceCount( Text::FontId fontId, Text::GlyphIn
   {
     DALI_LOG_INFO( gLogFilter, Debug::General, "AdjustReferenceCount %d, font: %d index: %d\n", delta, fontId, index );
 
-    for ( std::vector< FontGlyphRecord >::iterator fontGlyphRecordIt = mFontGlyphRecords.begin();
-          fontGlyphRecordIt != mFontGlyphRecords.end();
-          ++fontGlyphRecordIt )
+    GlyphRecordEntry* const record = FindGlyphRecord( fontId, index );
+    if( NULL != record )
     {
-      if ( fontGlyphRecordIt->mFontId == fontId )
+      if( 0 == record->mCount )
       {
-        for ( Vector< GlyphRecordEntry >::Iterator glyphRecordIt = fontGlyphRecordIt->mGlyphRecords.Begin();
-              glyphRecordIt != fontGlyphRecordIt->mGlyphRecords.End();
-              ++glyphRecordIt )
+        // An unreferenced glyph is used again. Its entry in the list of unreferenced glyphs becomes stale.
+        --mUnreferencedGlyphCount;
+        AdjustReferencedGlyphCount( record->mImageId, 1 );
+      }
+
+      record->mCount += delta;
+      DALI_ASSERT_DEBUG( record->mCount >= 0 && "Glyph ref-count should not be negative" );
+
+      if( record->mCount <= 0 )
+      {
+        AdjustReferencedGlyphCount( record->mImageId, -1 );
+
+        if( 0u == mMemoryBudget )
+        {
+          EvictGlyph( static_cast<uint32_t>( record - mGlyphRecords.Begin() ) );
+        }
+        else
         {
-          if ( glyphRecordIt->mIndex == index )
-          {
-            glyphRecordIt->mCount += delta;
-            DALI_ASSERT_DEBUG( glyphRecordIt->mCount >= 0 && "Glyph ref-count should not be negative" );
-
-            if ( !glyphRecordIt->mCount )
-            {
-              mAtlasManager.Remove( glyphRecordIt->mImageId );
-              fontGlyphRecordIt->mGlyphRecords.Remove( glyphRecordIt );
-            }
-            return;
-          }
+          // Keep the glyph cached in case it's used again.
+          record->mCount = 0;
+          PushUnreferencedGlyph( *record );
+          EnforceMemoryBudget();
         }
       }
+      return;
     }
 
     // Should not arrive here
@@ -251,6 +311,34 @@ void AtlasGlyphManager::AdjustReferenceCount( Text::FontId fontId, Text::GlyphIn
   }
 }
 
+void AtlasGlyphManager::SetMemoryBudget( uint32_t budget )
+{
+  mMemoryBudget = budget;
+  mMemoryBudgetExceeded = ( 0u != mMemoryBudget ) && ( mAtlasManager.GetTextureMemoryUsed() > mMemoryBudget );
+
+  if( 0u == mMemoryBudget )
+  {
+    // Without budget the glyphs are not kept cached once unused.
+    for( std::deque< UnreferencedGlyph >::const_iterator it = mUnreferencedGlyphs.begin(),
+           endIt = mUnreferencedGlyphs.end();
+         it != endIt;
+         ++it )
+    {
+      GlyphRecordEntry* const record = FindUnreferencedGlyphRecord( *it );
+      if( NULL != record )
+      {
+        --mUnreferencedGlyphCount;
+        EvictGlyph( static_cast<uint32_t>( record - mGlyphRecords.Begin() ) );
+      }
+    }
+    mUnreferencedGlyphs.clear();
+  }
+  else
+  {
+    EnforceMemoryBudget();
+  }
+}
+
 TextureSet AtlasGlyphManager::GetTextures( uint32_t atlasId ) const
 {
   return mAtlasManager.GetTextures( atlasId );
@@ -262,6 +350,246 @@ Shader AtlasGlyphManager::GetShader( uint32_t atlasId ) const
   return pixelFormat == Pixel::L8 ? mShaderL8 : mShaderRgba;
 }
 
+AtlasGlyphManager::GlyphRecordEntry* AtlasGlyphManager::FindGlyphRecord( Text::FontId fontId, Text::GlyphIndex index )
+{
+  const uint32_t mask = mGlyphRecords.Count() - 1u;
+  GlyphRecordEntry* const recordsBuffer = mGlyphRecords.Begin();
+
+  // The load factor is kept below one so the probe always finds a free slot.
+  for( uint32_t slotIndex = HashGlyph( fontId, index ) & mask; ; slotIndex = ( slotIndex + 1u ) & mask )
+  {
+    GlyphRecordEntry& record = *( recordsBuffer + slotIndex );
+    if( 0u == record.mImageId )
+    {
+      return NULL;
+    }
+
+    if( ( record.mFontId == fontId ) && ( record.mIndex == index ) )
+    {
+      return &record;
+    }
+  }
+}
+
+void AtlasGlyphManager::InsertGlyphRecord( const GlyphRecordEntry& record )
+{
+  // Keep the load factor under 3/4.
+  if( 4u * ( mGlyphRecordCount + 1u ) > 3u * mGlyphRecords.Count() )
+  {
+    GrowGlyphRecordTable();
+  }
+
+  const uint32_t mask = mGlyphRecords.Count() - 1u;
+  GlyphRecordEntry* const recordsBuffer = mGlyphRecords.Begin();
+
+  uint32_t slotIndex = HashGlyph( record.mFontId, record.mIndex ) & mask;
+  while( 0u != ( recordsBuffer + slotIndex )->mImageId )
+  {
+    slotIndex = ( slotIndex + 1u ) & mask;
+  }
+
+  *( recordsBuffer + slotIndex ) = record;
+  ++mGlyphRecordCount;
+}
+
+void AtlasGlyphManager::RemoveGlyphRecord( uint32_t slotIndex )
+{
+  const uint32_t mask = mGlyphRecords.Count() - 1u;
+  GlyphRecordEntry* const recordsBuffer = mGlyphRecords.Begin();
+
+  ( recordsBuffer + slotIndex )->mImageId = 0u;
+  --mGlyphRecordCount;
+
+  // Shift back the records of the same probe sequence which can't be reached anymore through the freed slot.
+  uint32_t freeIndex = slotIndex;
+  for( uint32_t nextIndex = ( freeIndex + 1u ) & mask; 0u != ( recordsBuffer + nextIndex )->mImageId; nextIndex = ( nextIndex + 1u ) & mask )
+  {
+    const GlyphRecordEntry& record = *( recordsBuffer + nextIndex );
+    const uint32_t homeIndex = HashGlyph( record.mFontId, record.mIndex ) & mask;
+
+    // Whether the home slot of the record is cyclically within ( freeIndex, nextIndex ].
+    const bool reachable = ( freeIndex <= nextIndex ) ? ( ( freeIndex < homeIndex ) && ( homeIndex <= nextIndex ) ) :
+                                                        ( ( freeIndex < homeIndex ) || ( homeIndex <= nextIndex ) );
+    if( !reachable )
+    {
+      *( recordsBuffer + freeIndex ) = record;
+      ( recordsBuffer + nextIndex )->mImageId = 0u;
+      freeIndex = nextIndex;
+    }
+  }
+}
+
+void AtlasGlyphManager::GrowGlyphRecordTable()
+{
+  Vector< GlyphRecordEntry > oldRecords;
+  oldRecords.Swap( mGlyphRecords );
+
+  GlyphRecordEntry emptyRecord = { 0u, 0u, 0u, 0, 0u };
+  mGlyphRecords.Resize( 2u * oldRecords.Count(), emptyRecord );
+  mGlyphRecordCount = 0u;
+
+  for( Vector< GlyphRecordEntry >::ConstIterator it = oldRecords.Begin(),
+         endIt = oldRecords.End();
+       it != endIt;
+       ++it )
+  {
+    if( 0u != it->mImageId )
+    {
+      InsertGlyphRecord( *it );
+    }
+  }
+}
+
+void AtlasGlyphManager::EvictGlyph( uint32_t slotIndex )
+{
+  const uint32_t imageId = ( mGlyphRecords.Begin() + slotIndex )->mImageId;
+  const uint32_t atlasId = mAtlasManager.GetAtlas( imageId );
+
+  mAtlasManager.Remove( imageId );
+  RemoveGlyphRecord( slotIndex );
+
+  if( ( 0u != mMemoryBudget ) && mAtlasManager.ReleaseAtlas( atlasId ) )
+  {
+    ++mMetrics.mReleasedAtlasCount;
+    mMemoryBudgetExceeded = mAtlasManager.GetTextureMemoryUsed() > mMemoryBudget;
+  }
+}
+
+AtlasGlyphManager::GlyphRecordEntry* AtlasGlyphManager::FindUnreferencedGlyphRecord( const UnreferencedGlyph& glyph )
+{
+  GlyphRecordEntry* const record = FindGlyphRecord( glyph.mFontId, glyph.mIndex );
+  if( ( NULL != record ) && ( 0 == record->mCount ) && ( glyph.mLastUse == record->mLastUse ) )
+  {
+    return record;
+  }
+
+  return NULL;
+}
+
+void AtlasGlyphManager::PushUnreferencedGlyph( GlyphRecordEntry& record )
+{
+  record.mLastUse = ++mUseStamp;
+  ++mUnreferencedGlyphCount;
+
+  UnreferencedGlyph glyph = { record.mFontId, record.mIndex, record.mLastUse };
+  mUnreferencedGlyphs.push_back( glyph );
+
+  if( mUnreferencedGlyphs.size() > 2u * mUnreferencedGlyphCount + MIN_STALE_UNREFERENCED_GLYPHS )
+  {
+    // Remove the stale entries, keeping the order.
+    std::deque< UnreferencedGlyph > unreferencedGlyphs;
+    for( std::deque< UnreferencedGlyph >::const_iterator it = mUnreferencedGlyphs.begin(),
+           endIt = mUnreferencedGlyphs.end();
+         it != endIt;
+         ++it )
+    {
+      if( NULL != FindUnreferencedGlyphRecord( *it ) )
+      {
+        unreferencedGlyphs.push_back( *it );
+      }
+    }
+    mUnreferencedGlyphs.swap( unreferencedGlyphs );
+  }
+}
+
+bool AtlasGlyphManager::EvictLeastRecentlyUsedGlyph()
+{
+  while( !mUnreferencedGlyphs.empty() )
+  {
+    GlyphRecordEntry* const record = FindUnreferencedGlyphRecord( mUnreferencedGlyphs.front() );
+    mUnreferencedGlyphs.pop_front();
+
+    if( NULL != record )
+    {
+      --mUnreferencedGlyphCount;
+      ++mMetrics.mEvictedGlyphCount;
+      EvictGlyph( static_cast<uint32_t>( record - mGlyphRecords.Begin() ) );
+      return true;
+    }
+  }
+
+  return false;
+}
+
+void AtlasGlyphManager::AdjustReferencedGlyphCount( uint32_t imageId, int32_t delta )
+{
+  const uint32_t atlasId = mAtlasManager.GetAtlas( imageId );
+  if( atlasId > mReferencedGlyphCounts.Count() )
+  {
+    mReferencedGlyphCounts.Resize( atlasId, 0u );
+  }
+
+  *( mReferencedGlyphCounts.Begin() + atlasId - 1u ) += delta;
+}
+
+void AtlasGlyphManager::EnforceMemoryBudget()
+{
+  if( !mMemoryBudgetExceeded || ( 0u == mUnreferencedGlyphCount ) )
+  {
+    return;
+  }
+
+  // Gather the unreferenced glyphs of the atlases without referenced glyphs, least recently used first.
+  Vector< EvictionCandidate > candidates;
+  Vector< uint32_t > atlasLastUses;
+  atlasLastUses.Resize( mReferencedGlyphCounts.Count(), 0u );
+
+  for( std::deque< UnreferencedGlyph >::const_iterator it = mUnreferencedGlyphs.begin(),
+         endIt = mUnreferencedGlyphs.end();
+       it != endIt;
+       ++it )
+  {
+    const GlyphRecordEntry* const record = FindUnreferencedGlyphRecord( *it );
+    if( NULL == record )
+    {
+      continue;
+    }
+
+    const uint32_t atlasId = mAtlasManager.GetAtlas( record->mImageId );
+    if( 0u == *( mReferencedGlyphCounts.Begin() + atlasId - 1u ) )
+    {
+      *( atlasLastUses.Begin() + atlasId - 1u ) = it->mLastUse;
+
+      EvictionCandidate candidate = { it->mFontId, it->mIndex, atlasId };
+      candidates.PushBack( candidate );
+    }
+  }
+
+  Vector< AtlasUsage > atlases;
+  for( uint32_t index = 0u; index < atlasLastUses.Count(); ++index )
+  {
+    const uint32_t lastUse = *( atlasLastUses.Begin() + index );
+    if( 0u != lastUse )
+    {
+      AtlasUsage usage = { index + 1u, lastUse };
+      atlases.PushBack( usage );
+    }
+  }
+
+  // Only releasing an atlas reduces the memory used. Release the least recently used first.
+  std::sort( atlases.Begin(), atlases.End() );
+
+  for( Vector< AtlasUsage >::ConstIterator atlasIt = atlases.Begin(),
+         atlasEndIt = atlases.End();
+       ( atlasIt != atlasEndIt ) && mMemoryBudgetExceeded;
+       ++atlasIt )
+  {
+    for( Vector< EvictionCandidate >::ConstIterator it = candidates.Begin(),
+           endIt = candidates.End();
+         it != endIt;
+         ++it )
+    {
+      if( it->atlasId == atlasIt->atlasId )
+      {
+        GlyphRecordEntry* const record = FindGlyphRecord( it->fontId, it->index );
+        --mUnreferencedGlyphCount;
+        ++mMetrics.mEvictedGlyphCount;
+        EvictGlyph( static_cast<uint32_t>( record - mGlyphRecords.Begin() ) );
+      }
+    }
+  }
+}
+
 AtlasGlyphManager::~AtlasGlyphManager()
 {
   // mAtlasManager handle is automatically released here
@@ -19,6 +19,7 @@
 
 
 // EXTERNAL INCLUDES
+#include <deque>
 #include <dali/public-api/common/vector-wrapper.h>
 #include <dali/public-api/object/base-object.h>
 
@@ -48,17 +49,31 @@ class AtlasGlyphManager : public Dali::BaseObject
 {
 public:
 
+  /**
+   * @brief An entry of the glyph record table.
+   *
+   * A slot of the table is free when its image id is zero. A glyph with a zero reference count
+   * is kept cached until it's evicted to honour the memory budget.
+   */
   struct GlyphRecordEntry
   {
+    Text::FontId mFontId;
     Text::GlyphIndex mIndex;
     uint32_t mImageId;
     int32_t mCount;
+    uint32_t mLastUse;    ///< The time stamp of the last time the glyph became unreferenced
   };
 
-  struct FontGlyphRecord
+  /**
+   * @brief An entry of the list of unreferenced glyphs.
+   *
+   * The entry is stale if the glyph has been evicted or used again since, i.e. its record doesn't have the same time stamp.
+   */
+  struct UnreferencedGlyph
   {
     Text::FontId mFontId;
-    Vector< GlyphRecordEntry > mGlyphRecords;
+    Text::GlyphIndex mIndex;
+    uint32_t mLastUse;    ///< The time stamp of the glyph when it became unreferenced
   };
 
   /**
@@ -122,6 +137,11 @@ public:
    */
   const Toolkit::AtlasGlyphManager::Metrics& GetMetrics();
 
+  /**
+   * @copydoc Toolkit::AtlasGlyphManager::SetMemoryBudget
+   */
+  void SetMemoryBudget( uint32_t budget );
+
 protected:
 
   /**
@@ -129,10 +149,100 @@ protected:
    */
   virtual ~AtlasGlyphManager();
 
+private:
+
+  /**
+   * @brief Retrieves the record of a cached glyph.
+   *
+   * @param[in] fontId The font of the glyph.
+   * @param[in] index The index of the glyph within the font.
+   *
+   * @return A pointer to the record or NULL if the glyph is not cached.
+   */
+  GlyphRecordEntry* FindGlyphRecord( Text::FontId fontId, Text::GlyphIndex index );
+
+  /**
+   * @brief Inserts a new record in the glyph record table.
+   *
+   * The table is grown if the load factor is exceeded.
+   *
+   * @param[in] record The record to insert.
+   */
+  void InsertGlyphRecord( const GlyphRecordEntry& record );
+
+  /**
+   * @brief Removes the record stored in the given slot of the glyph record table.
+   *
+   * Records which follow in the probe sequence are shifted back so no tombstones are needed.
+   *
+   * @param[in] slotIndex The index of the slot within the table.
+   */
+  void RemoveGlyphRecord( uint32_t slotIndex );
+
+  /**
+   * @brief Doubles the capacity of the glyph record table and re-inserts all the records.
+   */
+  void GrowGlyphRecordTable();
+
+  /**
+   * @brief Removes a glyph from its atlas and from the glyph record table.
+   *
+   * If the memory budget is set, the atlas is released when it doesn't store any glyph anymore.
+   *
+   * @param[in] slotIndex The index of the glyph's slot within the table.
+   */
+  void EvictGlyph( uint32_t slotIndex );
+
+  /**
+   * @brief Retrieves the record of the glyph of an entry of the list of unreferenced glyphs.
+   *
+   * @param[in] glyph The entry of the list.
+   *
+   * @return A pointer to the record or NULL if the entry is stale.
+   */
+  GlyphRecordEntry* FindUnreferencedGlyphRecord( const UnreferencedGlyph& glyph );
+
+  /**
+   * @brief Adds a glyph which has just become unreferenced at the end of the list of unreferenced glyphs.
+   *
+   * @param[in,out] record The record of the glyph.
+   */
+  void PushUnreferencedGlyph( GlyphRecordEntry& record );
+
+  /**
+   * @brief Evicts the least recently used unreferenced glyph.
+   *
+   * @return @e true if a glyph has been evicted, @e false if there are no unreferenced glyphs.
+   */
+  bool EvictLeastRecentlyUsedGlyph();
+
+  /**
+   * @brief Updates the number of referenced glyphs stored in an atlas.
+   *
+   * @param[in] imageId The image id of the glyph.
+   * @param[in] delta The change in the number of referenced glyphs.
+   */
+  void AdjustReferencedGlyphCount( uint32_t imageId, int32_t delta );
+
+  /**
+   * @brief Releases the atlases which only store unreferenced glyphs while the texture memory used exceeds the budget.
+   *
+   * The least recently used atlas is released first. The glyphs of the other atlases are
+   * only evicted when a new glyph doesn't fit in the atlases, see Add().
+   */
+  void EnforceMemoryBudget();
+
 private:
 
   Dali::Toolkit::AtlasManager mAtlasManager;          ///> Atlas Manager created by GlyphManager
-  std::vector< FontGlyphRecord > mFontGlyphRecords;
+  Vector< GlyphRecordEntry > mGlyphRecords;           ///> Open-addressed (linear probing) table of cached glyphs. Its capacity is a power of two.
+  uint32_t mGlyphRecordCount;                         ///> Number of slots of the table in use
+  uint32_t mUnreferencedGlyphCount;                   ///> Number of cached glyphs with a zero reference count
+  std::deque< UnreferencedGlyph > mUnreferencedGlyphs;  ///> The unreferenced glyphs, least recently used first. It may have stale entries.
+  Vector< uint32_t > mReferencedGlyphCounts;          ///> Number of referenced glyphs stored in each atlas, indexed by atlas id minus one
+  uint32_t mUseStamp;                                 ///> Time stamp used to order the unreferenced glyphs
+  uint32_t mMemoryBudget;                             ///> Texture memory budget in bytes ( zero if unlimited )
+  bool mMemoryBudgetExceeded;                         ///> Whether the texture memory used exceeds the budget
   Toolkit::AtlasGlyphManager::Metrics mMetrics;       ///> Metrics to pass back on GlyphManager status
 
   Shader mShaderL8;
@@ -19,7 +19,9 @@
 #include <dali-toolkit/internal/text/rendering/atlas/atlas-glyph-manager.h>
 
 // EXTERNAL INCLUDES
+#include <cstdlib>
 #include <dali/devel-api/adaptor-framework/singleton-service.h>
+#include <dali/devel-api/adaptor-framework/environment-variable.h>
 
 // INTERNAL INCLUDES
 #include <dali-toolkit/internal/text/rendering/atlas/atlas-glyph-manager-impl.h>
@@ -30,6 +32,11 @@ namespace Dali
 namespace Toolkit
 {
 
+namespace
+{
+const char * const DALI_TEXT_ATLAS_MEMORY_BUDGET( "DALI_TEXT_ATLAS_MEMORY_BUDGET" ); ///< Texture memory budget of the glyph atlases in kilobytes
+}
+
 AtlasGlyphManager::AtlasGlyphManager()
 {
 }
@@ -58,6 +65,13 @@ AtlasGlyphManager AtlasGlyphManager::Get()
       // If not, create the AtlasGlyphManager and register it as a singleton
       manager = AtlasGlyphManager(new Internal::AtlasGlyphManager());
       singletonService.Register(typeid(manager), manager);
+
+      // Check whether a memory budget is required
+      const char* budget = EnvironmentVariable::GetEnvironmentVariable( DALI_TEXT_ATLAS_MEMORY_BUDGET );
+      if( budget )
+      {
+        manager.SetMemoryBudget( static_cast<uint32_t>( std::strtoul( budget, NULL, 10 ) ) * 1024u );
+      }
     }
   }
   return manager;
@@ -121,6 +135,11 @@ const Toolkit::AtlasGlyphManager::Metrics& AtlasGlyphManager::GetMetrics()
   return GetImplementation(*this).GetMetrics();
 }
 
+void AtlasGlyphManager::SetMemoryBudget( uint32_t budget )
+{
+  GetImplementation(*this).SetMemoryBudget( budget );
+}
+
 void AtlasGlyphManager::AdjustReferenceCount( Text::FontId fontId, Text::GlyphIndex index, int32_t delta )
 {
   GetImplementation(*this).AdjustReferenceCount( fontId, index, delta );
@@ -44,13 +44,25 @@ public:
   struct Metrics
   {
     Metrics()
-    : mGlyphCount( 0u )
+    : mGlyphCount( 0u ),
+      mCacheHits( 0u ),
+      mCacheMisses( 0u ),
+      mUnreferencedGlyphCount( 0u ),
+      mEvictedGlyphCount( 0u ),
+      mReleasedAtlasCount( 0u ),
+      mMemoryBudget( 0u )
     {}
 
     ~Metrics()
     {}
 
     uint32_t mGlyphCount;                   ///< number of glyphs being managed
+    uint32_t mCacheHits;                    ///< number of IsCached() queries which found the glyph
+    uint32_t mCacheMisses;                  ///< number of IsCached() queries which didn't find the glyph
+    uint32_t mUnreferencedGlyphCount;       ///< number of cached glyphs not used by any text
+    uint32_t mEvictedGlyphCount;            ///< number of unreferenced glyphs evicted to honour the memory budget
+    uint32_t mReleasedAtlasCount;           ///< number of atlases released to honour the memory budget
+    uint32_t mMemoryBudget;                 ///< texture memory budget in bytes ( zero if unlimited )
     std::string mVerboseGlyphCounts;        ///< a verbose list of the glyphs + ref counts
     AtlasManager::Metrics mAtlasMetrics;    ///< metrics from the Atlas Manager
   };
@@ -164,6 +176,20 @@ public:
    */
   const Metrics& GetMetrics();
 
+  /**
+   * @brief Set the texture memory budget of the glyph atlases
+   *
+   * When a budget is set, glyphs which are not used by any text anymore are kept cached
+   * until the texture memory used exceeds the budget. Then the atlases which only store
+   * unused glyphs are released, least recently used first, and a new glyph which doesn't
+   * fit in the atlases evicts the least recently used glyphs until it fits.
+   *
+   * Without budget ( the default ), glyphs are removed from the atlases as soon as they are not used.
+   *
+   * @param[in] budget The budget in bytes, zero if unlimited
+   */
+  void SetMemoryBudget( uint32_t budget );
+
   /**
    * @brief Adjust the reference count for glyph
    *
@@ -42,10 +42,19 @@ namespace
   const uint32_t SINGLE_PIXEL_PADDING( 1u );
   const uint32_t DOUBLE_PIXEL_PADDING( SINGLE_PIXEL_PADDING << 1 );
   Toolkit::AtlasManager::AtlasSize EMPTY_SIZE;
+
+  /**
+   * @brief Calculates the texture memory used by an atlas.
+   */
+  uint32_t GetAtlasMemorySize( const Toolkit::AtlasManager::AtlasSize& size, Pixel::Format pixelFormat )
+  {
+    return size.mWidth * size.mHeight * Pixel::GetBytesPerPixel( pixelFormat );
+  }
 }
 
 AtlasManager::AtlasManager()
-: mAddFailPolicy( Toolkit::AtlasManager::FAIL_ON_ADD_CREATES )
+: mAddFailPolicy( Toolkit::AtlasManager::FAIL_ON_ADD_CREATES ),
+  mPackingMode( Toolkit::AtlasManager::PACK_FIXED_BLOCKS )
 {
   mNewAtlasSize.mWidth = DEFAULT_ATLAS_WIDTH;
   mNewAtlasSize.mHeight = DEFAULT_ATLAS_HEIGHT;
@@ -61,6 +70,13 @@ AtlasManagerPtr AtlasManager::New()
 
 AtlasManager::~AtlasManager()
 {
+  for( std::vector< AtlasDescriptor >::iterator it = mAtlasList.begin(),
+         endIt = mAtlasList.end();
+       it != endIt;
+       ++it )
+  {
+    delete it->mPacker;
+  }
 }
 
 Toolkit::AtlasManager::AtlasId AtlasManager::CreateAtlas( const Toolkit::AtlasManager::AtlasSize& size, Pixel::Format pixelformat )
@@ -85,22 +101,43 @@ Toolkit::AtlasManager::AtlasId AtlasManager::CreateAtlas( const Toolkit::AtlasMa
   atlasDescriptor.mPixelFormat = pixelformat;
   atlasDescriptor.mTotalBlocks = ( ( width - 1u ) / blockWidth ) * ( ( height - 1u ) / blockHeight );
   atlasDescriptor.mAvailableBlocks = atlasDescriptor.mTotalBlocks;
+  atlasDescriptor.mImageCount = 0u;
+  atlasDescriptor.mPacker = NULL;
 
-  unsigned int bufferSize(  blockWidth * SINGLE_PIXEL_PADDING * Dali::Pixel::GetBytesPerPixel(pixelformat) );
-  unsigned char* bufferHorizontalStrip = new unsigned char[bufferSize];
-  memset( bufferHorizontalStrip, 0, bufferSize );
-  atlasDescriptor.mHorizontalStrip = PixelData::New( bufferHorizontalStrip, bufferSize, blockWidth, SINGLE_PIXEL_PADDING, pixelformat, PixelData::DELETE_ARRAY );
-
-  bufferSize = SINGLE_PIXEL_PADDING * (blockHeight - DOUBLE_PIXEL_PADDING) * Dali::Pixel::GetBytesPerPixel(pixelformat);
-  unsigned char* bufferVerticalStrip = new unsigned char[bufferSize];
-  memset( bufferVerticalStrip, 0, bufferSize );
-  atlasDescriptor.mVerticalStrip = PixelData::New( bufferVerticalStrip, bufferSize, SINGLE_PIXEL_PADDING, blockHeight - DOUBLE_PIXEL_PADDING, pixelformat, PixelData::DELETE_ARRAY );
+  if( Toolkit::AtlasManager::PACK_VARIABLE_SIZE == mPackingMode )
+  {
+    // Skip the filled pixel in top left corner.
+    atlasDescriptor.mPacker = new AtlasPacker( width - 1u, height - 1u );
+  }
+  else
+  {
+    // Used to clear a recycled block before uploading a new image into it.
+    const unsigned int bufferSize( blockWidth * blockHeight * Dali::Pixel::GetBytesPerPixel(pixelformat) );
+    unsigned char* bufferEmptyBlock = new unsigned char[bufferSize];
+    memset( bufferEmptyBlock, 0, bufferSize );
+    atlasDescriptor.mEmptyBlock = PixelData::New( bufferEmptyBlock, bufferSize, blockWidth, blockHeight, pixelformat, PixelData::DELETE_ARRAY );
+  }
 
-  bufferSize = Dali::Pixel::GetBytesPerPixel(pixelformat);
+  // Clear the whole atlas with a single upload so the padding around the images stored in never used blocks doesn't need to be uploaded.
+  // The filled pixel in the top left corner is used to draw underlines.
+  const unsigned int bytesPerPixel = Dali::Pixel::GetBytesPerPixel(pixelformat);
+  const unsigned int bufferSize = width * height * bytesPerPixel;
   unsigned char* buffer = new unsigned char[bufferSize];
-  memset( buffer, 0xFF, bufferSize );
-  PixelData filledPixelImage = PixelData::New( buffer, bufferSize, 1u, 1u, pixelformat, PixelData::DELETE_ARRAY );
-  atlas.Upload( filledPixelImage, 0u, 0u, 0u, 0u, 1u, 1u );
+  memset( buffer, 0, bufferSize );
+  memset( buffer, 0xFF, bytesPerPixel );
+  PixelData clearedAtlasImage = PixelData::New( buffer, bufferSize, width, height, pixelformat, PixelData::DELETE_ARRAY );
+  atlas.Upload( clearedAtlasImage, 0u, 0u, 0u, 0u, width, height );
+
+  // Reuse the id of a released atlas if there is any
+  for( SizeType index = 0u; index < mAtlasList.size(); ++index )
+  {
+    if( !mAtlasList[ index ].mAtlas )
+    {
+      mAtlasList[ index ] = atlasDescriptor;
+      return index + 1u;
+    }
+  }
+
   mAtlasList.push_back( atlasDescriptor );
   return mAtlasList.size();
 }
@@ -110,6 +147,11 @@ void AtlasManager::SetAddPolicy( Toolkit::AtlasManager::AddFailPolicy policy )
   mAddFailPolicy = policy;
 }
 
+void AtlasManager::SetPackingMode( Toolkit::AtlasManager::PackingMode mode )
+{
+  mPackingMode = mode;
+}
+
 bool AtlasManager::Add( const PixelData& image,
                         Toolkit::AtlasManager::AtlasSlot& slot,
                         Toolkit::AtlasManager::AtlasId atlas )
@@ -127,13 +169,13 @@ bool AtlasManager::Add( const PixelData& image,
   // If there is a preferred atlas then check for room in that first
   if ( atlas-- )
   {
-    foundAtlas = CheckAtlas( atlas, width, height, pixelFormat );
+    foundAtlas = CheckAtlas( atlas, width, height, pixelFormat, desc );
   }
 
   // Search current atlases to see if there is a good match
   while( !foundAtlas && index < mAtlasList.size() )
   {
-    foundAtlas = CheckAtlas( index, width, height, pixelFormat );
+    foundAtlas = CheckAtlas( index, width, height, pixelFormat, desc );
     ++index;
   }
 
@@ -153,29 +195,39 @@ bool AtlasManager::Add( const PixelData& image,
         return created;
       }
       created = true;
-      foundAtlas = CheckAtlas( foundAtlas, width, height, pixelFormat );
+      foundAtlas = CheckAtlas( foundAtlas, width, height, pixelFormat, desc );
     }
 
     if ( !foundAtlas-- || Toolkit::AtlasManager::FAIL_ON_ADD_FAILS == mAddFailPolicy )
     {
       // Haven't found an atlas for this image!!!!!!
-      DALI_LOG_ERROR("Failed to create an atlas under current policy.\n");
+      if ( Toolkit::AtlasManager::FAIL_ON_ADD_CREATES == mAddFailPolicy )
+      {
+        DALI_LOG_ERROR("Failed to create an atlas under current policy.\n");
+      }
       return created;
     }
   }
 
   // Work out which the block we're going to use
   // Is there currently a next free block available ?
-  if ( mAtlasList[ foundAtlas ].mAvailableBlocks )
+  bool recycledBlock = false;
+  if ( mAtlasList[ foundAtlas ].mPacker )
+  {
+    // The area has already been reserved by CheckAtlas(), and is clear as the removed images are cleared by Remove()
+    desc.mBlock = 0u;
+  }
+  else if ( mAtlasList[ foundAtlas ].mAvailableBlocks )
   {
     // Yes, so select our next block
     desc.mBlock = mAtlasList[ foundAtlas ].mTotalBlocks - mAtlasList[ foundAtlas ].mAvailableBlocks--;
   }
   else
   {
-    // Our next block must be from the free list, fetch from the start of the list
-    desc.mBlock = mAtlasList[ foundAtlas ].mFreeBlocksList[ 0 ];
-    mAtlasList[ foundAtlas ].mFreeBlocksList.Remove( mAtlasList[ foundAtlas ].mFreeBlocksList.Begin() );
+    // Our next block must be from the free list, fetch the most recently freed one
+    desc.mBlock = *( mAtlasList[ foundAtlas ].mFreeBlocksList.End() - 1u );
+    mAtlasList[ foundAtlas ].mFreeBlocksList.Resize( mAtlasList[ foundAtlas ].mFreeBlocksList.Size() - 1u );
+    recycledBlock = true;
   }
 
   desc.mImageWidth = width;
@@ -183,40 +235,51 @@ bool AtlasManager::Add( const PixelData& image,
   desc.mAtlasId = foundAtlas + 1u;
   desc.mCount = 1u;
 
+  ++mAtlasList[ foundAtlas ].mImageCount;
+
   // See if there's a previously freed image ID that we can assign to this new image
-  uint32_t imageId = 0u;
-  for ( uint32_t i = 0u; i < mImageList.Size(); ++i )
-  {
-    if ( !mImageList[ i ].mCount )
-    {
-      imageId = i + 1u;
-      break;
-    }
-  }
-  if ( !imageId )
+  if ( mFreeImageIds.Empty() )
   {
     mImageList.PushBack( desc );
     slot.mImageId = mImageList.Size();
   }
   else
   {
+    const ImageId imageId = *( mFreeImageIds.End() - 1u );
+    mFreeImageIds.Resize( mFreeImageIds.Size() - 1u );
     mImageList[ imageId - 1u ] = desc;
     slot.mImageId = imageId;
   }
   slot.mAtlasId = foundAtlas + 1u;
 
   // Upload the buffer image into the atlas
-  UploadImage( image, desc );
+  UploadImage( image, desc, recycledBlock );
   return created;
 }
 
 AtlasManager::SizeType AtlasManager::CheckAtlas( SizeType atlas,
                                                  SizeType width,
                                                  SizeType height,
-                                                 Pixel::Format pixelFormat )
+                                                 Pixel::Format pixelFormat,
+                                                 AtlasSlotDescriptor& desc )
 {
   AtlasManager::SizeType result = 0u;
-  if ( pixelFormat == mAtlasList[ atlas ].mPixelFormat )
+  if ( !mAtlasList[ atlas ].mAtlas )
+  {
+    // The atlas has been released
+  }
+  else if ( pixelFormat == mAtlasList[ atlas ].mPixelFormat && mAtlasList[ atlas ].mPacker )
+  {
+    // Reserve the image area plus the padding
+    if ( mAtlasList[ atlas ].mPacker->Pack( width + DOUBLE_PIXEL_PADDING,
+                                            height + DOUBLE_PIXEL_PADDING,
+                                            desc.mPackPositionX,
+                                            desc.mPackPositionY ) )
+    {
+      result = atlas + 1u;
+    }
+  }
+  else if ( pixelFormat == mAtlasList[ atlas ].mPixelFormat )
   {
     // Check to see if the image will fit in these blocks, if not we'll need to create a new atlas
     if ( ( mAtlasList[ atlas ].mAvailableBlocks + mAtlasList[ atlas ].mFreeBlocksList.Size() )
@@ -230,7 +293,8 @@ AtlasManager::SizeType AtlasManager::CheckAtlas( SizeType atlas,
 }
 
 void AtlasManager::UploadImage( const PixelData& image,
-                                const AtlasSlotDescriptor& desc )
+                                const AtlasSlotDescriptor& desc,
+                                bool clearBlock )
 {
   // Get the atlas to upload the image to
   SizeType atlas = desc.mAtlasId - 1u;
@@ -242,71 +306,50 @@ void AtlasManager::UploadImage( const PixelData& image,
     return;
   }
 
-  SizeType atlasBlockWidth = mAtlasList[ atlas ].mSize.mBlockWidth;
-  SizeType atlasBlockHeight = mAtlasList[ atlas ].mSize.mBlockHeight;
-  SizeType atlasWidthInBlocks = ( mAtlasList[ atlas ].mSize.mWidth - 1u ) / mAtlasList[ atlas ].mSize.mBlockWidth;
-
-  SizeType blockX = desc.mBlock % atlasWidthInBlocks;
-  SizeType blockY = desc.mBlock / atlasWidthInBlocks;
-  SizeType blockOffsetX = ( blockX * atlasBlockWidth ) + 1u;
-  SizeType blockOffsetY = ( blockY * atlasBlockHeight) + 1u;
-
   SizeType width = image.GetWidth();
   SizeType height = image.GetHeight();
 
-  // Blit image 1 pixel to the right and down into the block to compensate for texture filtering
-  if ( !mAtlasList[ atlas ].mAtlas.Upload( image, 0u, 0u,
-                                           blockOffsetX + SINGLE_PIXEL_PADDING,
-                                           blockOffsetY + SINGLE_PIXEL_PADDING,
-                                           width, height) )
-  {
-    DALI_LOG_ERROR("Uploading image to Atlas Failed!.\n");
-  }
+  SizeType blockOffsetX = 0u;
+  SizeType blockOffsetY = 0u;
 
-  // Blit top strip
-  if ( !mAtlasList[ atlas ].mAtlas.Upload( mAtlasList[ atlas ].mHorizontalStrip, 0u, 0u,
-                                           blockOffsetX,
-                                           blockOffsetY,
-                                           mAtlasList[ atlas ].mHorizontalStrip.GetWidth(),
-                                           mAtlasList[ atlas ].mHorizontalStrip.GetHeight()) )
+  if ( mAtlasList[ atlas ].mPacker )
   {
-    DALI_LOG_ERROR("Uploading top strip to Atlas Failed!\n");
+    // Skip the filled pixel in top left corner
+    blockOffsetX = desc.mPackPositionX + 1u;
+    blockOffsetY = desc.mPackPositionY + 1u;
   }
-
-  // Blit left strip
-  if ( !mAtlasList[ atlas ].mAtlas.Upload( mAtlasList[ atlas ].mVerticalStrip, 0u, 0u,
-                                           blockOffsetX,
-                                           blockOffsetY + SINGLE_PIXEL_PADDING,
-                                           mAtlasList[ atlas ].mVerticalStrip.GetWidth(),
-                                           mAtlasList[ atlas ].mVerticalStrip.GetHeight() ) )
+  else
   {
-    DALI_LOG_ERROR("Uploading left strip to Atlas Failed!\n");
+    SizeType atlasBlockWidth = mAtlasList[ atlas ].mSize.mBlockWidth;
+    SizeType atlasBlockHeight = mAtlasList[ atlas ].mSize.mBlockHeight;
+    SizeType atlasWidthInBlocks = ( mAtlasList[ atlas ].mSize.mWidth - 1u ) / mAtlasList[ atlas ].mSize.mBlockWidth;
+
+    SizeType blockX = desc.mBlock % atlasWidthInBlocks;
+    SizeType blockY = desc.mBlock / atlasWidthInBlocks;
+    blockOffsetX = ( blockX * atlasBlockWidth ) + 1u;
+    blockOffsetY = ( blockY * atlasBlockHeight) + 1u;
   }
 
-  // Blit bottom strip
-  if ( blockOffsetY + height + DOUBLE_PIXEL_PADDING <= mAtlasList[ atlas ].mSize.mHeight )
+  // The atlas is cleared when created, so only a recycled block needs its padding to be cleared.
+  if ( clearBlock )
   {
-    if ( !mAtlasList[ atlas ].mAtlas.Upload( mAtlasList[ atlas ].mHorizontalStrip, 0u, 0u,
+    if ( !mAtlasList[ atlas ].mAtlas.Upload( mAtlasList[ atlas ].mEmptyBlock, 0u, 0u,
                                              blockOffsetX,
-                                             blockOffsetY + height + SINGLE_PIXEL_PADDING,
-                                             mAtlasList[ atlas ].mHorizontalStrip.GetWidth(),
-                                             mAtlasList[ atlas ].mHorizontalStrip.GetHeight() ) )
+                                             blockOffsetY,
+                                             mAtlasList[ atlas ].mEmptyBlock.GetWidth(),
+                                             mAtlasList[ atlas ].mEmptyBlock.GetHeight() ) )
     {
-      DALI_LOG_ERROR("Uploading bottom strip to Atlas Failed!.\n");
+      DALI_LOG_ERROR("Clearing block in Atlas Failed!.\n");
     }
   }
 
-  // Blit right strip
-  if ( blockOffsetX + width + DOUBLE_PIXEL_PADDING <= mAtlasList[ atlas ].mSize.mWidth )
+  // Blit image 1 pixel to the right and down into the block to compensate for texture filtering
+  if ( !mAtlasList[ atlas ].mAtlas.Upload( image, 0u, 0u,
+                                           blockOffsetX + SINGLE_PIXEL_PADDING,
+                                           blockOffsetY + SINGLE_PIXEL_PADDING,
+                                           width, height) )
   {
-    if ( !mAtlasList[ atlas ].mAtlas.Upload( mAtlasList[ atlas ].mVerticalStrip, 0u, 0u,
-                                             blockOffsetX + width + SINGLE_PIXEL_PADDING,
-                                             blockOffsetY + SINGLE_PIXEL_PADDING,
-                                             mAtlasList[ atlas ].mVerticalStrip.GetWidth(),
-                                             mAtlasList[ atlas ].mVerticalStrip.GetHeight() ) )
-    {
-      DALI_LOG_ERROR("Uploading right strip to Atlas Failed!.\n");
-    }
+    DALI_LOG_ERROR("Uploading image to Atlas Failed!.\n");
   }
 }
 
@@ -323,12 +366,26 @@ void AtlasManager::GenerateMeshData( ImageId id,
     SizeType width = mImageList[ imageId ].mImageWidth;
     SizeType height = mImageList[ imageId ].mImageHeight;
 
-    AtlasMeshFactory::CreateQuad( width,
-                                  height,
-                                  mImageList[ imageId ].mBlock,
-                                  mAtlasList[ atlas ].mSize,
-                                  position,
-                                  meshData );
+    if ( mAtlasList[ atlas ].mPacker )
+    {
+      // The image is stored one pixel to the right and down into its area, which starts after the filled pixel in top left corner
+      AtlasMeshFactory::CreateQuad( width,
+                                    height,
+                                    mImageList[ imageId ].mPackPositionX + DOUBLE_PIXEL_PADDING,
+                                    mImageList[ imageId ].mPackPositionY + DOUBLE_PIXEL_PADDING,
+                                    mAtlasList[ atlas ].mSize,
+                                    position,
+                                    meshData );
+    }
+    else
+    {
+      AtlasMeshFactory::CreateQuad( width,
+                                    height,
+                                    mImageList[ imageId ].mBlock,
+                                    mAtlasList[ atlas ].mSize,
+                                    position,
+                                    meshData );
+    }
 
     // Mesh created so increase the reference count, if we're asked to
     if ( addReference )
@@ -377,12 +434,82 @@ bool AtlasManager::Remove( ImageId id )
     // 'Remove the blocks' from this image and add to the atlas' freelist
     removed = true;
     mImageList[ imageId ].mCount = 0;
+    mFreeImageIds.PushBack( id );
     SizeType atlas = mImageList[ imageId ].mAtlasId - 1u;
-    mAtlasList[ atlas ].mFreeBlocksList.PushBack( mImageList[ imageId ].mBlock );
+    --mAtlasList[ atlas ].mImageCount;
+    if ( mAtlasList[ atlas ].mPacker )
+    {
+      // Return the area to the packer, which merges it with the neighbouring free areas
+      mAtlasList[ atlas ].mPacker->DeleteBlock( mImageList[ imageId ].mPackPositionX,
+                                                mImageList[ imageId ].mPackPositionY,
+                                                mImageList[ imageId ].mImageWidth + DOUBLE_PIXEL_PADDING,
+                                                mImageList[ imageId ].mImageHeight + DOUBLE_PIXEL_PADDING );
+
+      // Clear the area once, so the images packed later into it don't need to clear their padding
+      const SizeType paddedWidth = mImageList[ imageId ].mImageWidth + DOUBLE_PIXEL_PADDING;
+      const SizeType paddedHeight = mImageList[ imageId ].mImageHeight + DOUBLE_PIXEL_PADDING;
+      const unsigned int bufferSize = paddedWidth * paddedHeight * Dali::Pixel::GetBytesPerPixel( mAtlasList[ atlas ].mPixelFormat );
+      unsigned char* buffer = new unsigned char[bufferSize];
+      memset( buffer, 0, bufferSize );
+      PixelData emptyArea = PixelData::New( buffer, bufferSize, paddedWidth, paddedHeight, mAtlasList[ atlas ].mPixelFormat, PixelData::DELETE_ARRAY );
+
+      // Skip the filled pixel in top left corner
+      if ( !mAtlasList[ atlas ].mAtlas.Upload( emptyArea, 0u, 0u,
+                                               mImageList[ imageId ].mPackPositionX + 1u,
+                                               mImageList[ imageId ].mPackPositionY + 1u,
+                                               paddedWidth,
+                                               paddedHeight ) )
+      {
+        DALI_LOG_ERROR("Clearing area in Atlas Failed!.\n");
+      }
+    }
+    else
+    {
+      mAtlasList[ atlas ].mFreeBlocksList.PushBack( mImageList[ imageId ].mBlock );
+    }
   }
   return removed;
 }
 
+bool AtlasManager::ReleaseAtlas( AtlasId atlas )
+{
+  DALI_ASSERT_DEBUG( atlas && atlas <= mAtlasList.size() );
+  if ( atlas && atlas-- <= mAtlasList.size() )
+  {
+    AtlasDescriptor& descriptor = mAtlasList[ atlas ];
+    if ( descriptor.mAtlas && !descriptor.mImageCount )
+    {
+      delete descriptor.mPacker;
+      descriptor.mPacker = NULL;
+      descriptor.mAtlas.Reset();
+      descriptor.mTextureSet.Reset();
+      descriptor.mEmptyBlock.Reset();
+      descriptor.mFreeBlocksList.Clear();
+      descriptor.mTotalBlocks = 0u;
+      descriptor.mAvailableBlocks = 0u;
+      descriptor.mSize = EMPTY_SIZE;
+      return true;
+    }
+  }
+  return false;
+}
+
+AtlasManager::SizeType AtlasManager::GetTextureMemoryUsed() const
+{
+  SizeType textureMemoryUsed = 0u;
+  for( std::vector< AtlasDescriptor >::const_iterator it = mAtlasList.begin(),
+         endIt = mAtlasList.end();
+       it != endIt;
+       ++it )
+  {
+    if( it->mAtlas )
+    {
+      textureMemoryUsed += GetAtlasMemorySize( it->mSize, it->mPixelFormat );
+    }
+  }
+  return textureMemoryUsed;
+}
+
 AtlasManager::AtlasId AtlasManager::GetAtlas( ImageId id ) const
 {
   DALI_ASSERT_DEBUG( id && id <= mImageList.Size() );
@@ -419,7 +546,14 @@ AtlasManager::SizeType AtlasManager::GetFreeBlocks( AtlasId atlas ) const
   AtlasManager::SizeType freeBlocks = 0u;
   if ( atlas && atlas-- <= mAtlasList.size() )
   {
-    freeBlocks = mAtlasList[ atlas ].mAvailableBlocks + mAtlasList[ atlas ].mFreeBlocksList.Size();
+    if ( mAtlasList[ atlas ].mPacker )
+    {
+      freeBlocks = mAtlasList[ atlas ].mPacker->GetAvailableArea();
+    }
+    else
+    {
+      freeBlocks = mAtlasList[ atlas ].mAvailableBlocks + mAtlasList[ atlas ].mFreeBlocksList.Size();
+    }
   }
   return freeBlocks;
 }
@@ -451,22 +585,26 @@ void AtlasManager::GetMetrics( Toolkit::AtlasManager::Metrics& metrics )
   for ( uint32_t i = 0; i < atlasCount; ++i )
   {
     entry.mSize = mAtlasList[ i ].mSize;
-    entry.mTotalBlocks = mAtlasList[ i ].mTotalBlocks;
-    entry.mBlocksUsed = entry.mTotalBlocks - mAtlasList[ i ].mAvailableBlocks + mAtlasList[ i ].mFreeBlocksList.Size();
-    entry.mPixelFormat = GetPixelFormat( i + 1 );
-
-    metrics.mAtlasMetrics.PushBack( entry );
-
-    uint32_t size = entry.mSize.mWidth * entry.mSize.mHeight;
-    if ( entry.mPixelFormat == Pixel::BGRA8888 )
+    if ( mAtlasList[ i ].mPacker )
+    {
+      entry.mTotalBlocks = ( entry.mSize.mWidth - 1u ) * ( entry.mSize.mHeight - 1u );
+      entry.mBlocksUsed = entry.mTotalBlocks - mAtlasList[ i ].mPacker->GetAvailableArea();
+    }
+    else
     {
-      size <<= 2;
+      entry.mTotalBlocks = mAtlasList[ i ].mTotalBlocks;
+      entry.mBlocksUsed = entry.mTotalBlocks - mAtlasList[ i ].mAvailableBlocks - mAtlasList[ i ].mFreeBlocksList.Size();
     }
+    entry.mImageCount = mAtlasList[ i ].mImageCount;
+    entry.mPixelFormat = GetPixelFormat( i + 1 );
 
-    textureMemoryUsed += size;
+    metrics.mAtlasMetrics.PushBack( entry );
 
+    textureMemoryUsed += GetAtlasMemorySize( entry.mSize, entry.mPixelFormat );
   }
   metrics.mTextureMemoryUsed = textureMemoryUsed;
+  metrics.mImageIdCount = mImageList.Size();
+  metrics.mFreeImageIdCount = mFreeImageIds.Size();
 }
 
 TextureSet AtlasManager::GetTextures( AtlasId atlas ) const
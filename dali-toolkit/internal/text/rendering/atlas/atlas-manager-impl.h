@@ -24,6 +24,7 @@
 
 // INTERNAL INCLUDES
 #include <dali-toolkit/internal/text/rendering/atlas/atlas-manager.h>
+#include <dali-toolkit/internal/image-atlas/atlas-packer.h>
 
 namespace Dali
 {
@@ -59,15 +60,16 @@ public:
    */
   struct AtlasDescriptor
   {
-    Dali::Texture mAtlas;                                                 // atlas image
+    Dali::Texture mAtlas;                                                 // atlas image ( empty if the atlas has been released )
     Toolkit::AtlasManager::AtlasSize mSize;                             // size of atlas
     Pixel::Format mPixelFormat;                                         // pixel format used by atlas
-    PixelData mHorizontalStrip;                                       // Image used to pad upload
-    PixelData mVerticalStrip;                                         // Image used to pad upload
+    PixelData mEmptyBlock;                                            // Image used to clear a recycled block ( empty for a packed atlas )
     TextureSet mTextureSet;                                             // Texture set used for atlas texture
     SizeType mTotalBlocks;                                              // total number of blocks in atlas
     SizeType mAvailableBlocks;                                          // number of blocks available in atlas
+    SizeType mImageCount;                                               // number of images stored in atlas
     Dali::Vector< SizeType > mFreeBlocksList;                           // unless there are any previously freed blocks
+    AtlasPacker* mPacker;                                               // packer of a variable size atlas ( NULL for fixed blocks ), owned by the manager
   };
 
   struct AtlasSlotDescriptor
@@ -77,6 +79,8 @@ public:
     SizeType mImageHeight;                                              // Height of image stored
     AtlasId mAtlasId;                                                   // Image is stored in this Atlas
     SizeType mBlock;                                                    // Block within atlas used for image
+    SizeType mPackPositionX;                                            // Position of the padded image within a packed atlas
+    SizeType mPackPositionY;
   };
 
   AtlasManager();
@@ -98,6 +102,11 @@ public:
    */
   void SetAddPolicy( Toolkit::AtlasManager::AddFailPolicy policy );
 
+  /**
+   * @copydoc Toolkit::AtlasManager::SetPackingMode
+   */
+  void SetPackingMode( Toolkit::AtlasManager::PackingMode mode );
+
   /**
    * @copydoc Toolkit::AtlasManager::Add
    */
@@ -123,6 +132,16 @@ public:
    */
   Dali::Texture GetAtlasContainer( AtlasId atlas ) const;
 
+  /**
+   * @copydoc Toolkit::AtlasManager::ReleaseAtlas
+   */
+  bool ReleaseAtlas( AtlasId atlas );
+
+  /**
+   * @copydoc Toolkit::AtlasManager::GetTextureMemoryUsed
+   */
+  SizeType GetTextureMemoryUsed() const;
+
   /**
    * @copydoc Toolkit::AtlasManager::GetAtlas
    */
@@ -177,16 +196,31 @@ private:
 
   std::vector< AtlasDescriptor > mAtlasList;            // List of atlases created
   Vector< AtlasSlotDescriptor > mImageList;             // List of bitmaps stored in atlases
+  Vector< ImageId > mFreeImageIds;                      // Stack of image ids freed for reuse
   Toolkit::AtlasManager::AtlasSize mNewAtlasSize;       // Atlas size to use in next creation
   Toolkit::AtlasManager::AddFailPolicy mAddFailPolicy;  // Policy for faling to add an Image
+  Toolkit::AtlasManager::PackingMode mPackingMode;      // Packing mode to use in next creation
 
+  /**
+   * Checks whether an image fits in an atlas. For a packed atlas, the area of the image is reserved.
+   *
+   * @param[in] atlas index of the atlas
+   * @param[in] width width of the image
+   * @param[in] height height of the image
+   * @param[in] pixelFormat pixel format of the image
+   * @param[out] desc for a packed atlas, the pack position of the image is set
+   *
+   * @return atlas index plus one or zero if the image doesn't fit
+   */
   SizeType CheckAtlas( SizeType atlas,
                        SizeType width,
                        SizeType height,
-                       Pixel::Format pixelFormat );
+                       Pixel::Format pixelFormat,
+                       AtlasSlotDescriptor& desc );
 
   void UploadImage( const PixelData& image,
-                    const AtlasSlotDescriptor& desc );
+                    const AtlasSlotDescriptor& desc,
+                    bool clearBlock );
 
 };
 
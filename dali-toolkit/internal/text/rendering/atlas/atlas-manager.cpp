@@ -55,6 +55,11 @@ void AtlasManager::SetAddPolicy( AddFailPolicy policy )
   GetImplementation(*this).SetAddPolicy( policy );
 }
 
+void AtlasManager::SetPackingMode( PackingMode mode )
+{
+  GetImplementation(*this).SetPackingMode( mode );
+}
+
 bool AtlasManager::Add( const PixelData& image,
                         AtlasManager::AtlasSlot& slot,
                         AtlasManager::AtlasId atlas )
@@ -83,6 +88,16 @@ Dali::Texture AtlasManager::GetAtlasContainer( AtlasId atlas ) const
   return GetImplementation(*this).GetAtlasContainer( atlas );
 }
 
+bool AtlasManager::ReleaseAtlas( AtlasId atlas )
+{
+  return GetImplementation(*this).ReleaseAtlas( atlas );
+}
+
+AtlasManager::SizeType AtlasManager::GetTextureMemoryUsed() const
+{
+  return GetImplementation(*this).GetTextureMemoryUsed();
+}
+
 AtlasManager::AtlasId AtlasManager::GetAtlas( ImageId id )
 {
   return GetImplementation(*this).GetAtlas( id );
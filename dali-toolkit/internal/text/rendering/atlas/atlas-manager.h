@@ -60,8 +60,9 @@ public:
   struct AtlasMetricsEntry
   {
     AtlasSize mSize;                 ///< size of atlas and blocks
-    SizeType mBlocksUsed;            ///< number of blocks used in the atlas
-    SizeType mTotalBlocks;           ///< total blocks used by atlas
+    SizeType mBlocksUsed;            ///< number of blocks used in the atlas ( number of pixels for a packed atlas )
+    SizeType mTotalBlocks;           ///< total blocks used by atlas ( number of pixels for a packed atlas )
+    SizeType mImageCount;            ///< number of images stored in the atlas
     Pixel::Format mPixelFormat;      ///< pixel format of the atlas
   };
 
@@ -69,14 +70,18 @@ public:
   {
     Metrics()
     : mAtlasCount( 0u ),
-      mTextureMemoryUsed( 0u )
+      mTextureMemoryUsed( 0u ),
+      mImageIdCount( 0u ),
+      mFreeImageIdCount( 0u )
     {}
 
     ~Metrics()
     {}
 
-    SizeType mAtlasCount;                               ///< number of atlases
+    SizeType mAtlasCount;                               ///< number of atlases ( including released ones, which have an empty size )
     SizeType mTextureMemoryUsed;                        ///< texture memory used by atlases
+    SizeType mImageIdCount;                             ///< number of image ids allocated
+    SizeType mFreeImageIdCount;                         ///< number of allocated image ids free for reuse
     Dali::Vector< AtlasMetricsEntry > mAtlasMetrics;    ///< container of atlas information
   };
 
@@ -122,6 +127,15 @@ public:
     FAIL_ON_ADD_CREATES
   };
 
+  /**
+   * Policy on how images are placed into an atlas
+   */
+  enum PackingMode
+  {
+    PACK_FIXED_BLOCKS,      ///< The atlas is divided into equal blocks of the atlas' block size
+    PACK_VARIABLE_SIZE      ///< Each image uses an area of its own size; free areas are merged on removal
+  };
+
   /**
    * @brief Container to hold result of placing texture into atlas
    */
@@ -150,6 +164,13 @@ public:
    */
   void SetAddPolicy( AddFailPolicy policy );
 
+  /**
+   * @brief Set the packing mode of the atlases created from now on
+   *
+   * @param[in] mode packing mode to use
+   */
+  void SetPackingMode( PackingMode mode );
+
   /**
    * @brief Attempts to add an image to the most suitable atlas
    *
@@ -198,6 +219,24 @@ public:
    */
   Dali::Texture GetAtlasContainer( AtlasId atlas ) const;
 
+  /**
+   * @brief Release the texture of an atlas which doesn't store any image
+   *
+   * @details The atlas id may be reused by a later created atlas.
+   *
+   * @param[in] atlas AtlasId
+   *
+   * @return true if the atlas has been released
+   */
+  bool ReleaseAtlas( AtlasId atlas );
+
+  /**
+   * @brief Get the texture memory used by the atlases currently allocated
+   *
+   * @return Texture memory in bytes
+   */
+  SizeType GetTextureMemoryUsed() const;
+
   /**
    * @brief Get the Id of the atlas containing an image
    *
@@ -220,7 +259,7 @@ public:
    *
    * @param[in] atlas AtlasId
    *
-   * @return Number of blocks free in this atlas
+   * @return Number of blocks free in this atlas ( number of free pixels for a packed atlas )
    */
   SizeType GetFreeBlocks( AtlasId atlas );
 
@@ -36,28 +36,10 @@ void CreateQuad( SizeType imageWidth,
                  const Vector2& position,
                  Toolkit::AtlasManager::Mesh2D& mesh )
 {
-  Toolkit::AtlasManager::Vertex2D vertex;
-
   SizeType blockWidth = atlasSize.mBlockWidth;
   SizeType blockHeight = atlasSize.mBlockHeight;
 
-  float vertexBlockWidth = static_cast< float >( blockWidth );
-  float vertexBlockHeight = static_cast< float >( blockHeight );
-
-  SizeType atlasWidth = atlasSize.mWidth;
-  SizeType atlasHeight = atlasSize.mHeight;
-
-  SizeType atlasWidthInBlocks = ( atlasWidth - 1u ) / blockWidth;
-
-  // Get the normalized size of a texel in both directions
-  float texelX = 1.0f / static_cast< float >( atlasWidth );
-  float texelY = 1.0f / static_cast< float >( atlasHeight );
-
-  float oneAndAHalfTexelX = texelX + ( texelX * 0.5f );
-  float oneAndAHalfTexelY = texelY + ( texelY * 0.5f );
-
-  float texelBlockWidth = texelX * vertexBlockWidth;
-  float texelBlockHeight = texelY * vertexBlockHeight;
+  SizeType atlasWidthInBlocks = ( atlasSize.mWidth - 1u ) / blockWidth;
 
   uint32_t pixelsX = imageWidth % blockWidth;
   uint32_t pixelsY = imageHeight % blockHeight;
@@ -70,8 +52,36 @@ void CreateQuad( SizeType imageWidth,
   {
     pixelsY = blockHeight;
   }
-  float vertexWidth = static_cast< float >( pixelsX );
-  float vertexHeight = static_cast< float >( pixelsY );
+
+  // The image is stored one pixel to the right and down into the block, and blocks start after the filled pixel in top left corner
+  CreateQuad( pixelsX,
+              pixelsY,
+              blockWidth * ( block % atlasWidthInBlocks ) + 2u,
+              blockHeight * ( block / atlasWidthInBlocks ) + 2u,
+              atlasSize,
+              position,
+              mesh );
+}
+
+void CreateQuad( SizeType imageWidth,
+                 SizeType imageHeight,
+                 SizeType imageX,
+                 SizeType imageY,
+                 const Toolkit::AtlasManager::AtlasSize& atlasSize,
+                 const Vector2& position,
+                 Toolkit::AtlasManager::Mesh2D& mesh )
+{
+  Toolkit::AtlasManager::Vertex2D vertex;
+
+  SizeType atlasWidth = atlasSize.mWidth;
+  SizeType atlasHeight = atlasSize.mHeight;
+
+  // Get the normalized size of a texel in both directions
+  float texelX = 1.0f / static_cast< float >( atlasWidth );
+  float texelY = 1.0f / static_cast< float >( atlasHeight );
+
+  float vertexWidth = static_cast< float >( imageWidth );
+  float vertexHeight = static_cast< float >( imageHeight );
   float texelWidth = texelX * vertexWidth;
   float texelHeight = texelY * vertexHeight;
 
@@ -82,12 +92,9 @@ void CreateQuad( SizeType imageWidth,
   // Move back half a pixel
   Vector2 topLeft = Vector2( position.x - 0.5f, position.y - 0.5f );
 
-  float fBlockX = texelBlockWidth * static_cast< float >( block % atlasWidthInBlocks );
-  float fBlockY = texelBlockHeight * static_cast< float >( block / atlasWidthInBlocks );
-
-  // Add on texture filtering compensation ( half a texel plus compensation for filled pixel in top left corner )
-  fBlockX += oneAndAHalfTexelX;
-  fBlockY += oneAndAHalfTexelY;
+  // Add on texture filtering compensation ( half a texel )
+  float fBlockX = texelX * ( static_cast< float >( imageX ) - 0.5f );
+  float fBlockY = texelY * ( static_cast< float >( imageY ) - 0.5f );
 
   float texelWidthOffset = texelWidth + texelX;
   float texelHeightOffset = texelHeight + texelY;
@@ -50,6 +50,25 @@ namespace AtlasMeshFactory
                    const Vector2& position,
                    Toolkit::AtlasManager::Mesh2D& mesh );
 
+  /**
+   * @brief Create a Quad that describes an area at a given pixel position in an atlas and a position.
+   *
+   * @param[in]  width Width of area in pixels.
+   * @param[in]  height Height of area in pixels.
+   * @param[in]  x The x coordinate of the top left pixel of the area in the atlas.
+   * @param[in]  y The y coordinate of the top left pixel of the area in the atlas.
+   * @param[in]  atlasSize Atlas dimensions.
+   * @param[in]  position Position to place area in space.
+   * @param[out] mesh Mesh object to hold created quad.
+   */
+  void CreateQuad( SizeType width,
+                   SizeType height,
+                   SizeType x,
+                   SizeType y,
+                   const Toolkit::AtlasManager::AtlasSize& atlasSize,
+                   const Vector2& position,
+                   Toolkit::AtlasManager::Mesh2D& mesh );
+
   /**
    * @brief Append one mesh to another.
    *
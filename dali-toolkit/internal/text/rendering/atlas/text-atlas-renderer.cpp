@@ -19,6 +19,7 @@
 #include <dali-toolkit/internal/text/rendering/atlas/text-atlas-renderer.h>
 
 // EXTERNAL INCLUDES
+#include <algorithm>
 #include <dali/public-api/rendering/geometry.h>
 #include <dali/public-api/rendering/renderer.h>
 #include <dali/devel-api/text-abstraction/font-client.h>
@@ -114,26 +115,74 @@ struct AtlasRenderer::Impl
     {
     }
 
+    bool operator<( const CheckEntry& rhs ) const
+    {
+      return ( mFontId < rhs.mFontId ) || ( ( mFontId == rhs.mFontId ) && ( mIndex < rhs.mIndex ) );
+    }
+
+    bool operator==( const CheckEntry& rhs ) const
+    {
+      return ( mFontId == rhs.mFontId ) && ( mIndex == rhs.mIndex );
+    }
+
     FontId mFontId;
     Text::GlyphIndex mIndex;
   };
 
+  /**
+   * @brief Caches the quad generated for a glyph of the previous render.
+   *
+   * There is one entry per glyph. White spaces and glyphs which couldn't be rasterised have no quad (mImageId is zero).
+   */
   struct TextCacheEntry
   {
     TextCacheEntry()
     : mFontId( 0 ),
       mIndex( 0 ),
-      mImageId( 0 )
+      mImageId( 0 ),
+      mAtlasId( 0 ),
+      mScaleFactor( 0.0f ),
+      mPosition(),
+      mColor()
     {
     }
 
     FontId mFontId;
     Text::GlyphIndex mIndex;
     uint32_t mImageId;
+    uint32_t mAtlasId;
+    float mScaleFactor;
+    Vector2 mPosition;                        ///< The position of the glyph within the text.
+    Vector4 mColor;                           ///< The color of the glyph.
+    AtlasManager::Vertex2D mVertices[4];      ///< The vertices of the glyph's quad.
+  };
+
+  /**
+   * @brief An actor rendering the glyphs of one atlas.
+   *
+   * The actors of the previous render are kept to be reused by the next one.
+   */
+  struct MeshActor
+  {
+    MeshActor()
+    : mAtlasId( 0u ),
+      mIsShadow( false ),
+      mOffsetIndex( Property::INVALID_INDEX )
+    {
+    }
+
+    uint32_t mAtlasId;
+    bool mIsShadow;
+    Actor mActor;
+    PropertyBuffer mQuadVertices;
+    Geometry mQuadGeometry;
+    Dali::Renderer mRenderer;
+    Property::Index mOffsetIndex;             ///< The index of the uOffset property.
   };
 
   Impl()
-  : mDepth( 0 )
+  : mTextSize(),
+    mDepth( 0 )
   {
     mGlyphManager = AtlasGlyphManager::Get();
     mFontClient = TextAbstraction::FontClient::Get();
@@ -162,7 +211,36 @@ struct AtlasRenderer::Impl
     return false;
   }
 
+  /**
+   * @brief Retrieves the color of a glyph.
+   */
+  const Vector4& GetGlyphColor( GlyphIndex index,
+                                const Vector4& defaultColor,
+                                const Vector4* const colorsBuffer,
+                                const ColorIndex* const colorIndicesBuffer ) const
+  {
+    const bool useDefaultColor = ( NULL == colorsBuffer );
+    const ColorIndex colorIndex = useDefaultColor ? 0u : *( colorIndicesBuffer + index );
+    return ( useDefaultColor || ( 0u == colorIndex ) ) ? defaultColor : *( colorsBuffer + colorIndex - 1u );
+  }
+
+  /**
+   * @brief Whether the quad cached for a glyph of the previous render can be reused for a glyph of the new one.
+   */
+  bool IsSameGlyph( const TextCacheEntry& textCacheEntry,
+                    const GlyphInfo& glyph,
+                    const Vector2& position,
+                    const Vector4& color ) const
+  {
+    return ( textCacheEntry.mFontId == glyph.fontId ) &&
+           ( textCacheEntry.mIndex == glyph.index ) &&
+           ( textCacheEntry.mPosition == position ) &&
+           ( textCacheEntry.mColor == color ) &&
+           Equals( textCacheEntry.mScaleFactor, glyph.scaleFactor );
+  }
+
   void AddGlyphs( Text::ViewInterface& view,
+                  GlyphIndex glyphIndex,
                   const Vector<Vector2>& positions,
                   const Vector<GlyphInfo>& glyphs,
                   const Vector4& defaultColor,
@@ -170,10 +248,8 @@ struct AtlasRenderer::Impl
                   const ColorIndex* const colorIndicesBuffer,
                   int depth )
   {
-    AtlasManager::AtlasSlot slot;
     std::vector< MeshRecord > meshContainer;
     Vector< Extent > extents;
-    TextCacheEntry textCacheEntry;
     mDepth = depth;
 
     const Vector2& textSize( view.GetLayoutSize() );
@@ -184,8 +260,6 @@ struct AtlasRenderer::Impl
     const Vector4& underlineColor( view.GetUnderlineColor() );
     const float underlineHeight( view.GetUnderlineHeight() );
 
-    const bool useDefaultColor = ( NULL == colorsBuffer );
-
     // Get the underline runs.
     const Length numberOfUnderlineRuns = view.GetNumberOfUnderlineRuns();
     Vector<GlyphRun> underlineRuns;
@@ -198,8 +272,6 @@ struct AtlasRenderer::Impl
 
     float currentUnderlinePosition = ZERO;
     float currentUnderlineThickness = underlineHeight;
-    uint32_t currentBlockSize = 0;
-    FontId lastFontId = 0;
     FontId lastUnderlinedFontId = 0;
     Style style = STYLE_NORMAL;
 
@@ -208,22 +280,163 @@ struct AtlasRenderer::Impl
       style = STYLE_DROP_SHADOW;
     }
 
-    CalculateBlocksSize( glyphs );
-
-    // Avoid emptying mTextCache (& removing references) until after incremented references for the new text
-    Vector< TextCacheEntry > newTextCache;
     const GlyphInfo* const glyphsBuffer = glyphs.Begin();
     const Vector2* const positionsBuffer = positions.Begin();
+    const Length numberOfGlyphs = glyphs.Count();
+
+    // Find the glyphs at the beginning and at the end of the text which are unchanged since the previous render.
+    // Their quads and glyph references are kept; only the quads of the glyphs in between are generated.
+    Length numberOfGlyphsBefore = 0u;
+    Length numberOfGlyphsAfter = 0u;
+    const Length numberOfCachedGlyphs = mTextCache.Count();
 
-    for( uint32_t i = 0, glyphSize = glyphs.Size(); i < glyphSize; ++i )
+    if( textSize == mTextSize )
+    {
+      const Length numberOfComparableGlyphs = std::min( numberOfGlyphs, numberOfCachedGlyphs );
+
+      while( ( numberOfGlyphsBefore < numberOfComparableGlyphs ) &&
+             IsSameGlyph( *( mTextCache.Begin() + numberOfGlyphsBefore ),
+                          *( glyphsBuffer + numberOfGlyphsBefore ),
+                          *( positionsBuffer + numberOfGlyphsBefore ),
+                          GetGlyphColor( numberOfGlyphsBefore, defaultColor, colorsBuffer, colorIndicesBuffer ) ) )
+      {
+        ++numberOfGlyphsBefore;
+      }
+
+      while( ( numberOfGlyphsBefore + numberOfGlyphsAfter < numberOfComparableGlyphs ) &&
+             IsSameGlyph( *( mTextCache.End() - 1u - numberOfGlyphsAfter ),
+                          *( glyphsBuffer + numberOfGlyphs - 1u - numberOfGlyphsAfter ),
+                          *( positionsBuffer + numberOfGlyphs - 1u - numberOfGlyphsAfter ),
+                          GetGlyphColor( numberOfGlyphs - 1u - numberOfGlyphsAfter, defaultColor, colorsBuffer, colorIndicesBuffer ) ) )
+      {
+        ++numberOfGlyphsAfter;
+      }
+    }
+    mTextSize = textSize;
+
+    const Length changedGlyphsEnd = numberOfGlyphs - numberOfGlyphsAfter;
+
+    CalculateBlocksSize( glyphsBuffer + numberOfGlyphsBefore, changedGlyphsEnd - numberOfGlyphsBefore );
+
+    // Rasterise and add to the atlases all the changed glyphs which are not cached yet, before generating any mesh.
+    Vector< CheckEntry > newGlyphs;
+    Vector< AtlasManager::AtlasSlot > slots;
+    CacheGlyphs( glyphsBuffer + numberOfGlyphsBefore, changedGlyphsEnd - numberOfGlyphsBefore, newGlyphs, slots );
+
+    // Avoid removing the references of the previous render until after incremented references for the new text
+    Vector< TextCacheEntry > newTextCache;
+    newTextCache.Resize( numberOfGlyphs );
+
+    // Reuse the unchanged glyphs
+    if( 0u != numberOfGlyphsBefore )
+    {
+      memcpy( newTextCache.Begin(), mTextCache.Begin(), numberOfGlyphsBefore * sizeof( TextCacheEntry ) );
+    }
+    if( 0u != numberOfGlyphsAfter )
+    {
+      memcpy( newTextCache.Begin() + changedGlyphsEnd, mTextCache.End() - numberOfGlyphsAfter, numberOfGlyphsAfter * sizeof( TextCacheEntry ) );
+    }
+
+    // Generate the quads of the changed glyphs
+    AtlasManager::AtlasSlot slot;
+    for( Length i = numberOfGlyphsBefore; i < changedGlyphsEnd; ++i )
     {
       const GlyphInfo& glyph = *( glyphsBuffer + i );
+      TextCacheEntry& textCacheEntry = *( newTextCache.Begin() + i );
+
+      textCacheEntry.mFontId = glyph.fontId;
+      textCacheEntry.mIndex = glyph.index;
+      textCacheEntry.mImageId = 0u;
+      textCacheEntry.mAtlasId = 0u;
+      textCacheEntry.mScaleFactor = glyph.scaleFactor;
+      textCacheEntry.mPosition = *( positionsBuffer + i );
+      textCacheEntry.mColor = GetGlyphColor( i, defaultColor, colorsBuffer, colorIndicesBuffer );
+
+      // No operation for white space or for a glyph which couldn't be rasterised.
+      slot = *( slots.Begin() + ( i - numberOfGlyphsBefore ) );
+      if( 0u == slot.mImageId )
+      {
+        continue;
+      }
+
+      // Reference the glyph for the new text
+      mGlyphManager.AdjustReferenceCount( glyph.fontId, glyph.index, 1/*increment*/ );
+      textCacheEntry.mImageId = slot.mImageId;
+      textCacheEntry.mAtlasId = slot.mAtlasId;
 
-      const bool underlineGlyph = underlineEnabled || IsGlyphUnderlined( i, underlineRuns );
+      // Move the origin (0,0) of the mesh to the center of the actor
+      const Vector2 position = textCacheEntry.mPosition - halfTextSize;
+
+      // Generate mesh data for this quad, plugging in our supplied position
+      AtlasManager::Mesh2D newMesh;
+      mGlyphManager.GenerateMeshData( slot.mImageId, position, newMesh );
+
+      DALI_ASSERT_DEBUG( 4u == newMesh.mVertices.Count() && "A glyph should be a quad" );
+      AtlasManager::Vertex2D* verticesBuffer = newMesh.mVertices.Begin();
+
+      for( unsigned int index = 0u; index < 4u; ++index )
+      {
+        AtlasManager::Vertex2D& vertex = *( verticesBuffer + index );
+
+        // Adjust the vertices if the fixed-size font should be down-scaled
+        if( glyph.scaleFactor > 0 )
+        {
+          // Set the position of the vertex.
+          vertex.mPosition.x = position.x + ( ( vertex.mPosition.x - position.x ) * glyph.scaleFactor );
+          vertex.mPosition.y = position.y + ( ( vertex.mPosition.y - position.y ) * glyph.scaleFactor );
+        }
+
+        // Set the color of the vertex.
+        vertex.mColor = textCacheEntry.mColor;
+
+        textCacheEntry.mVertices[index] = vertex;
+      }
+    }
+
+    // Remove the reference added by CacheGlyphs(), the new glyphs are now referenced by the new text.
+    for( Vector< CheckEntry >::ConstIterator it = newGlyphs.Begin(),
+           endIt = newGlyphs.End();
+         it != endIt;
+         ++it )
+    {
+      mGlyphManager.AdjustReferenceCount( it->mFontId, it->mIndex, -1/*decrement*/ );
+    }
+
+    // Now remove references for the changed glyphs of the old text
+    for( Vector< TextCacheEntry >::ConstIterator it = mTextCache.Begin() + numberOfGlyphsBefore,
+           endIt = mTextCache.End() - numberOfGlyphsAfter;
+         it < endIt;
+         ++it )
+    {
+      if( 0u != it->mImageId )
+      {
+        mGlyphManager.AdjustReferenceCount( it->mFontId, it->mIndex, -1/*decrement*/ );
+      }
+    }
+    mTextCache.Swap( newTextCache );
+
+    DALI_LOG_INFO( gLogFilter, Debug::General, "TextAtlasRenderer::AddGlyphs glyphs: %d, regenerated: %d\n", numberOfGlyphs, changedGlyphsEnd - numberOfGlyphsBefore );
+
+    // Stitch the quads of all the glyphs into meshes, one per atlas
+    AtlasManager::Mesh2D newMesh;
+    newMesh.mIndices.PushBack( 1u );
+    newMesh.mIndices.PushBack( 0u );
+    newMesh.mIndices.PushBack( 2u );
+    newMesh.mIndices.PushBack( 2u );
+    newMesh.mIndices.PushBack( 3u );
+    newMesh.mIndices.PushBack( 1u );
+    newMesh.mVertices.Resize( 4u );
+
+    for( Length i = 0u; i < numberOfGlyphs; ++i )
+    {
+      const GlyphInfo& glyph = *( glyphsBuffer + i );
+      const TextCacheEntry& textCacheEntry = *( mTextCache.Begin() + i );
+
+      const bool underlineGlyph = underlineEnabled || IsGlyphUnderlined( glyphIndex + i, underlineRuns );
       thereAreUnderlinedGlyphs = thereAreUnderlinedGlyphs || underlineGlyph;
 
       // No operation for white space
-      if( glyph.width && glyph.height )
+      if( 0u != textCacheEntry.mImageId )
       {
         // Are we still using the same fontId as previous
         if( underlineGlyph && ( glyph.fontId != lastUnderlinedFontId ) )
@@ -264,199 +477,69 @@ struct AtlasRenderer::Impl
           lastUnderlinedFontId = glyph.fontId;
         } // underline
 
-        if( !mGlyphManager.IsCached( glyph.fontId, glyph.index, slot ) )
-        {
-          // Select correct size for new atlas if needed....?
-          if( lastFontId != glyph.fontId )
-          {
-            uint32_t index = 0u;
-            for( std::vector<MaxBlockSize>::const_iterator it = mBlockSizes.begin(),
-                   endIt = mBlockSizes.end();
-                 it != endIt;
-                 ++it, ++index )
-            {
-              const MaxBlockSize& blockSize = *it;
-              if( blockSize.mFontId == glyph.fontId )
-              {
-                currentBlockSize = index;
-                mGlyphManager.SetNewAtlasSize( DEFAULT_ATLAS_WIDTH,
-                                               DEFAULT_ATLAS_HEIGHT,
-                                               blockSize.mNeededBlockWidth,
-                                               blockSize.mNeededBlockHeight );
-              }
-            }
-          }
-
-          // Create a new image for the glyph
-          PixelData bitmap = mFontClient.CreateBitmap( glyph.fontId, glyph.index );
-          if( bitmap )
-          {
-            MaxBlockSize& blockSize = mBlockSizes[currentBlockSize];
+        memcpy( newMesh.mVertices.Begin(), textCacheEntry.mVertices, 4u * sizeof( AtlasManager::Vertex2D ) );
 
-            // Ensure that the next image will fit into the current block size
-            bool setSize = false;
-            if( bitmap.GetWidth() > blockSize.mNeededBlockWidth )
-            {
-              setSize = true;
-              blockSize.mNeededBlockWidth = bitmap.GetWidth();
-            }
-            if( bitmap.GetHeight() > blockSize.mNeededBlockHeight )
-            {
-              setSize = true;
-              blockSize.mNeededBlockHeight = bitmap.GetHeight();
-            }
-
-            if( setSize )
-            {
-              mGlyphManager.SetNewAtlasSize( DEFAULT_ATLAS_WIDTH,
-                                             DEFAULT_ATLAS_HEIGHT,
-                                             blockSize.mNeededBlockWidth,
-                                             blockSize.mNeededBlockHeight );
-            }
-
-            // Locate a new slot for our glyph
-            mGlyphManager.Add( glyph, bitmap, slot );
-          }
-        }
-        else
-        {
-          // We have 2+ copies of the same glyph
-          mGlyphManager.AdjustReferenceCount( glyph.fontId, glyph.index, 1/*increment*/ );
-        }
-
-        // Move the origin (0,0) of the mesh to the center of the actor
-        const Vector2 position = *( positionsBuffer + i ) - halfTextSize;
-
-        // Generate mesh data for this quad, plugging in our supplied position
-        AtlasManager::Mesh2D newMesh;
-        mGlyphManager.GenerateMeshData( slot.mImageId, position, newMesh );
-        textCacheEntry.mFontId = glyph.fontId;
-        textCacheEntry.mImageId = slot.mImageId;
-        textCacheEntry.mIndex = glyph.index;
-        newTextCache.PushBack( textCacheEntry );
-
-        AtlasManager::Vertex2D* verticesBuffer = newMesh.mVertices.Begin();
-
-        // Adjust the vertices if the fixed-size font should be down-scaled
-        if( glyph.scaleFactor > 0 )
-        {
-          for( unsigned int index = 0u, size = newMesh.mVertices.Count();
-               index < size;
-               ++index )
-          {
-            AtlasManager::Vertex2D& vertex = *( verticesBuffer + index );
-
-            // Set the position of the vertex.
-            vertex.mPosition.x = position.x + ( ( vertex.mPosition.x - position.x ) * glyph.scaleFactor );
-            vertex.mPosition.y = position.y + ( ( vertex.mPosition.y - position.y ) * glyph.scaleFactor );
-          }
-        }
-
-        // Get the color of the character.
-        const ColorIndex colorIndex = useDefaultColor ? 0u : *( colorIndicesBuffer + i );
-        const Vector4& color = ( useDefaultColor || ( 0u == colorIndex ) ) ? defaultColor : *( colorsBuffer + colorIndex - 1u );
-
-        for( unsigned int index = 0u, size = newMesh.mVertices.Count();
-             index < size;
-             ++index )
-        {
-          AtlasManager::Vertex2D& vertex = *( verticesBuffer + index );
-
-          // Set the color of the vertex.
-          vertex.mColor = color;
-        }
+        slot.mImageId = textCacheEntry.mImageId;
+        slot.mAtlasId = textCacheEntry.mAtlasId;
 
         // Find an existing mesh data object to attach to ( or create a new one, if we can't find one using the same atlas)
         StitchTextMesh( meshContainer,
                         newMesh,
                         extents,
-                        position.y + glyph.yBearing,
+                        textCacheEntry.mPosition.y - halfTextSize.y + glyph.yBearing,
                         underlineGlyph,
                         currentUnderlinePosition,
                         currentUnderlineThickness,
                         slot );
-        lastFontId = glyph.fontId;
       }
     } // glyphs
 
-    // Now remove references for the old text
-    RemoveText();
-    mTextCache.Swap( newTextCache );
-
     if( thereAreUnderlinedGlyphs )
     {
       // Check to see if any of the text needs an underline
       GenerateUnderlines( meshContainer, extents, underlineColor );
     }
 
-    // For each MeshData object, create a mesh actor and add to the renderable actor
+    // Update the mesh actors, reusing the ones of the previous render
     if( !meshContainer.empty() )
     {
       if( !mActor )
       {
         // Create a container actor to act as a common parent for text and shadow, to avoid color inheritence issues.
         mActor = Actor::New();
-        mActor.SetParentOrigin( ParentOrigin::TOP_LEFT );
-        mActor.SetAnchorPoint( AnchorPoint::TOP_LEFT );
-        mActor.SetSize( textSize );
       }
+      mActor.SetParentOrigin( ParentOrigin::TOP_LEFT );
+      mActor.SetAnchorPoint( AnchorPoint::TOP_LEFT );
+      mActor.SetSize( textSize );
 
-      for( std::vector< MeshRecord >::iterator it = meshContainer.begin(),
-              endIt = meshContainer.end();
-            it != endIt; ++it )
-      {
-        MeshRecord& meshRecord = *it;
-
-        Actor actor = CreateMeshActor( meshRecord, textSize );
-
-        // Whether the actor has renderers.
-        const bool hasRenderer = actor.GetRendererCount() > 0u;
-
-        // Create an effect if necessary
-        if( hasRenderer &&
-            ( style == STYLE_DROP_SHADOW ) )
-        {
-          // Change the color of the vertices.
-          for( Vector<AtlasManager::Vertex2D>::Iterator vIt =  meshRecord.mMesh.mVertices.Begin(),
-                 vEndIt = meshRecord.mMesh.mVertices.End();
-               vIt != vEndIt;
-               ++vIt )
-          {
-            AtlasManager::Vertex2D& vertex = *vIt;
-
-            vertex.mColor = shadowColor;
-          }
-
-          Actor shadowActor = CreateMeshActor( meshRecord, textSize );
-#if defined(DEBUG_ENABLED)
-          shadowActor.SetName( "Text Shadow renderable actor" );
-#endif
-          // Offset shadow in x and y
-          shadowActor.RegisterProperty("uOffset", shadowOffset );
-          Dali::Renderer renderer( shadowActor.GetRendererAt( 0 ) );
-          int depthIndex = renderer.GetProperty<int>(Dali::Renderer::Property::DEPTH_INDEX);
-          renderer.SetProperty( Dali::Renderer::Property::DEPTH_INDEX, depthIndex - 1 );
-          mActor.Add( shadowActor );
-        }
-
-        if( hasRenderer )
-        {
-          mActor.Add( actor );
-        }
-      }
+      UpdateMeshActors( meshContainer, textSize, style, shadowOffset, shadowColor );
+    }
+    else
+    {
+      RemoveMeshActors();
     }
 #if defined(DEBUG_ENABLED)
     Toolkit::AtlasGlyphManager::Metrics metrics = mGlyphManager.GetMetrics();
-    DALI_LOG_INFO( gLogFilter, Debug::General, "TextAtlasRenderer::GlyphManager::GlyphCount: %i, AtlasCount: %i, TextureMemoryUse: %iK\n",
+    DALI_LOG_INFO( gLogFilter, Debug::General, "TextAtlasRenderer::GlyphManager::GlyphCount: %i, AtlasCount: %i, TextureMemoryUse: %iK, CacheHits: %i, CacheMisses: %i\n",
                                                 metrics.mGlyphCount,
                                                 metrics.mAtlasMetrics.mAtlasCount,
-                                                metrics.mAtlasMetrics.mTextureMemoryUsed / 1024 );
+                                                metrics.mAtlasMetrics.mTextureMemoryUsed / 1024,
+                                                metrics.mCacheHits,
+                                                metrics.mCacheMisses );
 
     DALI_LOG_INFO( gLogFilter, Debug::Verbose, "%s\n", metrics.mVerboseGlyphCounts.c_str() );
+    DALI_LOG_INFO( gLogFilter, Debug::Verbose, "   ImageIds: %i, Free: %i\n",
+                                               metrics.mAtlasMetrics.mImageIdCount,
+                                               metrics.mAtlasMetrics.mFreeImageIdCount );
+    DALI_LOG_INFO( gLogFilter, Debug::Verbose, "   MemoryBudget: %iK, UnreferencedGlyphs: %i, EvictedGlyphs: %i, ReleasedAtlases: %i\n",
+                                               metrics.mMemoryBudget / 1024,
+                                               metrics.mUnreferencedGlyphCount,
+                                               metrics.mEvictedGlyphCount,
+                                               metrics.mReleasedAtlasCount );
 
     for( uint32_t i = 0; i < metrics.mAtlasMetrics.mAtlasCount; ++i )
     {
-      DALI_LOG_INFO( gLogFilter, Debug::Verbose, "   Atlas [%i] %sPixels: %s Size: %ix%i, BlockSize: %ix%i, BlocksUsed: %i/%i\n",
+      DALI_LOG_INFO( gLogFilter, Debug::Verbose, "   Atlas [%i] %sPixels: %s Size: %ix%i, BlockSize: %ix%i, BlocksUsed: %i/%i, Images: %i\n",
                                                  i + 1, i > 8 ? "" : " ",
                                                  metrics.mAtlasMetrics.mAtlasMetrics[ i ].mPixelFormat == Pixel::L8 ? "L8  " : "BGRA",
                                                  metrics.mAtlasMetrics.mAtlasMetrics[ i ].mSize.mWidth,
@@ -464,47 +547,338 @@ struct AtlasRenderer::Impl
                                                  metrics.mAtlasMetrics.mAtlasMetrics[ i ].mSize.mBlockWidth,
                                                  metrics.mAtlasMetrics.mAtlasMetrics[ i ].mSize.mBlockHeight,
                                                  metrics.mAtlasMetrics.mAtlasMetrics[ i ].mBlocksUsed,
-                                                 metrics.mAtlasMetrics.mAtlasMetrics[ i ].mTotalBlocks );
+                                                 metrics.mAtlasMetrics.mAtlasMetrics[ i ].mTotalBlocks,
+                                                 metrics.mAtlasMetrics.mAtlasMetrics[ i ].mImageCount );
     }
 #endif
   }
 
+  /**
+   * @brief Rasterises the glyphs which are not cached yet and adds them to the atlases.
+   *
+   * All the missing glyphs are rasterised first so the block size needed by each font
+   * is known before any atlas is created. The glyphs are then added grouped by font.
+   *
+   * Each added glyph has a reference count of one which must be removed by the caller.
+   *
+   * Each glyph is looked up once, so the cache hits and misses of the metrics are counted once per glyph.
+   *
+   * @param[in] glyphsBuffer The glyphs of the text.
+   * @param[in] numberOfGlyphs The number of glyphs.
+   * @param[out] newGlyphs The glyphs added to the atlases.
+   * @param[out] slots The slot of each glyph. The image id is zero for the white spaces and the glyphs which couldn't be rasterised.
+   */
+  void CacheGlyphs( const GlyphInfo* const glyphsBuffer,
+                    Length numberOfGlyphs,
+                    Vector< CheckEntry >& newGlyphs,
+                    Vector< AtlasManager::AtlasSlot >& slots )
+  {
+    AtlasManager::AtlasSlot slot;
+    slot.mImageId = 0u;
+    slot.mAtlasId = 0u;
+    slots.Resize( numberOfGlyphs, slot );
+
+    CheckEntry entry;
+    for( Length index = 0u; index < numberOfGlyphs; ++index )
+    {
+      const GlyphInfo& glyph = *( glyphsBuffer + index );
+
+      // No operation for white space
+      if( glyph.width && glyph.height &&
+          !mGlyphManager.IsCached( glyph.fontId, glyph.index, *( slots.Begin() + index ) ) )
+      {
+        entry.mFontId = glyph.fontId;
+        entry.mIndex = glyph.index;
+        newGlyphs.PushBack( entry );
+      }
+    }
+
+    if( newGlyphs.Empty() )
+    {
+      return;
+    }
+
+    // Remove the duplicates and group the glyphs by font.
+    std::sort( newGlyphs.Begin(), newGlyphs.End() );
+    newGlyphs.Resize( std::unique( newGlyphs.Begin(), newGlyphs.End() ) - newGlyphs.Begin() );
+
+    // Rasterise all the new glyphs.
+    std::vector< PixelData > bitmaps;
+    bitmaps.reserve( newGlyphs.Count() );
+    for( Vector< CheckEntry >::ConstIterator it = newGlyphs.Begin(),
+           endIt = newGlyphs.End();
+         it != endIt;
+         ++it )
+    {
+      PixelData bitmap = mFontClient.CreateBitmap( it->mFontId, it->mIndex );
+      if( bitmap )
+      {
+        // Ensure that the image will fit into the block size of the font
+        MaxBlockSize& blockSize = GetBlockSize( it->mFontId );
+        blockSize.mNeededBlockWidth = std::max( blockSize.mNeededBlockWidth, bitmap.GetWidth() );
+        blockSize.mNeededBlockHeight = std::max( blockSize.mNeededBlockHeight, bitmap.GetHeight() );
+      }
+      bitmaps.push_back( bitmap );
+    }
+
+    // Add the glyphs to the atlases.
+    Vector< AtlasManager::AtlasSlot > addedSlots;
+    addedSlots.Resize( newGlyphs.Count() );
+    GlyphInfo glyph;
+    FontId lastFontId = 0u;
+    Length numberOfAddedGlyphs = 0u;
+    for( Length index = 0u, numberOfGlyphs = newGlyphs.Count(); index < numberOfGlyphs; ++index )
+    {
+      const CheckEntry& newGlyph = *( newGlyphs.Begin() + index );
+      const PixelData& bitmap = bitmaps[index];
+
+      if( !bitmap )
+      {
+        continue;
+      }
+
+      if( lastFontId != newGlyph.mFontId )
+      {
+        // Select correct size for new atlas if needed.
+        const MaxBlockSize& blockSize = GetBlockSize( newGlyph.mFontId );
+        mGlyphManager.SetNewAtlasSize( DEFAULT_ATLAS_WIDTH,
+                                       DEFAULT_ATLAS_HEIGHT,
+                                       blockSize.mNeededBlockWidth,
+                                       blockSize.mNeededBlockHeight );
+        lastFontId = newGlyph.mFontId;
+      }
+
+      glyph.fontId = newGlyph.mFontId;
+      glyph.index = newGlyph.mIndex;
+
+      // Locate a new slot for our glyph
+      mGlyphManager.Add( glyph, bitmap, slot );
+      if( 0u == slot.mImageId )
+      {
+        continue;
+      }
+
+      *( newGlyphs.Begin() + numberOfAddedGlyphs ) = newGlyph;
+      *( addedSlots.Begin() + numberOfAddedGlyphs ) = slot;
+      ++numberOfAddedGlyphs;
+    }
+
+    // Only keep the glyphs actually added.
+    newGlyphs.Resize( numberOfAddedGlyphs );
+
+    // Set the slots of the added glyphs. The glyphs are still sorted.
+    for( Length index = 0u; index < numberOfGlyphs; ++index )
+    {
+      const GlyphInfo& changedGlyph = *( glyphsBuffer + index );
+      if( !changedGlyph.width || !changedGlyph.height || ( 0u != ( slots.Begin() + index )->mImageId ) )
+      {
+        continue;
+      }
+
+      entry.mFontId = changedGlyph.fontId;
+      entry.mIndex = changedGlyph.index;
+      const CheckEntry* const found = std::lower_bound( newGlyphs.Begin(), newGlyphs.End(), entry );
+      if( ( found != newGlyphs.End() ) && ( *found == entry ) )
+      {
+        *( slots.Begin() + index ) = *( addedSlots.Begin() + ( found - newGlyphs.Begin() ) );
+      }
+    }
+  }
+
+  /**
+   * @brief Retrieves the block size needed by a font.
+   *
+   * @pre CalculateBlocksSize() has been called for the glyphs of the font.
+   *
+   * @param[in] fontId The font id.
+   *
+   * @return The block size.
+   */
+  MaxBlockSize& GetBlockSize( FontId fontId )
+  {
+    for( std::vector<MaxBlockSize>::iterator it = mBlockSizes.begin(),
+           endIt = mBlockSizes.end();
+         it != endIt;
+         ++it )
+    {
+      if( it->mFontId == fontId )
+      {
+        return *it;
+      }
+    }
+
+    DALI_ASSERT_DEBUG( false && "Block size not calculated for the font" );
+    return mBlockSizes.front();
+  }
+
   void RemoveText()
   {
     for( Vector< TextCacheEntry >::Iterator oldTextIter = mTextCache.Begin(); oldTextIter != mTextCache.End(); ++oldTextIter )
     {
-      mGlyphManager.AdjustReferenceCount( oldTextIter->mFontId, oldTextIter->mIndex, -1/*decrement*/ );
+      if( 0u != oldTextIter->mImageId )
+      {
+        mGlyphManager.AdjustReferenceCount( oldTextIter->mFontId, oldTextIter->mIndex, -1/*decrement*/ );
+      }
     }
     mTextCache.Resize( 0 );
   }
 
-  Actor CreateMeshActor( const MeshRecord& meshRecord, const Vector2& actorSize )
+  /**
+   * @brief Retrieves an actor of the previous render to render the mesh of an atlas, or creates a new one.
+   *
+   * @param[in] atlasId The atlas of the mesh.
+   * @param[in] isShadow Whether the actor renders the shadow of the text.
+   * @param[in,out] usedActors Whether each actor of mMeshActors is already used by the current render.
+   *
+   * @return The index of the actor within mMeshActors.
+   */
+  std::size_t AcquireMeshActor( uint32_t atlasId, bool isShadow, std::vector< bool >& usedActors )
   {
-    PropertyBuffer quadVertices = PropertyBuffer::New( mQuadVertexFormat );
-    quadVertices.SetData( const_cast< AtlasManager::Vertex2D* >( &meshRecord.mMesh.mVertices[ 0 ] ), meshRecord.mMesh.mVertices.Size() );
-
-    Geometry quadGeometry = Geometry::New();
-    quadGeometry.AddVertexBuffer( quadVertices );
-    quadGeometry.SetIndexBuffer( &meshRecord.mMesh.mIndices[0],  meshRecord.mMesh.mIndices.Size() );
-
-    TextureSet textureSet( mGlyphManager.GetTextures( meshRecord.mAtlasId ) );
-    Shader shader( mGlyphManager.GetShader( meshRecord.mAtlasId ) );
-    Dali::Renderer renderer = Dali::Renderer::New( quadGeometry, shader );
-    renderer.SetTextures( textureSet );
-    renderer.SetProperty( Dali::Renderer::Property::BLEND_MODE, BlendMode::ON );
-    renderer.SetProperty( Dali::Renderer::Property::DEPTH_INDEX, DepthIndex::CONTENT + mDepth );
-    Actor actor = Actor::New();
+    for( std::size_t index = 0u, size = mMeshActors.size(); index < size; ++index )
+    {
+      const MeshActor& meshActor = mMeshActors[index];
+      if( !usedActors[index] &&
+          ( meshActor.mAtlasId == atlasId ) &&
+          ( meshActor.mIsShadow == isShadow ) )
+      {
+        usedActors[index] = true;
+        return index;
+      }
+    }
+
+    MeshActor meshActor;
+    meshActor.mAtlasId = atlasId;
+    meshActor.mIsShadow = isShadow;
+
+    meshActor.mQuadVertices = PropertyBuffer::New( mQuadVertexFormat );
+    meshActor.mQuadGeometry = Geometry::New();
+    meshActor.mQuadGeometry.AddVertexBuffer( meshActor.mQuadVertices );
+
+    meshActor.mRenderer = Dali::Renderer::New( meshActor.mQuadGeometry, mGlyphManager.GetShader( atlasId ) );
+    meshActor.mRenderer.SetProperty( Dali::Renderer::Property::BLEND_MODE, BlendMode::ON );
+
+    meshActor.mActor = Actor::New();
 #if defined(DEBUG_ENABLED)
-    actor.SetName( "Text renderable actor" );
+    meshActor.mActor.SetName( isShadow ? "Text Shadow renderable actor" : "Text renderable actor" );
 #endif
-    actor.AddRenderer( renderer );
+    meshActor.mActor.AddRenderer( meshActor.mRenderer );
 
     // Keep all of the origins aligned
-    actor.SetParentOrigin( ParentOrigin::TOP_LEFT );
-    actor.SetAnchorPoint( AnchorPoint::TOP_LEFT );
-    actor.SetSize( actorSize );
-    actor.RegisterProperty("uOffset", Vector2::ZERO );
-    return actor;
+    meshActor.mActor.SetParentOrigin( ParentOrigin::TOP_LEFT );
+    meshActor.mActor.SetAnchorPoint( AnchorPoint::TOP_LEFT );
+    meshActor.mOffsetIndex = meshActor.mActor.RegisterProperty( "uOffset", Vector2::ZERO );
+
+    mMeshActors.push_back( meshActor );
+    usedActors.push_back( true );
+
+    return mMeshActors.size() - 1u;
+  }
+
+  /**
+   * @brief Updates the vertices, indices and textures of a mesh actor and adds it to the text's actor.
+   */
+  void UpdateMeshActor( MeshActor& meshActor,
+                        const MeshRecord& meshRecord,
+                        const Vector2& actorSize,
+                        const Vector2& offset,
+                        int depthIndex )
+  {
+    meshActor.mQuadVertices.SetData( const_cast< AtlasManager::Vertex2D* >( &meshRecord.mMesh.mVertices[ 0 ] ), meshRecord.mMesh.mVertices.Size() );
+    meshActor.mQuadGeometry.SetIndexBuffer( &meshRecord.mMesh.mIndices[0],  meshRecord.mMesh.mIndices.Size() );
+
+    // The atlas may have a different texture or pixel format since the actor was created.
+    meshActor.mRenderer.SetTextures( mGlyphManager.GetTextures( meshRecord.mAtlasId ) );
+    meshActor.mRenderer.SetShader( mGlyphManager.GetShader( meshRecord.mAtlasId ) );
+    meshActor.mRenderer.SetProperty( Dali::Renderer::Property::DEPTH_INDEX, depthIndex );
+
+    meshActor.mActor.SetSize( actorSize );
+    meshActor.mActor.SetProperty( meshActor.mOffsetIndex, offset );
+
+    if( !meshActor.mActor.GetParent() )
+    {
+      mActor.Add( meshActor.mActor );
+    }
+  }
+
+  /**
+   * @brief Renders the meshes of the text, reusing the actors of the previous render.
+   *
+   * Actors of the previous render which are not needed any more are removed.
+   */
+  void UpdateMeshActors( std::vector< MeshRecord >& meshContainer,
+                         const Vector2& actorSize,
+                         Style style,
+                         const Vector2& shadowOffset,
+                         const Vector4& shadowColor )
+  {
+    std::vector< bool > usedActors( mMeshActors.size(), false );
+
+    for( std::vector< MeshRecord >::iterator it = meshContainer.begin(),
+            endIt = meshContainer.end();
+          it != endIt; ++it )
+    {
+      MeshRecord& meshRecord = *it;
+
+      if( meshRecord.mMesh.mVertices.Empty() )
+      {
+        continue;
+      }
+
+      std::size_t index = AcquireMeshActor( meshRecord.mAtlasId, false, usedActors );
+      UpdateMeshActor( mMeshActors[index], meshRecord, actorSize, Vector2::ZERO, DepthIndex::CONTENT + mDepth );
+
+      // Create an effect if necessary
+      if( style == STYLE_DROP_SHADOW )
+      {
+        // Change the color of the vertices.
+        for( Vector<AtlasManager::Vertex2D>::Iterator vIt =  meshRecord.mMesh.mVertices.Begin(),
+               vEndIt = meshRecord.mMesh.mVertices.End();
+             vIt != vEndIt;
+             ++vIt )
+        {
+          AtlasManager::Vertex2D& vertex = *vIt;
+
+          vertex.mColor = shadowColor;
+        }
+
+        // Offset shadow in x and y and render it behind the text
+        index = AcquireMeshActor( meshRecord.mAtlasId, true, usedActors );
+        UpdateMeshActor( mMeshActors[index], meshRecord, actorSize, shadowOffset, DepthIndex::CONTENT + mDepth - 1 );
+      }
+    }
+
+    // Remove the actors not used by this render.
+    std::size_t numberOfUsedActors = 0u;
+    for( std::size_t index = 0u, size = mMeshActors.size(); index < size; ++index )
+    {
+      if( usedActors[index] )
+      {
+        mMeshActors[numberOfUsedActors] = mMeshActors[index];
+        ++numberOfUsedActors;
+      }
+      else
+      {
+        UnparentAndReset( mMeshActors[index].mActor );
+      }
+    }
+    mMeshActors.resize( numberOfUsedActors, MeshActor() );
+  }
+
+  /**
+   * @brief Removes the text's actor and all the mesh actors.
+   */
+  void RemoveMeshActors()
+  {
+    for( std::vector< MeshActor >::iterator it = mMeshActors.begin(),
+           endIt = mMeshActors.end();
+         it != endIt;
+         ++it )
+    {
+      UnparentAndReset( it->mActor );
+    }
+    mMeshActors.clear();
+
+    UnparentAndReset( mActor );
   }
 
   void StitchTextMesh( std::vector< MeshRecord >& meshContainer,
@@ -620,10 +994,9 @@ struct AtlasRenderer::Impl
     }
   }
 
-  void CalculateBlocksSize( const Vector<GlyphInfo>& glyphs )
+  void CalculateBlocksSize( const GlyphInfo* const glyphsBuffer, Length numberOfGlyphs )
   {
-    for( Vector<GlyphInfo>::ConstIterator glyphIt = glyphs.Begin(),
-           glyphEndIt = glyphs.End();
+    for( const GlyphInfo* glyphIt = glyphsBuffer, * const glyphEndIt = glyphsBuffer + numberOfGlyphs;
          glyphIt != glyphEndIt;
          ++glyphIt )
     {
@@ -724,6 +1097,8 @@ struct AtlasRenderer::Impl
   TextAbstraction::FontClient mFontClient;            ///> The font client used to supply glyph information
   std::vector< MaxBlockSize > mBlockSizes;            ///> Maximum size needed to contain a glyph in a block within a new atlas
   Vector< TextCacheEntry > mTextCache;                ///> Caches data from previous render
+  std::vector< MeshActor > mMeshActors;               ///> The actors of the previous render, reused by the next one
+  Vector2 mTextSize;                                  ///> The layout size of the previous render
   Property::Map mQuadVertexFormat;                    ///> Describes the vertex format for text
   int mDepth;                                         ///> DepthIndex passed by control when connect to stage
 };
@@ -739,9 +1114,9 @@ Actor AtlasRenderer::Render( Text::ViewInterface& view, int depth )
 {
   DALI_LOG_INFO( gLogFilter, Debug::General, "Text::AtlasRenderer::Render()\n" );
 
-  UnparentAndReset( mImpl->mActor );
-
-  Length numberOfGlyphs = view.GetNumberOfGlyphs();
+  GlyphIndex glyphIndex = 0u;
+  Length numberOfGlyphs = 0u;
+  view.GetRenderedGlyphRange( glyphIndex, numberOfGlyphs );
 
   if( numberOfGlyphs > 0u )
   {
@@ -753,17 +1128,19 @@ Actor AtlasRenderer::Render( Text::ViewInterface& view, int depth )
 
     numberOfGlyphs = view.GetGlyphs( glyphs.Begin(),
                                      positions.Begin(),
-                                     0u,
+                                     glyphIndex,
                                      numberOfGlyphs );
 
     glyphs.Resize( numberOfGlyphs );
     positions.Resize( numberOfGlyphs );
 
+    // The color indices of the rendered glyphs.
     const Vector4* const colorsBuffer = view.GetColors();
-    const ColorIndex* const colorIndicesBuffer = view.GetColorIndices();
+    const ColorIndex* const colorIndicesBuffer = ( NULL == colorsBuffer ) ? NULL : view.GetColorIndices() + glyphIndex;
     const Vector4& defaultColor = view.GetTextColor();
 
     mImpl->AddGlyphs( view,
+                      glyphIndex,
                       positions,
                       glyphs,
                       defaultColor,
@@ -778,6 +1155,11 @@ Actor AtlasRenderer::Render( Text::ViewInterface& view, int depth )
       mImpl->mActor = Actor::New();
     }
   }
+  else
+  {
+    mImpl->RemoveText();
+    mImpl->RemoveMeshActors();
+  }
 
   return mImpl->mActor;
 }
@@ -193,7 +193,9 @@ Actor VectorBasedRenderer::Render( Text::ViewInterface& view, int /*depth*/ )
   mImpl->mActor.SetName( "Text renderable actor" );
 #endif
 
-  Length numberOfGlyphs = view.GetNumberOfGlyphs();
+  GlyphIndex glyphIndex = 0u;
+  Length numberOfGlyphs = 0u;
+  view.GetRenderedGlyphRange( glyphIndex, numberOfGlyphs );
 
   if( numberOfGlyphs > 0u )
   {
@@ -205,13 +207,14 @@ Actor VectorBasedRenderer::Render( Text::ViewInterface& view, int /*depth*/ )
 
     numberOfGlyphs = view.GetGlyphs( glyphs.Begin(),
                                      positions.Begin(),
-                                     0u,
+                                     glyphIndex,
                                      numberOfGlyphs );
     glyphs.Resize( numberOfGlyphs );
     positions.Resize( numberOfGlyphs );
 
+    // The color indices of the rendered glyphs.
     const Vector4* const colorsBuffer = view.GetColors();
-    const ColorIndex* const colorIndicesBuffer = view.GetColorIndices();
+    const ColorIndex* const colorIndicesBuffer = ( NULL == colorsBuffer ) ? NULL : view.GetColorIndices() + glyphIndex;
     const Vector4& defaultColor = view.GetTextColor();
 
     Vector< Vertex2D > vertices;
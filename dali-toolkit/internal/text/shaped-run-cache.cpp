@@ -0,0 +1,231 @@
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali-toolkit/internal/text/shaped-run-cache.h>
+
+// EXTERNAL INCLUDES
+#include <cstring>
+#include <dali/devel-api/adaptor-framework/singleton-service.h>
+#include <dali/integration-api/debug.h>
+
+namespace Dali
+{
+
+namespace Toolkit
+{
+
+namespace Text
+{
+
+namespace
+{
+
+#if defined(DEBUG_ENABLED)
+Debug::Filter* gLogFilter = Debug::Filter::New(Debug::NoLogging, true, "LOG_TEXT_SHAPED_RUN_CACHE");
+#endif
+
+const Length MAX_NUMBER_OF_CHARACTERS_PER_RUN = 64u;   ///< Longer runs are not cached.
+const Length MAX_NUMBER_OF_CHARACTERS = 32768u;        ///< The maximum number of characters of all the cached runs.
+
+/**
+ * @brief Calculates the hash of a run.
+ *
+ * @param[in] text Pointer to the first character of the run.
+ * @param[in] numberOfCharacters The number of characters of the run.
+ * @param[in] fontId The font used to shape the characters.
+ * @param[in] script The script used to shape the characters.
+ *
+ * @return The hash.
+ */
+uint32_t HashRun( const Character* const text,
+                  Length numberOfCharacters,
+                  FontId fontId,
+                  Script script )
+{
+  // FNV-1a
+  uint32_t hash = 2166136261u;
+
+  for( const Character* it = text, *endIt = text + numberOfCharacters; it != endIt; ++it )
+  {
+    hash = ( hash ^ *it ) * 16777619u;
+  }
+
+  hash = ( hash ^ fontId ) * 16777619u;
+  hash = ( hash ^ static_cast<uint32_t>( script ) ) * 16777619u;
+
+  return hash;
+}
+
+} // namespace
+
+ShapedRunCachePtr ShapedRunCache::Get()
+{
+  ShapedRunCachePtr cache;
+
+  Dali::SingletonService service( SingletonService::Get() );
+  if( service )
+  {
+    // Check whether the singleton is already created
+    Dali::BaseHandle handle = service.GetSingleton( typeid( ShapedRunCache ) );
+    if( handle )
+    {
+      cache = dynamic_cast<ShapedRunCache*>( handle.GetObjectPtr() );
+    }
+    else // create and register the object
+    {
+      cache = new ShapedRunCache();
+      service.Register( typeid( ShapedRunCache ), Dali::BaseHandle( cache.Get() ) );
+    }
+  }
+
+  return cache;
+}
+
+const ShapedRun* ShapedRunCache::Find( const Character* const text,
+                                       Length numberOfCharacters,
+                                       FontId fontId,
+                                       Script script )
+{
+  if( numberOfCharacters > MAX_NUMBER_OF_CHARACTERS_PER_RUN )
+  {
+    // Long runs are not cached.
+    return NULL;
+  }
+
+  const uint32_t hash = HashRun( text, numberOfCharacters, fontId, script );
+
+  std::pair<ShapedRunIndex::iterator, ShapedRunIndex::iterator> range = mIndex.equal_range( hash );
+  for( ShapedRunIndex::iterator it = range.first; it != range.second; ++it )
+  {
+    ShapedRunList::iterator runIt = it->second;
+    const ShapedRun& run = *runIt;
+
+    if( ( fontId == run.fontId ) &&
+        ( script == run.script ) &&
+        ( numberOfCharacters == run.text.Count() ) &&
+        ( 0 == memcmp( text, run.text.Begin(), numberOfCharacters * sizeof( Character ) ) ) )
+    {
+      // Move the run to the front. The iterators stored in the index remain valid.
+      mRuns.splice( mRuns.begin(), mRuns, runIt );
+
+      ++mNumberOfHits;
+      return &run;
+    }
+  }
+
+  ++mNumberOfMisses;
+
+  DALI_LOG_INFO( gLogFilter, Debug::Verbose, "ShapedRunCache hits: %d, misses: %d, hit rate: %f\n", mNumberOfHits, mNumberOfMisses, GetHitRate() );
+
+  return NULL;
+}
+
+void ShapedRunCache::Add( const Character* const text,
+                          Length numberOfCharacters,
+                          FontId fontId,
+                          Script script,
+                          const Vector<GlyphInfo>& glyphs,
+                          const Vector<CharacterIndex>& glyphToCharacterMap )
+{
+  if( ( 0u == numberOfCharacters ) ||
+      ( numberOfCharacters > MAX_NUMBER_OF_CHARACTERS_PER_RUN ) )
+  {
+    // Long runs are not cached.
+    return;
+  }
+
+  mRuns.push_front( ShapedRun() );
+  ShapedRun& run = mRuns.front();
+
+  run.text.Resize( numberOfCharacters );
+  memcpy( run.text.Begin(), text, numberOfCharacters * sizeof( Character ) );
+  run.glyphs = glyphs;
+  run.glyphToCharacterMap = glyphToCharacterMap;
+  run.hash = HashRun( text, numberOfCharacters, fontId, script );
+  run.fontId = fontId;
+  run.script = script;
+
+  mIndex.insert( ShapedRunIndex::value_type( run.hash, mRuns.begin() ) );
+  mNumberOfCharacters += numberOfCharacters;
+
+  Trim();
+}
+
+void ShapedRunCache::Clear()
+{
+  mIndex.clear();
+  mRuns.clear();
+  mNumberOfCharacters = 0u;
+}
+
+unsigned int ShapedRunCache::GetNumberOfHits() const
+{
+  return mNumberOfHits;
+}
+
+unsigned int ShapedRunCache::GetNumberOfMisses() const
+{
+  return mNumberOfMisses;
+}
+
+float ShapedRunCache::GetHitRate() const
+{
+  const unsigned int numberOfQueries = mNumberOfHits + mNumberOfMisses;
+  return ( 0u == numberOfQueries ) ? 0.f : static_cast<float>( mNumberOfHits ) / static_cast<float>( numberOfQueries );
+}
+
+ShapedRunCache::ShapedRunCache()
+: mRuns(),
+  mIndex(),
+  mNumberOfCharacters( 0u ),
+  mNumberOfHits( 0u ),
+  mNumberOfMisses( 0u )
+{
+}
+
+ShapedRunCache::~ShapedRunCache()
+{
+}
+
+void ShapedRunCache::Trim()
+{
+  while( mNumberOfCharacters > MAX_NUMBER_OF_CHARACTERS )
+  {
+    // Discard the least recently used run.
+    ShapedRunList::iterator runIt = --mRuns.end();
+
+    std::pair<ShapedRunIndex::iterator, ShapedRunIndex::iterator> range = mIndex.equal_range( runIt->hash );
+    for( ShapedRunIndex::iterator it = range.first; it != range.second; ++it )
+    {
+      if( runIt == it->second )
+      {
+        mIndex.erase( it );
+        break;
+      }
+    }
+
+    mNumberOfCharacters -= runIt->text.Count();
+    mRuns.erase( runIt );
+  }
+}
+
+} // namespace Text
+
+} // namespace Toolkit
+
+} // namespace Dali
@@ -0,0 +1,179 @@
+#ifndef __DALI_TOOLKIT_TEXT_SHAPED_RUN_CACHE_H__
+#define __DALI_TOOLKIT_TEXT_SHAPED_RUN_CACHE_H__
+
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <list>
+#include <map>
+#include <dali/public-api/common/dali-vector.h>
+#include <dali/public-api/common/intrusive-ptr.h>
+#include <dali/public-api/object/base-object.h>
+
+// INTERNAL INCLUDES
+#include <dali-toolkit/internal/text/text-definitions.h>
+
+namespace Dali
+{
+
+namespace Toolkit
+{
+
+namespace Text
+{
+
+class ShapedRunCache;
+typedef IntrusivePtr<ShapedRunCache> ShapedRunCachePtr;
+
+/**
+ * @brief The glyphs of a chunk of characters shaped with the same font and script.
+ */
+struct ShapedRun
+{
+  Vector<Character>      text;                ///< The shaped characters.
+  Vector<GlyphInfo>      glyphs;              ///< The glyphs returned by the shaper.
+  Vector<CharacterIndex> glyphToCharacterMap; ///< The glyph to character conversion table, relative to the first character of the run.
+  uint32_t               hash;                ///< Hash of the characters, the font and the script.
+  FontId                 fontId;              ///< The font used to shape the characters.
+  Script                 script;              ///< The script used to shape the characters.
+};
+
+/**
+ * @brief Cache of shaped runs shared by all the text controllers.
+ *
+ * Many controls show the same short strings with the same fonts. The glyphs of a run of characters
+ * only depend on the characters, the font id (which includes the point size) and the script
+ * (which sets the direction), so the result of the shaper can be reused.
+ *
+ * The cache is bounded. The least recently used runs are discarded first.
+ */
+class ShapedRunCache : public BaseObject
+{
+public:
+
+  /**
+   * @brief Retrieves the cache shared by all the text controllers.
+   *
+   * @return A pointer to the cache. It may be NULL if the singleton service is not available.
+   */
+  static ShapedRunCachePtr Get();
+
+  /**
+   * @brief Finds a shaped run.
+   *
+   * @param[in] text Pointer to the first character of the run.
+   * @param[in] numberOfCharacters The number of characters of the run.
+   * @param[in] fontId The font used to shape the characters.
+   * @param[in] script The script used to shape the characters.
+   *
+   * @return A pointer to the shaped run or NULL if it's not in the cache. It's valid until the next call to Add().
+   */
+  const ShapedRun* Find( const Character* const text,
+                         Length numberOfCharacters,
+                         FontId fontId,
+                         Script script );
+
+  /**
+   * @brief Adds a shaped run.
+   *
+   * Long runs are not added as they are unlikely to be shaped again.
+   *
+   * @param[in] text Pointer to the first character of the run.
+   * @param[in] numberOfCharacters The number of characters of the run.
+   * @param[in] fontId The font used to shape the characters.
+   * @param[in] script The script used to shape the characters.
+   * @param[in] glyphs The glyphs returned by the shaper.
+   * @param[in] glyphToCharacterMap The glyph to character conversion table returned by the shaper.
+   */
+  void Add( const Character* const text,
+            Length numberOfCharacters,
+            FontId fontId,
+            Script script,
+            const Vector<GlyphInfo>& glyphs,
+            const Vector<CharacterIndex>& glyphToCharacterMap );
+
+  /**
+   * @brief Removes all the shaped runs.
+   */
+  void Clear();
+
+  /**
+   * @brief Retrieves the number of runs found in the cache.
+   *
+   * @return The number of hits.
+   */
+  unsigned int GetNumberOfHits() const;
+
+  /**
+   * @brief Retrieves the number of runs not found in the cache.
+   *
+   * @return The number of misses.
+   */
+  unsigned int GetNumberOfMisses() const;
+
+  /**
+   * @brief Retrieves the ratio of runs found in the cache.
+   *
+   * @return The hit rate, between 0 and 1.
+   */
+  float GetHitRate() const;
+
+private:
+
+  /**
+   * @brief Constructor.
+   */
+  ShapedRunCache();
+
+  /**
+   * @brief A reference counted object may only be deleted by calling Unreference().
+   */
+  virtual ~ShapedRunCache();
+
+  /**
+   * @brief Discards the least recently used runs until the cache fits in its budget.
+   */
+  void Trim();
+
+private:
+
+  // Undefined
+  ShapedRunCache( const ShapedRunCache& cache );
+
+  // Undefined
+  ShapedRunCache& operator=( const ShapedRunCache& cache );
+
+private:
+
+  typedef std::list<ShapedRun> ShapedRunList;
+  typedef std::multimap<uint32_t, ShapedRunList::iterator> ShapedRunIndex;
+
+  ShapedRunList  mRuns;               ///< The shaped runs. The most recently used first.
+  ShapedRunIndex mIndex;              ///< Finds the runs by hash.
+  Length         mNumberOfCharacters; ///< The number of characters of all the runs.
+  unsigned int   mNumberOfHits;       ///< The number of runs found.
+  unsigned int   mNumberOfMisses;     ///< The number of runs not found.
+};
+
+} // namespace Text
+
+} // namespace Toolkit
+
+} // namespace Dali
+
+#endif // __DALI_TOOLKIT_TEXT_SHAPED_RUN_CACHE_H__
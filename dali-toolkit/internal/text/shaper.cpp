@@ -21,6 +21,9 @@
 // EXTERNAL INCLUDES
 #include <dali/devel-api/text-abstraction/shaping.h>
 
+// INTERNAL INCLUDES
+#include <dali-toolkit/internal/text/shaped-run-cache.h>
+
 namespace Dali
 {
 
@@ -74,6 +77,9 @@ void ShapeText( const Vector<Character>& text,
 
   TextAbstraction::Shaping shaping = TextAbstraction::Shaping::Get();
 
+  // The glyphs of short runs shaped before, by this or any other controller, are reused.
+  ShapedRunCachePtr shapedRunCache = ShapedRunCache::Get();
+
   // To shape the text a font and an script is needed.
 
   // Get the font run containing the startCharacterIndex character.
@@ -161,19 +167,46 @@ void ShapeText( const Vector<Character>& text,
       }
     }
 
-    // Shape the text for the current chunk.
-    const Length numberOfGlyphs = shaping.Shape( textBuffer + previousIndex,
-                                                 ( currentIndex - previousIndex ), // The number of characters to shape.
-                                                 currentFontId,
-                                                 currentScript );
+    const Length numberOfCharactersToShape = currentIndex - previousIndex;
 
-    // Retrieve the glyphs and the glyph to character conversion map.
     Vector<GlyphInfo> tmpGlyphs;
     Vector<CharacterIndex> tmpGlyphToCharacterMap;
-    tmpGlyphs.Resize( numberOfGlyphs );
-    tmpGlyphToCharacterMap.Resize( numberOfGlyphs );
-    shaping.GetGlyphs( tmpGlyphs.Begin(),
-                       tmpGlyphToCharacterMap.Begin() );
+
+    const ShapedRun* const shapedRun = shapedRunCache ? shapedRunCache->Find( textBuffer + previousIndex,
+                                                                              numberOfCharactersToShape,
+                                                                              currentFontId,
+                                                                              currentScript ) : NULL;
+    if( NULL != shapedRun )
+    {
+      tmpGlyphs = shapedRun->glyphs;
+      tmpGlyphToCharacterMap = shapedRun->glyphToCharacterMap;
+    }
+    else
+    {
+      // Shape the text for the current chunk.
+      const Length numberOfShapedGlyphs = shaping.Shape( textBuffer + previousIndex,
+                                                         numberOfCharactersToShape,
+                                                         currentFontId,
+                                                         currentScript );
+
+      // Retrieve the glyphs and the glyph to character conversion map.
+      tmpGlyphs.Resize( numberOfShapedGlyphs );
+      tmpGlyphToCharacterMap.Resize( numberOfShapedGlyphs );
+      shaping.GetGlyphs( tmpGlyphs.Begin(),
+                         tmpGlyphToCharacterMap.Begin() );
+
+      if( shapedRunCache )
+      {
+        shapedRunCache->Add( textBuffer + previousIndex,
+                             numberOfCharactersToShape,
+                             currentFontId,
+                             currentScript,
+                             tmpGlyphs,
+                             tmpGlyphToCharacterMap );
+      }
+    }
+
+    const Length numberOfGlyphs = tmpGlyphs.Count();
 
     // Update the new indices of the glyph to character map.
     if( 0u != totalNumberOfGlyphs )
@@ -20,7 +20,9 @@
 
 // EXTERNAL INCLUDES
 #include <dali/public-api/adaptor-framework/key.h>
+#include <dali/public-api/math/math-utils.h>
 #include <dali/integration-api/debug.h>
+#include <cmath>
 #include <limits>
 
 // INTERNAL INCLUDES
@@ -54,6 +56,8 @@ struct SelectionBoxInfo
 const float MAX_FLOAT = std::numeric_limits<float>::max();
 const float MIN_FLOAT = std::numeric_limits<float>::min();
 const Dali::Toolkit::Text::CharacterDirection LTR = false; ///< Left To Right direction
+const unsigned int MAX_NUMBER_OF_HEIGHT_FOR_WIDTH_ENTRIES = 4u; ///< The number of widths kept by the height for width cache.
+const float RENDERED_AREA_MARGIN_FACTOR = 1.f; ///< The margin above and below the visible area rendered if the rendering is virtualised, as a factor of the control's height.
 
 } // namespace
 
@@ -103,6 +107,43 @@ EventData::EventData( DecoratorPtr decorator )
 EventData::~EventData()
 {}
 
+bool HeightForWidthCache::Get( float width, float& height ) const
+{
+  for( Vector<HeightForWidth>::ConstIterator it = mHeightsForWidth.Begin(),
+         endIt = mHeightsForWidth.End();
+       it != endIt;
+       ++it )
+  {
+    const HeightForWidth& heightForWidth = *it;
+    if( fabsf( width - heightForWidth.width ) < Math::MACHINE_EPSILON_1000 )
+    {
+      height = heightForWidth.height;
+      return true;
+    }
+  }
+
+  return false;
+}
+
+void HeightForWidthCache::Set( float width, float height )
+{
+  if( MAX_NUMBER_OF_HEIGHT_FOR_WIDTH_ENTRIES == mHeightsForWidth.Count() )
+  {
+    // Discard the oldest width.
+    mHeightsForWidth.Erase( mHeightsForWidth.Begin() );
+  }
+
+  HeightForWidth heightForWidth;
+  heightForWidth.width = width;
+  heightForWidth.height = height;
+  mHeightsForWidth.PushBack( heightForWidth );
+}
+
+void HeightForWidthCache::Clear()
+{
+  mHeightsForWidth.Clear();
+}
+
 bool Controller::Impl::ProcessInputEvents()
 {
   DALI_LOG_INFO( gLogFilter, Debug::Verbose, "-->Controller::ProcessInputEvents\n" );
@@ -743,6 +784,20 @@ bool Controller::Impl::UpdateModel( OperationsMask operationsRequired )
     return false;
   }
 
+  // The text or its style changes. The layout heights calculated before are not valid.
+  const OperationsMask textOperations = static_cast<OperationsMask>( CONVERT_TO_UTF32  |
+                                                                     GET_SCRIPTS       |
+                                                                     VALIDATE_FONTS    |
+                                                                     GET_LINE_BREAKS   |
+                                                                     GET_WORD_BREAKS   |
+                                                                     BIDI_INFO         |
+                                                                     SHAPE_TEXT        |
+                                                                     GET_GLYPH_METRICS );
+  if( NO_OPERATION != ( textOperations & operations ) )
+  {
+    mHeightForWidthCache.Clear();
+  }
+
   Vector<Character>& utf32Characters = mLogicalModel->mText;
 
   const Length numberOfCharacters = utf32Characters.Count();
@@ -767,20 +822,42 @@ bool Controller::Impl::UpdateModel( OperationsMask operationsRequired )
   bool updated = false;
 
   Vector<LineBreakInfo>& lineBreakInfo = mLogicalModel->mLineBreakInfo;
+  Vector<WordBreakInfo>& wordBreakInfo = mLogicalModel->mWordBreakInfo;
+  Vector<ScriptRun>& scripts = mLogicalModel->mScriptRuns;
   const Length requestedNumberOfCharacters = mTextUpdateInfo.mRequestedNumberOfCharacters;
 
-  if( NO_OPERATION != ( GET_LINE_BREAKS & operations ) )
+  const bool getLineBreaks = NO_OPERATION != ( GET_LINE_BREAKS & operations );
+  const bool getWordBreaks = NO_OPERATION != ( GET_WORD_BREAKS & operations );
+  const bool getScripts = NO_OPERATION != ( GET_SCRIPTS & operations );
+
+  // The line break info, the word break info and the scripts of each paragraph don't depend on the other paragraphs.
+  // Large texts with many paragraphs may be updated by worker threads.
+  const bool updatedInParallel = mParagraphUpdateThreadPool &&
+                                 mParagraphUpdateThreadPool->UpdateParagraphs( utf32Characters,
+                                                                               startIndex,
+                                                                               requestedNumberOfCharacters,
+                                                                               getLineBreaks,
+                                                                               getWordBreaks,
+                                                                               getScripts,
+                                                                               lineBreakInfo,
+                                                                               wordBreakInfo,
+                                                                               scripts );
+
+  if( getLineBreaks )
   {
-    // Retrieves the line break info. The line break info is used to split the text in 'paragraphs' to
-    // calculate the bidirectional info for each 'paragraph'.
-    // It's also used to layout the text (where it should be a new line) or to shape the text (text in different lines
-    // is not shaped together).
-    lineBreakInfo.Resize( numberOfCharacters, TextAbstraction::LINE_NO_BREAK );
+    if( !updatedInParallel )
+    {
+      // Retrieves the line break info. The line break info is used to split the text in 'paragraphs' to
+      // calculate the bidirectional info for each 'paragraph'.
+      // It's also used to layout the text (where it should be a new line) or to shape the text (text in different lines
+      // is not shaped together).
+      lineBreakInfo.Resize( numberOfCharacters, TextAbstraction::LINE_NO_BREAK );
 
-    SetLineBreakInfo( utf32Characters,
-                      startIndex,
-                      requestedNumberOfCharacters,
-                      lineBreakInfo );
+      SetLineBreakInfo( utf32Characters,
+                        startIndex,
+                        requestedNumberOfCharacters,
+                        lineBreakInfo );
+    }
 
     // Create the paragraph info.
     mLogicalModel->CreateParagraphInfo( startIndex,
@@ -788,23 +865,23 @@ bool Controller::Impl::UpdateModel( OperationsMask operationsRequired )
     updated = true;
   }
 
-  Vector<WordBreakInfo>& wordBreakInfo = mLogicalModel->mWordBreakInfo;
-  if( NO_OPERATION != ( GET_WORD_BREAKS & operations ) )
+  if( getWordBreaks )
   {
-    // Retrieves the word break info. The word break info is used to layout the text (where to wrap the text in lines).
-    wordBreakInfo.Resize( numberOfCharacters, TextAbstraction::WORD_NO_BREAK );
+    if( !updatedInParallel )
+    {
+      // Retrieves the word break info. The word break info is used to layout the text (where to wrap the text in lines).
+      wordBreakInfo.Resize( numberOfCharacters, TextAbstraction::WORD_NO_BREAK );
 
-    SetWordBreakInfo( utf32Characters,
-                      startIndex,
-                      requestedNumberOfCharacters,
-                      wordBreakInfo );
+      SetWordBreakInfo( utf32Characters,
+                        startIndex,
+                        requestedNumberOfCharacters,
+                        wordBreakInfo );
+    }
     updated = true;
   }
 
-  const bool getScripts = NO_OPERATION != ( GET_SCRIPTS & operations );
   const bool validateFonts = NO_OPERATION != ( VALIDATE_FONTS & operations );
 
-  Vector<ScriptRun>& scripts = mLogicalModel->mScriptRuns;
   Vector<FontRun>& validFonts = mLogicalModel->mFontRuns;
 
   if( getScripts || validateFonts )
@@ -813,7 +890,7 @@ bool Controller::Impl::UpdateModel( OperationsMask operationsRequired )
     // It makes sure all the characters are going to be rendered by the correct font.
     MultilanguageSupport multilanguageSupport = MultilanguageSupport::Get();
 
-    if( getScripts )
+    if( getScripts && !updatedInParallel )
     {
       // Retrieves the scripts used in the text.
       multilanguageSupport.SetScripts( utf32Characters,
@@ -2538,6 +2615,34 @@ void Controller::Impl::ClampVerticalScroll( const Vector2& layoutSize )
   }
 }
 
+bool Controller::Impl::UpdateRenderedGlyphRange( bool forceUpdate )
+{
+  if( !mVisualModel->mVirtualisedRenderingEnabled )
+  {
+    return false;
+  }
+
+  // The visible area in laid-out text coords.
+  const float visibleAreaTop = -mScrollPosition.y;
+  const float visibleAreaBottom = visibleAreaTop + mVisualModel->mControlSize.height;
+
+  if( !forceUpdate && mVisualModel->IsAreaRendered( visibleAreaTop, visibleAreaBottom ) )
+  {
+    // Nothing to do. The glyphs previously rendered still cover the visible area.
+    return false;
+  }
+
+  // Add a margin to avoid rendering the text again each time it's scrolled a few pixels.
+  const float margin = RENDERED_AREA_MARGIN_FACTOR * mVisualModel->mControlSize.height;
+
+  mVisualModel->SetRenderedArea( visibleAreaTop - margin,
+                                 visibleAreaBottom + margin );
+
+  DALI_LOG_INFO( gLogFilter, Debug::Verbose, "Rendered glyph range %d, %d\n", mVisualModel->mFirstRenderedGlyph, mVisualModel->mNumberOfRenderedGlyphs );
+
+  return true;
+}
+
 void Controller::Impl::ScrollToMakePositionVisible( const Vector2& position, float lineHeight )
 {
   const float cursorWidth = mEventData->mDecorator ? static_cast<float>( mEventData->mDecorator->GetCursorWidth() ) : 0.f;
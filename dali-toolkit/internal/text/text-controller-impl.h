@@ -26,6 +26,7 @@
 #include <dali-toolkit/internal/text/input-style.h>
 #include <dali-toolkit/internal/text/layouts/layout-engine.h>
 #include <dali-toolkit/internal/text/logical-model-impl.h>
+#include <dali-toolkit/internal/text/paragraph-update.h>
 #include <dali-toolkit/internal/text/text-controller.h>
 #include <dali-toolkit/internal/text/text-view.h>
 #include <dali-toolkit/internal/text/visual-model-impl.h>
@@ -256,6 +257,52 @@ struct TextUpdateInfo
   }
 };
 
+/**
+ * @brief Stores the layout height of the text for a given width.
+ *
+ * Used to answer repeated GetHeightForWidth() queries during the size negotiation.
+ */
+struct HeightForWidth
+{
+  float width;  ///< The width used to layout the text.
+  float height; ///< The height of the laid-out text.
+};
+
+/**
+ * @brief Stores the layout heights of the text for the last few widths queried.
+ *
+ * It must be cleared when the text or the style changes.
+ */
+struct HeightForWidthCache
+{
+  /**
+   * @brief Retrieves the layout height calculated before for the given width.
+   *
+   * @param[in] width The width used to layout the text.
+   * @param[out] height The height of the laid-out text.
+   *
+   * @return @e true if the height for the given width is cached.
+   */
+  bool Get( float width, float& height ) const;
+
+  /**
+   * @brief Stores the layout height calculated for the given width.
+   *
+   * Only the last few widths are kept. The oldest one is discarded when the cache is full.
+   *
+   * @param[in] width The width used to layout the text.
+   * @param[in] height The height of the laid-out text.
+   */
+  void Set( float width, float height );
+
+  /**
+   * @brief Discards all the heights.
+   */
+  void Clear();
+
+  Vector<HeightForWidth> mHeightsForWidth; ///< The layout heights of the last widths queried. The oldest one first.
+};
+
 struct UnderlineDefaults
 {
   std::string properties;
@@ -297,7 +344,9 @@ struct Controller::Impl
     mView(),
     mMetrics(),
     mLayoutEngine(),
+    mParagraphUpdateThreadPool( ParagraphUpdateThreadPool::Get() ),
     mModifyEvents(),
+    mHeightForWidthCache(),
     mTextColor( Color::BLACK ),
     mTextUpdateInfo(),
     mOperationsPending( NO_OPERATION ),
@@ -644,6 +693,18 @@ struct Controller::Impl
    */
   void ClampVerticalScroll( const Vector2& layoutSize );
 
+  /**
+   * @brief Updates the range of glyphs to be rendered if the rendering is virtualised.
+   *
+   * Only the glyphs of the lines which intersect the visible area plus a margin above and below are rendered.
+   * The range is not updated while the visible area is within the area previously rendered.
+   *
+   * @param[in] forceUpdate Whether to update the range even if the visible area has already been rendered, i.e. the lines have changed.
+   *
+   * @return @e true if the range of glyphs has been updated and the text needs to be rendered again.
+   */
+  bool UpdateRenderedGlyphRange( bool forceUpdate );
+
   /**
    * @brief Scrolls the text to make a position visible.
    *
@@ -686,7 +747,9 @@ public:
   View mView;                              ///< The view interface to the rendering back-end.
   MetricsPtr mMetrics;                     ///< A wrapper around FontClient used to get metrics & potentially down-scaled Emoji metrics.
   LayoutEngine mLayoutEngine;              ///< The layout engine.
+  ParagraphUpdateThreadPoolPtr mParagraphUpdateThreadPool; ///< The worker threads which update the paragraphs of large texts. Empty if the parallel update is disabled.
   Vector<ModifyEvent> mModifyEvents;       ///< Temporary stores the text set until the next relayout.
+  HeightForWidthCache mHeightForWidthCache; ///< The layout heights of the last widths queried. Cleared when the text or the style changes.
   Vector4 mTextColor;                      ///< The regular text color
   /**
    * 0,0 means that the top-left corner of the layout matches the top-left corner of the UI control.
@@ -40,6 +40,7 @@ namespace
 #endif
 
 const float MAX_FLOAT = std::numeric_limits<float>::max();
+const float AVERAGE_CHARACTER_WIDTH_RATIO = 0.5f; ///< Used to estimate the natural size of a text which is not shaped yet.
 
 const std::string EMPTY_STRING("");
 
@@ -132,6 +133,24 @@ bool Controller::IsMarkupProcessorEnabled() const
   return mImpl->mMarkupProcessorEnabled;
 }
 
+void Controller::SetVirtualisedRenderingEnabled( bool enable )
+{
+  if( enable != mImpl->mVisualModel->mVirtualisedRenderingEnabled )
+  {
+    mImpl->mVisualModel->mVirtualisedRenderingEnabled = enable;
+
+    // Forces the range of glyphs to be updated in the next relayout.
+    mImpl->mVisualModel->SetRenderedArea( 0.f, 0.f );
+
+    mImpl->RequestRelayout();
+  }
+}
+
+bool Controller::IsVirtualisedRenderingEnabled() const
+{
+  return mImpl->mVisualModel->mVirtualisedRenderingEnabled;
+}
+
 void Controller::SetAutoScrollEnabled( bool enable )
 {
   DALI_LOG_INFO( gLogFilter, Debug::General, "Controller::SetAutoScrollEnabled[%s] SingleBox[%s]-> [%p]\n", (enable)?"true":"false", ( mImpl->mLayoutEngine.GetLayout() == LayoutEngine::SINGLE_LINE_BOX)?"true":"false", this );
@@ -288,35 +307,33 @@ void Controller::SetText( const std::string& text )
   {
     mImpl->mVisualModel->SetTextColor( mImpl->mTextColor );
 
-    MarkupProcessData markupProcessData( mImpl->mLogicalModel->mColorRuns,
-                                         mImpl->mLogicalModel->mFontDescriptionRuns );
+    Vector<Character>& utf32Characters = mImpl->mLogicalModel->mText;
 
-    Length textSize = 0u;
-    const uint8_t* utf8 = NULL;
+    const Length textSize = text.size();
+    Length characterCount = 0u;
     if( mImpl->mMarkupProcessorEnabled )
     {
-      ProcessMarkupString( text, markupProcessData );
-      textSize = markupProcessData.markupProcessedText.size();
+      MarkupProcessData markupProcessData( mImpl->mLogicalModel->mColorRuns,
+                                           mImpl->mLogicalModel->mFontDescriptionRuns,
+                                           utf32Characters );
 
-      // This is a bit horrible but std::string returns a (signed) char*
-      utf8 = reinterpret_cast<const uint8_t*>( markupProcessData.markupProcessedText.c_str() );
+      // Strips the mark-up tags and converts the plain text into UTF-32 in a single pass.
+      ProcessMarkupString( text, markupProcessData );
+      characterCount = utf32Characters.Count();
     }
     else
     {
-      textSize = text.size();
+      //  Convert text into UTF-32
+      utf32Characters.Resize( textSize );
 
       // This is a bit horrible but std::string returns a (signed) char*
-      utf8 = reinterpret_cast<const uint8_t*>( text.c_str() );
-    }
+      const uint8_t* utf8 = reinterpret_cast<const uint8_t*>( text.c_str() );
 
-    //  Convert text into UTF-32
-    Vector<Character>& utf32Characters = mImpl->mLogicalModel->mText;
-    utf32Characters.Resize( textSize );
-
-    // Transform a text array encoded in utf8 into an array encoded in utf32.
-    // It returns the actual number of characters.
-    Length characterCount = Utf8ToUtf32( utf8, textSize, utf32Characters.Begin() );
-    utf32Characters.Resize( characterCount );
+      // Transform a text array encoded in utf8 into an array encoded in utf32.
+      // It returns the actual number of characters.
+      characterCount = Utf8ToUtf32( utf8, textSize, utf32Characters.Begin() );
+      utf32Characters.Resize( characterCount );
+    }
 
     DALI_ASSERT_DEBUG( textSize >= characterCount && "Invalid UTF32 conversion length" );
     DALI_LOG_INFO( gLogFilter, Debug::Verbose, "Controller::SetText %p UTF8 size %d, UTF32 size %d\n", this, textSize, mImpl->mLogicalModel->mText.Count() );
@@ -842,6 +859,7 @@ void Controller::SetDefaultLineSpacing( float lineSpacing )
 {
   //TODO finish implementation
   mImpl->mLayoutEngine.SetDefaultLineSpacing( lineSpacing );
+  mImpl->mHeightForWidthCache.Clear();
 }
 
 float Controller::GetDefaultLineSpacing() const
@@ -1390,18 +1408,40 @@ float Controller::GetHeightForWidth( float width )
   // Make sure the model is up-to-date before layouting
   ProcessModifyEvents();
 
+  // Operations that can be done only once until the text changes.
+  const OperationsMask onlyOnceOperations = static_cast<OperationsMask>( CONVERT_TO_UTF32  |
+                                                                         GET_SCRIPTS       |
+                                                                         VALIDATE_FONTS    |
+                                                                         GET_LINE_BREAKS   |
+                                                                         GET_WORD_BREAKS   |
+                                                                         BIDI_INFO         |
+                                                                         SHAPE_TEXT        |
+                                                                         GET_GLYPH_METRICS );
+
   Size layoutSize;
-  if( fabsf( width - mImpl->mVisualModel->mControlSize.width ) > Math::MACHINE_EPSILON_1000 )
+  if( fabsf( width - mImpl->mVisualModel->mControlSize.width ) <= Math::MACHINE_EPSILON_1000 )
+  {
+    layoutSize = mImpl->mVisualModel->GetLayoutSize();
+    DALI_LOG_INFO( gLogFilter, Debug::Verbose, "<--Controller::GetHeightForWidth cached %f\n", layoutSize.height );
+  }
+  else if( NO_OPERATION == ( mImpl->mOperationsPending & onlyOnceOperations ) )
+  {
+    // The model is up-to-date. The height is calculated without modifying the laid-out text.
+    if( !mImpl->mHeightForWidthCache.Get( width, layoutSize.height ) )
+    {
+      CalculateLayoutSize( width, layoutSize );
+
+      mImpl->mHeightForWidthCache.Set( width, layoutSize.height );
+
+      DALI_LOG_INFO( gLogFilter, Debug::Verbose, "<--Controller::GetHeightForWidth calculated without layout %f\n", layoutSize.height );
+    }
+    else
+    {
+      DALI_LOG_INFO( gLogFilter, Debug::Verbose, "<--Controller::GetHeightForWidth cached for width %f\n", layoutSize.height );
+    }
+  }
+  else
   {
-    // Operations that can be done only once until the text changes.
-    const OperationsMask onlyOnceOperations = static_cast<OperationsMask>( CONVERT_TO_UTF32  |
-                                                                           GET_SCRIPTS       |
-                                                                           VALIDATE_FONTS    |
-                                                                           GET_LINE_BREAKS   |
-                                                                           GET_WORD_BREAKS   |
-                                                                           BIDI_INFO         |
-                                                                           SHAPE_TEXT        |
-                                                                           GET_GLYPH_METRICS );
     // Make sure the model is up-to-date before layouting
     mImpl->UpdateModel( onlyOnceOperations );
 
@@ -1437,15 +1477,44 @@ float Controller::GetHeightForWidth( float width )
     // Restore the actual control's width.
     mImpl->mVisualModel->mControlSize.width = actualControlWidth;
 
+    mImpl->mHeightForWidthCache.Set( width, layoutSize.height );
+
     DALI_LOG_INFO( gLogFilter, Debug::Verbose, "<--Controller::GetHeightForWidth calculated %f\n", layoutSize.height );
   }
-  else
+
+  return layoutSize.height;
+}
+
+bool Controller::IsShapingRequired() const
+{
+  return ( 0u != mImpl->mModifyEvents.Count() ) ||
+         ( NO_OPERATION != ( SHAPE_TEXT & mImpl->mOperationsPending ) );
+}
+
+Vector3 Controller::GetEstimatedNaturalSize()
+{
+  Vector3 naturalSize( mImpl->mVisualModel->GetNaturalSize() );
+
+  if( naturalSize.GetVectorXY() == Vector2::ZERO )
   {
-    layoutSize = mImpl->mVisualModel->GetLayoutSize();
-    DALI_LOG_INFO( gLogFilter, Debug::Verbose, "<--Controller::GetHeightForWidth cached %f\n", layoutSize.height );
+    if( NULL == mImpl->mFontDefaults )
+    {
+      mImpl->mFontDefaults = new FontDefaults();
+    }
+
+    // Estimates a single line with characters of half the line's height.
+    Text::FontMetrics fontMetrics;
+    mImpl->mMetrics->GetFontMetrics( mImpl->mFontDefaults->GetFontId( mImpl->mFontClient ), fontMetrics );
+
+    const float lineHeight = fontMetrics.ascender - fontMetrics.descender;
+    naturalSize.width = AVERAGE_CHARACTER_WIDTH_RATIO * lineHeight * static_cast<float>( mImpl->mLogicalModel->mText.Count() );
+    naturalSize.height = lineHeight;
   }
 
-  return layoutSize.height;
+  naturalSize.x = ConvertToEven( naturalSize.x );
+  naturalSize.y = ConvertToEven( naturalSize.y );
+
+  return naturalSize;
 }
 
 Controller::UpdateTextType Controller::Relayout( const Size& size )
@@ -1549,6 +1618,12 @@ Controller::UpdateTextType Controller::Relayout( const Size& size )
     }
   }
 
+  // Update the range of glyphs to be rendered if the lines or the scroll position have changed.
+  if( mImpl->UpdateRenderedGlyphRange( updated ) )
+  {
+    updateTextType = static_cast<UpdateTextType>( updateTextType | MODEL_UPDATED );
+  }
+
   // Clear the update info. This info will be set the next time the text is updated.
   mImpl->mTextUpdateInfo.Clear();
   DALI_LOG_INFO( gLogFilter, Debug::Verbose, "<--Controller::Relayout\n" );
@@ -1874,6 +1949,9 @@ void Controller::SetMultiLineEnabled( bool enable )
     // Set the layout type.
     mImpl->mLayoutEngine.SetLayout( layout );
 
+    // The heights calculated for the previous layout type are not valid.
+    mImpl->mHeightForWidthCache.Clear();
+
     // Set the flags to redo the layout operations
     const OperationsMask layoutOperations =  static_cast<OperationsMask>( LAYOUT             |
                                                                           UPDATE_LAYOUT_SIZE |
@@ -1928,6 +2006,44 @@ LayoutEngine::VerticalAlignment Controller::GetVerticalAlignment() const
   return mImpl->mLayoutEngine.GetVerticalAlignment();
 }
 
+void Controller::CalculateLayoutSize( float width,
+                                      Size& layoutSize )
+{
+  layoutSize = Size::ZERO;
+
+  const Length totalNumberOfGlyphs = mImpl->mVisualModel->mGlyphs.Count();
+  if( 0u == totalNumberOfGlyphs )
+  {
+    // Nothing to do if there is no glyphs.
+    return;
+  }
+
+  const Character* const textBuffer = mImpl->mLogicalModel->mText.Begin();
+  const Vector<CharacterDirection>& characterDirection = mImpl->mLogicalModel->mCharacterDirections;
+
+  // Set the layout parameters for the whole text.
+  LayoutParameters layoutParameters( Size( width, MAX_FLOAT ),
+                                     textBuffer,
+                                     mImpl->mLogicalModel->mLineBreakInfo.Begin(),
+                                     mImpl->mLogicalModel->mWordBreakInfo.Begin(),
+                                     ( 0u != characterDirection.Count() ) ? characterDirection.Begin() : NULL,
+                                     mImpl->mVisualModel->mGlyphs.Begin(),
+                                     mImpl->mVisualModel->mGlyphsToCharacters.Begin(),
+                                     mImpl->mVisualModel->mCharactersPerGlyph.Begin(),
+                                     mImpl->mVisualModel->mCharactersToGlyph.Begin(),
+                                     mImpl->mVisualModel->mGlyphsPerCharacter.Begin(),
+                                     totalNumberOfGlyphs );
+
+  layoutParameters.isLastNewParagraph = TextAbstraction::IsNewParagraph( *( textBuffer + ( mImpl->mLogicalModel->mText.Count() - 1u ) ) );
+  layoutParameters.startGlyphIndex = 0u;
+  layoutParameters.numberOfGlyphs = totalNumberOfGlyphs;
+
+  Length numberOfLines = 0u;
+  mImpl->mLayoutEngine.CalculateLayoutSize( layoutParameters,
+                                            layoutSize,
+                                            numberOfLines );
+}
+
 void Controller::CalculateVerticalOffset( const Size& controlSize )
 {
   Size layoutSize = mImpl->mVisualModel->GetLayoutSize();
@@ -156,6 +156,27 @@ public:
    */
   bool IsMarkupProcessorEnabled() const;
 
+  /**
+   * @brief Enables/disables the virtualised rendering.
+   *
+   * If enabled, only the glyphs of the lines close to the visible area are rendered. Used by controls
+   * which scroll the text so the cost of rendering a very long text is bounded by the control's size.
+   *
+   * By default is disabled.
+   *
+   * @param[in] enable Whether to enable the virtualised rendering.
+   */
+  void SetVirtualisedRenderingEnabled( bool enable );
+
+  /**
+   * @brief Retrieves whether the virtualised rendering is enabled.
+   *
+   * By default is disabled.
+   *
+   * @return @e true if the virtualised rendering is enabled, otherwise returns @e false.
+   */
+  bool IsVirtualisedRenderingEnabled() const;
+
   /**
    * @brief Enables/disables the auto text scrolling
    *
@@ -766,6 +787,23 @@ public:
    */
   float GetHeightForWidth( float width );
 
+  /**
+   * @brief Whether the text needs to be shaped before it can be laid-out.
+   *
+   * @return @e true if the text or its style changed since it was shaped.
+   */
+  bool IsShapingRequired() const;
+
+  /**
+   * @brief Retrieves a cheap estimation of the natural size without shaping the text.
+   *
+   * It's the natural size of the previous text if there is one or a size calculated
+   * from the number of characters and the metrics of the default font otherwise.
+   *
+   * @return The estimated natural size.
+   */
+  Vector3 GetEstimatedNaturalSize();
+
   /**
    * @brief Triggers a relayout which updates View (if necessary).
    *
@@ -826,6 +864,17 @@ public:
                    OperationsMask operations,
                    Size& layoutSize );
 
+  /**
+   * @brief Calculates the size of the whole text laid-out for the given width.
+   *
+   * The model must be up-to-date. Neither the lines nor the glyph positions of the model are modified.
+   *
+   * @param[in] width The width of the bounding box to layout text within.
+   * @param[out] layoutSize The size of the laid-out text.
+   */
+  void CalculateLayoutSize( float width,
+                            Size& layoutSize );
+
   /**
    * @brief Whether to enable the multi-line layout.
    *
@@ -20,6 +20,7 @@
 
 // INTERNAL INCLUDES
 #include <dali-toolkit/internal/text/character-run.h>
+#include <dali-toolkit/internal/text/glyph-run.h>
 
 namespace Dali
 {
@@ -30,9 +31,140 @@ namespace Toolkit
 namespace Text
 {
 
+/**
+ * @brief Retrieves the index to the first run which ends after the given character.
+ *
+ * The runs must be sorted by character index and they can't overlap. It uses a binary search.
+ *
+ * @param[in] runsBuffer Pointer to the first run.
+ * @param[in] numberOfRuns The number of runs.
+ * @param[in] characterIndex Index to the character.
+ *
+ * @return The index to the run. It's the number of runs if all of them end before the given character.
+ */
+template< typename T >
+Length FindFirstCharacterRun( const T* const runsBuffer,
+                              Length numberOfRuns,
+                              CharacterIndex characterIndex )
+{
+  Length firstIndex = 0u;
+  Length lastIndex = numberOfRuns;
+
+  while( firstIndex < lastIndex )
+  {
+    const Length middleIndex = firstIndex + ( ( lastIndex - firstIndex ) >> 1u );
+    const CharacterRun& characterRun = ( runsBuffer + middleIndex )->characterRun;
+
+    if( characterRun.characterIndex + characterRun.numberOfCharacters <= characterIndex )
+    {
+      firstIndex = middleIndex + 1u;
+    }
+    else
+    {
+      lastIndex = middleIndex;
+    }
+  }
+
+  return firstIndex;
+}
+
+/**
+ * @brief Retrieves the index to the first run which ends after the given character.
+ *
+ * @see FindFirstCharacterRun()
+ *
+ * @param[in] runs The text's runs.
+ * @param[in] characterIndex Index to the character.
+ *
+ * @return The index to the run. It's the number of runs if all of them end before the given character.
+ */
+template< typename T >
+Length FindFirstCharacterRun( const Vector<T>& runs,
+                              CharacterIndex characterIndex )
+{
+  return FindFirstCharacterRun( runs.Begin(), runs.Count(), characterIndex );
+}
+
+/**
+ * @brief Retrieves the index to the run which contains the given character.
+ *
+ * The runs must be sorted by character index and they can't overlap. It uses a binary search.
+ *
+ * @param[in] runs The text's runs.
+ * @param[in] characterIndex Index to the character.
+ * @param[out] runIndex Index to the run.
+ *
+ * @return @e true if there is a run which contains the character.
+ */
+template< typename T >
+bool FindCharacterRun( const Vector<T>& runs,
+                       CharacterIndex characterIndex,
+                       Length& runIndex )
+{
+  runIndex = FindFirstCharacterRun( runs, characterIndex );
+
+  return ( runIndex < runs.Count() ) && ( ( *( runs.Begin() + runIndex ) ).characterRun.characterIndex <= characterIndex );
+}
+
+/**
+ * @brief Retrieves the index to the first run which ends after the given glyph.
+ *
+ * The runs must be sorted by glyph index and they can't overlap. It uses a binary search.
+ *
+ * @param[in] runsBuffer Pointer to the first run.
+ * @param[in] numberOfRuns The number of runs.
+ * @param[in] glyphIndex Index to the glyph.
+ *
+ * @return The index to the run. It's the number of runs if all of them end before the given glyph.
+ */
+template< typename T >
+Length FindFirstGlyphRun( const T* const runsBuffer,
+                          Length numberOfRuns,
+                          GlyphIndex glyphIndex )
+{
+  Length firstIndex = 0u;
+  Length lastIndex = numberOfRuns;
+
+  while( firstIndex < lastIndex )
+  {
+    const Length middleIndex = firstIndex + ( ( lastIndex - firstIndex ) >> 1u );
+    const GlyphRun& glyphRun = ( runsBuffer + middleIndex )->glyphRun;
+
+    if( glyphRun.glyphIndex + glyphRun.numberOfGlyphs <= glyphIndex )
+    {
+      firstIndex = middleIndex + 1u;
+    }
+    else
+    {
+      lastIndex = middleIndex;
+    }
+  }
+
+  return firstIndex;
+}
+
+/**
+ * @brief Retrieves the index to the first run which ends after the given glyph.
+ *
+ * @see FindFirstGlyphRun()
+ *
+ * @param[in] runs The text's runs.
+ * @param[in] glyphIndex Index to the glyph.
+ *
+ * @return The index to the run. It's the number of runs if all of them end before the given glyph.
+ */
+template< typename T >
+Length FindFirstGlyphRun( const Vector<T>& runs,
+                          GlyphIndex glyphIndex )
+{
+  return FindFirstGlyphRun( runs.Begin(), runs.Count(), glyphIndex );
+}
+
 /**
  * @brief Clears the runs starting from the given character index.
  *
+ * The runs must be sorted by character index and they can't overlap.
+ *
  * @param[in] startIndex The starting character index used to remove runs.
  * @param[in] endIndex The ending character index used to remove runs.
  * @param[in,out] runs The text's runs.
@@ -47,25 +179,23 @@ void ClearCharacterRuns( CharacterIndex startIndex,
                          uint32_t& endRemoveIndex )
 {
   T* runsBuffer = runs.Begin();
-  T* run = runsBuffer;
 
   const Length length = runs.Count();
-  Length index = 0u;
-  for( index = 0u; index < length; ++index )
-  {
-    if( ( run->characterRun.characterIndex <= endIndex ) &&
-        ( startIndex < run->characterRun.characterIndex + run->characterRun.numberOfCharacters ) )
-    {
-      // Run found.
 
-      // Set the index to the first run to be removed.
-      startRemoveIndex = index;
-      break;
-    }
+  // The runs before this one end before the start index. They are not removed nor updated.
+  const Length firstIndex = FindFirstCharacterRun( runsBuffer, length, startIndex );
 
-    ++run;
+  T* run = runsBuffer + firstIndex;
+  if( ( firstIndex < length ) &&
+      ( run->characterRun.characterIndex <= endIndex ) )
+  {
+    // Run found.
+
+    // Set the index to the first run to be removed.
+    startRemoveIndex = firstIndex;
   }
 
+  Length index = 0u;
   run = ( runsBuffer + startRemoveIndex );
   for( index = startRemoveIndex; index < length; ++index )
   {
@@ -83,8 +213,8 @@ void ClearCharacterRuns( CharacterIndex startIndex,
   const Length numberOfCharactersRemoved = 1u + endIndex - startIndex;
 
   // Update the character index of the next runs.
-  run = runsBuffer;
-  for( Length index = 0u; index < length; ++index )
+  run = runsBuffer + firstIndex;
+  for( Length index = firstIndex; index < length; ++index )
   {
     if( run->characterRun.characterIndex > startIndex )
     {
@@ -98,6 +228,8 @@ void ClearCharacterRuns( CharacterIndex startIndex,
 /**
  * @brief Clears the runs starting from the given character index.
  *
+ * The runs must be sorted by character index and they can't overlap.
+ *
  * @param[in] startIndex The starting character index used to remove runs.
  * @param[in] endIndex The ending character index used to remove runs.
  * @param[in,out] runs The text's runs.
@@ -261,6 +393,8 @@ void UpdateCharacterRuns( CharacterIndex index,
 /**
  * @brief Clears the runs starting from the given glyph index.
  *
+ * The runs must be sorted by glyph index and they can't overlap.
+ *
  * @param[in] startIndex The starting glyph index used to remove runs.
  * @param[in] endIndex The ending glyph index used to remove runs.
  * @param[in,out] runs The text's runs.
@@ -275,24 +409,23 @@ void ClearGlyphRuns( GlyphIndex startIndex,
                      uint32_t& endRemoveIndex )
 {
   T* runsBuffer = runs.Begin();
-  T* run = runsBuffer;
 
   const Length length = runs.Count();
-  Length index = 0u;
-  for( index = 0u; index < length; ++index )
+
+  // The runs before this one end before the start index. They are not removed nor updated.
+  const Length firstIndex = FindFirstGlyphRun( runsBuffer, length, startIndex );
+
+  T* run = runsBuffer + firstIndex;
+  if( ( firstIndex < length ) &&
+      ( run->glyphRun.glyphIndex <= endIndex ) )
   {
-    if( ( run->glyphRun.glyphIndex <= endIndex ) &&
-        ( startIndex < run->glyphRun.glyphIndex + run->glyphRun.numberOfGlyphs ) )
-    {
-      // Run found.
+    // Run found.
 
-      // Set the index to the first run to be removed.
-      startRemoveIndex = index;
-      break;
-    }
-    ++run;
+    // Set the index to the first run to be removed.
+    startRemoveIndex = firstIndex;
   }
 
+  Length index = 0u;
   run = ( runsBuffer + startRemoveIndex );
   for( index = startRemoveIndex; index < length; ++index )
   {
@@ -311,20 +444,23 @@ void ClearGlyphRuns( GlyphIndex startIndex,
   const Length numberOfGlyphsRemoved = 1u + endIndex - startIndex;
 
   // Update the glyph index of the next runs.
-  run = runsBuffer;
-  for( Length index = 0u; index < length; ++index )
+  run = runsBuffer + firstIndex;
+  for( Length index = firstIndex; index < length; ++index )
   {
-
     if( run->glyphRun.glyphIndex > startIndex )
     {
       run->glyphRun.glyphIndex -= numberOfGlyphsRemoved;
     }
+
+    ++run;
   }
 }
 
 /**
  * @brief Clears the runs starting from the given glyph index.
  *
+ * The runs must be sorted by glyph index and they can't overlap.
+ *
  * @param[in] startIndex The starting glyph index used to remove runs.
  * @param[in] endIndex The ending glyph index used to remove runs.
  * @param[in,out] runs The text's runs.
@@ -79,6 +79,18 @@ public:
    */
   virtual Length GetNumberOfGlyphs() const = 0;
 
+  /**
+   * @brief Retrieves the range of glyphs to be rendered.
+   *
+   * It's the whole text unless the rendering is virtualised. In that case only the glyphs
+   * of the lines which intersect the visible area of the text (plus a margin) are rendered.
+   *
+   * @param[out] glyphIndex Index to the first glyph to be rendered.
+   * @param[out] numberOfGlyphs The number of glyphs to be rendered.
+   */
+  virtual void GetRenderedGlyphRange( GlyphIndex& glyphIndex,
+                                      Length& numberOfGlyphs ) const = 0;
+
   /**
    * @brief Retrieves glyphs and positions in the given buffers.
    *
@@ -92,6 +92,29 @@ Length View::GetNumberOfGlyphs() const
   return 0;
 }
 
+void View::GetRenderedGlyphRange( GlyphIndex& glyphIndex,
+                                  Length& numberOfGlyphs ) const
+{
+  glyphIndex = 0u;
+  numberOfGlyphs = GetNumberOfGlyphs();
+
+  if( mImpl->mVisualModel && mImpl->mVisualModel->mVirtualisedRenderingEnabled )
+  {
+    const VisualModel& model = *mImpl->mVisualModel;
+
+    // Clamp the range in case the glyphs have been cleared since the range was set.
+    if( model.mFirstRenderedGlyph < numberOfGlyphs )
+    {
+      glyphIndex = model.mFirstRenderedGlyph;
+      numberOfGlyphs = std::min( model.mNumberOfRenderedGlyphs, numberOfGlyphs - glyphIndex );
+    }
+    else
+    {
+      numberOfGlyphs = 0u;
+    }
+  }
+}
+
 Length View::GetGlyphs( GlyphInfo* glyphs,
                         Vector2* glyphPositions,
                         GlyphIndex glyphIndex,
@@ -113,7 +136,7 @@ Length View::GetGlyphs( GlyphInfo* glyphs,
       // Otherwise use the given number of glyphs.
       if( lastLine.ellipsis )
       {
-        numberOfLaidOutGlyphs = lastLine.glyphRun.glyphIndex + lastLine.glyphRun.numberOfGlyphs;
+        numberOfLaidOutGlyphs = lastLine.glyphRun.glyphIndex + lastLine.glyphRun.numberOfGlyphs - glyphIndex;
       }
       else
       {
@@ -149,22 +172,25 @@ Length View::GetGlyphs( GlyphInfo* glyphs,
                                                    numberOfLaidOutGlyphs );
 
         // Get the first line for the given glyph range.
-        LineIndex lineIndex = firstLine;
-        LineRun* line = lineBuffer + lineIndex;
+        LineIndex lineIndex = 0u;
+        LineRun* line = lineBuffer;
 
         // Index of the last glyph of the line.
         GlyphIndex lastGlyphIndexOfLine = line->glyphRun.glyphIndex + line->glyphRun.numberOfGlyphs - 1u;
 
+        // The vertical position of the first line is given by the height of the previous ones.
+        float penY = mImpl->mVisualModel->GetLineOffset( firstLine );
+
         // Add the alignment offset to the glyph's position.
 
-        float penY = line->ascender;
+        penY += line->ascender;
         for( Length index = 0u; index < numberOfLaidOutGlyphs; ++index )
         {
           Vector2& position =  *( glyphPositions + index );
           position.x += line->alignmentOffset;
           position.y += penY;
 
-          if( lastGlyphIndexOfLine == index )
+          if( lastGlyphIndexOfLine == glyphIndex + index )
           {
             penY += -line->descender;
 
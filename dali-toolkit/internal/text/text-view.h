@@ -70,6 +70,12 @@ public:
    */
   virtual Length GetNumberOfGlyphs() const;
 
+  /**
+   * @copydoc Dali::Toolkit::Text::ViewInterface::GetRenderedGlyphRange()
+   */
+  virtual void GetRenderedGlyphRange( GlyphIndex& glyphIndex,
+                                      Length& numberOfGlyphs ) const;
+
   /**
    * @copydoc Dali::Toolkit::Text::ViewInterface::GetGlyphs()
    */
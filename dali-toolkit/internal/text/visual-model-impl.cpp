@@ -19,8 +19,12 @@
 #include <dali-toolkit/internal/text/visual-model-impl.h>
 
 // EXTERNAL INCLUDES
+#include <algorithm>
 #include <memory.h>
 
+// INTERNAL INCLUDES
+#include <dali-toolkit/internal/text/text-run-container.h>
+
 namespace Dali
 {
 
@@ -213,37 +217,27 @@ void VisualModel::GetNumberOfLines( GlyphIndex glyphIndex,
                                     LineIndex& firstLine,
                                     Length& numberOfLines ) const
 {
-  // Initialize the number of lines and the first line.
-  firstLine = 0u;
+  // Initialize the number of lines and find the first line with a binary search.
+  firstLine = FindFirstGlyphRun( mLines, glyphIndex );
   numberOfLines = 0u;
-  bool firstLineFound = false;
 
   const GlyphIndex lastGlyphIndex = glyphIndex + numberOfGlyphs;
 
   // Traverse the lines and count those lines within the range of glyphs.
-  for( Vector<LineRun>::ConstIterator it = mLines.Begin(),
+  for( Vector<LineRun>::ConstIterator it = mLines.Begin() + firstLine,
          endIt = mLines.End();
        it != endIt;
        ++it )
   {
     const LineRun& line = *it;
 
-    if( ( line.glyphRun.glyphIndex + line.glyphRun.numberOfGlyphs > glyphIndex ) &&
-        ( lastGlyphIndex > line.glyphRun.glyphIndex ) )
-    {
-      firstLineFound = true;
-      ++numberOfLines;
-    }
-    else if( lastGlyphIndex <= line.glyphRun.glyphIndex )
+    if( lastGlyphIndex <= line.glyphRun.glyphIndex )
     {
       // nothing else to do.
       break;
     }
 
-    if( !firstLineFound )
-    {
-      ++firstLine;
-    }
+    ++numberOfLines;
   }
 }
 
@@ -274,25 +268,84 @@ LineIndex VisualModel::GetLineOfCharacter( CharacterIndex characterIndex )
     return mCachedLineIndex;
   }
 
-  // 2) Is not in the cached line. Check in the other lines.
+  // 2) Is not in the cached line. Check in the other lines with a binary search.
 
-  LineIndex index = characterIndex < lineRun.characterRun.characterIndex ? 0u : mCachedLineIndex + 1u;
+  const LineIndex index = FindFirstCharacterRun( mLines, characterIndex );
 
-  for( Vector<LineRun>::ConstIterator it = mLines.Begin() + index,
-         endIt = mLines.End();
-       it != endIt;
-       ++it, ++index )
+  if( index < mLines.Count() )
   {
-    const LineRun& lineRun = *it;
+    mCachedLineIndex = index;
+  }
 
-    if( characterIndex < lineRun.characterRun.characterIndex + lineRun.characterRun.numberOfCharacters )
+  return index;
+}
+
+void VisualModel::SetRenderedArea( float top, float bottom )
+{
+  mRenderedAreaTop = top;
+  mRenderedAreaBottom = bottom;
+
+  GlyphIndex firstGlyph = 0u;
+  GlyphIndex lastGlyph = 0u;
+  bool firstGlyphFound = false;
+
+  // Traverse the lines accumulating their heights to find the ones which intersect the area.
+  // The vertical position of each line is cached to position the glyphs of the rendered lines.
+  const Length numberOfLines = mLines.Count();
+  mLineOffsets.Resize( numberOfLines );
+
+  float penY = 0.f;
+  for( LineIndex index = 0u; index < numberOfLines; ++index )
+  {
+    const LineRun& line = *( mLines.Begin() + index );
+
+    const float lineTop = penY;
+    *( mLineOffsets.Begin() + index ) = lineTop;
+    penY += line.ascender - line.descender;
+
+    if( ( penY <= top ) || ( bottom <= lineTop ) )
     {
-      mCachedLineIndex = index;
-      break;
+      // The line is out of the area.
+      continue;
     }
+
+    if( !firstGlyphFound )
+    {
+      firstGlyph = line.glyphRun.glyphIndex;
+      firstGlyphFound = true;
+    }
+
+    lastGlyph = line.glyphRun.glyphIndex + line.glyphRun.numberOfGlyphs;
   }
 
-  return index;
+  mFirstRenderedGlyph = firstGlyph;
+  mNumberOfRenderedGlyphs = lastGlyph - firstGlyph;
+}
+
+bool VisualModel::IsAreaRendered( float top, float bottom ) const
+{
+  return ( mRenderedAreaTop <= top ) && ( bottom <= mRenderedAreaBottom );
+}
+
+float VisualModel::GetLineOffset( LineIndex lineIndex ) const
+{
+  if( lineIndex < mLineOffsets.Count() )
+  {
+    return *( mLineOffsets.Begin() + lineIndex );
+  }
+
+  // Not cached. Add the heights of the previous lines.
+  float offset = 0.f;
+  for( Vector<LineRun>::ConstIterator it = mLines.Begin(),
+         endIt = mLines.Begin() + std::min( lineIndex, static_cast<LineIndex>( mLines.Count() ) );
+       it != endIt;
+       ++it )
+  {
+    const LineRun& line = *it;
+    offset += line.ascender - line.descender;
+  }
+
+  return offset;
 }
 
 void VisualModel::GetUnderlineRuns( GlyphRun* underlineRuns,
@@ -412,11 +465,17 @@ VisualModel::VisualModel()
   mUnderlineColor( Color::BLACK ),
   mShadowOffset( Vector2::ZERO ),
   mUnderlineHeight( 0.0f ),
+  mFirstRenderedGlyph( 0u ),
+  mNumberOfRenderedGlyphs( 0u ),
   mNaturalSize(),
   mLayoutSize(),
   mCachedLineIndex( 0u ),
+  mRenderedAreaTop( 0.f ),
+  mRenderedAreaBottom( 0.f ),
+  mLineOffsets(),
   mUnderlineEnabled( false ),
-  mUnderlineColorSet( false )
+  mUnderlineColorSet( false ),
+  mVirtualisedRenderingEnabled( false )
 {
 }
 
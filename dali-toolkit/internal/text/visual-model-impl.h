@@ -148,6 +148,37 @@ public:
    */
   LineIndex GetLineOfCharacter( CharacterIndex characterIndex );
 
+  /**
+   * @brief Sets the vertical area of the laid-out text to be rendered if the rendering is virtualised.
+   *
+   * Sets the range of glyphs of the lines which intersect the given area.
+   *
+   * @param[in] top The top of the area.
+   * @param[in] bottom The bottom of the area.
+   */
+  void SetRenderedArea( float top, float bottom );
+
+  /**
+   * @brief Whether the given vertical area is within the area set with SetRenderedArea().
+   *
+   * @param[in] top The top of the area.
+   * @param[in] bottom The bottom of the area.
+   *
+   * @return @e true if the area has been rendered.
+   */
+  bool IsAreaRendered( float top, float bottom ) const;
+
+  /**
+   * @brief Retrieves the vertical position of the top of the given line.
+   *
+   * The positions of the lines are cached by SetRenderedArea(). Otherwise the heights of the previous lines are added.
+   *
+   * @param[in] lineIndex Index to the line.
+   *
+   * @return The vertical position of the line.
+   */
+  float GetLineOffset( LineIndex lineIndex ) const;
+
   // Underline runs
 
   /**
@@ -319,6 +350,8 @@ public:
   Vector4                mUnderlineColor;       ///< Color of underline
   Vector2                mShadowOffset;         ///< Offset for drop shadow, 0 indicates no shadow
   float                  mUnderlineHeight;      ///< Fixed height for underline to override font metrics.
+  GlyphIndex             mFirstRenderedGlyph;   ///< Index to the first glyph to be rendered if the rendering is virtualised.
+  Length                 mNumberOfRenderedGlyphs; ///< The number of glyphs to be rendered if the rendering is virtualised.
 
 private:
 
@@ -328,10 +361,15 @@ private:
   // Caches to increase performance in some consecutive operations.
   LineIndex mCachedLineIndex; ///< Used to increase performance in consecutive calls to GetLineOfGlyph() or GetLineOfCharacter() with consecutive glyphs or characters.
 
+  float mRenderedAreaTop;    ///< The top of the area of the laid-out text rendered if the rendering is virtualised.
+  float mRenderedAreaBottom; ///< The bottom of the area of the laid-out text rendered if the rendering is virtualised.
+  Vector<float> mLineOffsets; ///< The vertical position of the top of each line. Set by SetRenderedArea().
+
 public:
 
   bool                   mUnderlineEnabled:1;   ///< Underline enabled flag
   bool                   mUnderlineColorSet:1;  ///< Has the underline color been explicitly set?
+  bool                   mVirtualisedRenderingEnabled:1; ///< Whether only the glyphs of the lines close to the visible area are rendered.
 };
 
 } // namespace Text
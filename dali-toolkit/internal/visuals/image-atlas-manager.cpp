@@ -19,8 +19,13 @@
 #include "image-atlas-manager.h"
 
 // EXTERNAL HEADER
+#include <algorithm>
+#include <functional>
+#include <utility>
 #include <dali/devel-api/images/texture-set-image.h>
-#include <dali/public-api/images/resource-image.h>
+
+// INTERNAL HEADER
+#include <dali-toolkit/internal/visuals/visual-string-constants.h>
 
 namespace Dali
 {
@@ -36,15 +41,35 @@ namespace
 const uint32_t DEFAULT_ATLAS_SIZE( 1024u ); // this size can fit 8 by 8 images of average size 128*128
 const uint32_t MAX_ITEM_SIZE( 512u  );
 const uint32_t MAX_ITEM_AREA( MAX_ITEM_SIZE*MAX_ITEM_SIZE  );
+const float SPARSE_OCCUPANCY( 0.25f ); // the atlases less occupied are emptied by the compaction
+const unsigned int COMPACTION_DELAY( 1000u ); // milliseconds without image removed before compacting
+}
+
+ImageAtlasManager::AtlasContent::AtlasContent()
+: images(),
+  pixelDataRects(),
+  isDraining( false )
+{
 }
 
 ImageAtlasManager::ImageAtlasManager()
-: mBrokenImageUrl( "" )
+: mAtlasList(),
+  mTextureSetList(),
+  mAtlasContentList(),
+  mMigrations(),
+  mCompactionTimer(),
+  mDimensionsCache( ImageDimensionsCache::Get() ),
+  mBrokenImageUrl( "" )
 {
 }
 
 ImageAtlasManager::~ImageAtlasManager()
 {
+  // The atlases upload the images still loading when they are destroyed, which mustn't be notified to this manager anymore.
+  for( AtlasContainer::iterator iter = mAtlasList.begin(); iter != mAtlasList.end(); ++iter )
+  {
+    GetImplementation( *iter ).SetUploadObserver( NULL );
+  }
 }
 
 TextureSet ImageAtlasManager::Add( Vector4& textureRect,
@@ -57,7 +82,7 @@ TextureSet ImageAtlasManager::Add( Vector4& textureRect,
   ImageDimensions zero;
   if( size == zero )
   {
-    dimensions = ResourceImage::GetImageSize( url );
+    dimensions = mDimensionsCache->GetImageSize( url );
   }
 
   // big image, atlasing is not applied
@@ -69,18 +94,34 @@ TextureSet ImageAtlasManager::Add( Vector4& textureRect,
   }
 
   unsigned int i = 0;
-  for( AtlasContainer::iterator iter = mAtlasList.begin(); iter != mAtlasList.end(); ++iter)
+  for( ; i < mAtlasList.size(); i++ )
   {
-    if( (*iter).Upload( textureRect, url, size, fittingMode, orientationCorrection ) )
+    if( !mAtlasContentList[i].isDraining
+        && mAtlasList[i].Upload( textureRect, url, size, fittingMode, orientationCorrection ) )
     {
-      return mTextureSetList[i];
+      break;
     }
-    i++;
   }
 
-  CreateNewAtlas();
-  mAtlasList.back().Upload( textureRect, url, size, fittingMode, orientationCorrection );
-  return mTextureSetList.back();
+  if( i == mAtlasList.size() )
+  {
+    CreateNewAtlas();
+    mAtlasList.back().Upload( textureRect, url, size, fittingMode, orientationCorrection );
+  }
+
+  // Keep how the image was loaded, so it can be loaded again into another atlas. Nothing is packed for a zero rectangle.
+  if( textureRect != Vector4::ZERO )
+  {
+    AtlasImage image;
+    image.url = url;
+    image.size = size;
+    image.fittingMode = fittingMode;
+    image.orientationCorrection = orientationCorrection;
+    image.textureRect = textureRect;
+    mAtlasContentList[i].images.push_back( image );
+  }
+
+  return mTextureSetList[i];
 }
 
 TextureSet ImageAtlasManager::Add( Vector4& textureRect,
@@ -96,35 +137,197 @@ TextureSet ImageAtlasManager::Add( Vector4& textureRect,
   }
 
   unsigned int i = 0;
-  for( AtlasContainer::iterator iter = mAtlasList.begin(); iter != mAtlasList.end(); ++iter)
+  for( ; i < mAtlasList.size(); i++ )
   {
-    if( (*iter).Upload( textureRect, pixelData ) )
+    if( !mAtlasContentList[i].isDraining
+        && mAtlasList[i].Upload( textureRect, pixelData ) )
     {
-      return mTextureSetList[i];
+      break;
     }
-    i++;
   }
 
-  CreateNewAtlas();
-  mAtlasList.back().Upload( textureRect, pixelData );
-  return mTextureSetList.back();
+  if( i == mAtlasList.size() )
+  {
+    CreateNewAtlas();
+    mAtlasList.back().Upload( textureRect, pixelData );
+  }
 
+  mAtlasContentList[i].pixelDataRects.push_back( textureRect );
+  return mTextureSetList[i];
 }
 
 void ImageAtlasManager::Remove( TextureSet textureSet, const Vector4& textureRect )
 {
-  unsigned int i = 0;
-  for( TextureSetContainer::iterator iter = mTextureSetList.begin(); iter != mTextureSetList.end(); ++iter)
+  const unsigned int index = GetAtlasIndex( textureSet );
+  if( index == mAtlasList.size() )
   {
-    if( (*iter) == textureSet )
+    return;
+  }
+
+  // The image is not moved anymore, cancel its loading into the other atlas.
+  for( MigrationContainer::iterator iter = mMigrations.begin(); iter != mMigrations.end(); ++iter )
+  {
+    if( iter->source == textureSet && iter->sourceRect == textureRect )
     {
-      mAtlasList[i].Remove(textureRect);
+      const unsigned int destinationIndex = GetAtlasIndex( iter->destination );
+      if( destinationIndex < mAtlasList.size() )
+      {
+        mAtlasList[destinationIndex].Remove( iter->destinationRect );
+      }
+      mMigrations.erase( iter );
+      break;
+    }
+  }
+
+  // Only the areas added to the atlas are removed, so a rectangle removed twice or never packed doesn't free the area of another image.
+  AtlasContent& content = mAtlasContentList[index];
+  bool found = false;
+  for( std::vector< AtlasImage >::iterator iter = content.images.begin(); iter != content.images.end(); ++iter )
+  {
+    if( iter->textureRect == textureRect )
+    {
+      content.images.erase( iter );
+      found = true;
+      break;
+    }
+  }
+  if( !found )
+  {
+    for( std::vector< Vector4 >::iterator iter = content.pixelDataRects.begin(); iter != content.pixelDataRects.end(); ++iter )
+    {
+      if( *iter == textureRect )
+      {
+        content.pixelDataRects.erase( iter );
+        found = true;
+        break;
+      }
+    }
+  }
+  if( !found )
+  {
+    return;
+  }
+
+  mAtlasList[index].Remove( textureRect );
+
+  if( mAtlasList.size() > 1u && GetImplementation( mAtlasList[index] ).GetOccupancy() < SPARSE_OCCUPANCY )
+  {
+    StartCompactionTimer();
+  }
+}
+
+void ImageAtlasManager::RegisterRenderer( TextureSet textureSet, const Vector4& textureRect, Renderer renderer )
+{
+  const unsigned int index = GetAtlasIndex( textureSet );
+  if( index == mAtlasList.size() )
+  {
+    return;
+  }
+
+  std::vector< AtlasImage >& images = mAtlasContentList[index].images;
+  for( std::vector< AtlasImage >::iterator iter = images.begin(); iter != images.end(); ++iter )
+  {
+    if( iter->textureRect == textureRect )
+    {
+      iter->renderer = WeakHandle<Renderer>( renderer );
       return;
     }
-    i++;
   }
 }
 
+bool ImageAtlasManager::Compact()
+{
+  if( !mMigrations.empty() )
+  {
+    return true;
+  }
+
+  // Free the emptied atlases, keeping one for the next images.
+  for( unsigned int i = mAtlasList.size(); i > 0u && mAtlasList.size() > 1u; )
+  {
+    --i;
+    const AtlasContent& content = mAtlasContentList[i];
+    if( content.images.empty() && content.pixelDataRects.empty() && !GetImplementation( mAtlasList[i] ).IsLoading() )
+    {
+      RemoveAtlas( i );
+    }
+  }
+
+  if( mAtlasList.size() < 2u )
+  {
+    return false;
+  }
+
+  // Find the sparsest atlas whose images can all be moved, and the other atlases from the densest.
+  unsigned int sourceIndex = mAtlasList.size();
+  float sourceOccupancy = SPARSE_OCCUPANCY;
+  std::vector< std::pair< float, unsigned int > > destinations;
+  for( unsigned int i = 0u; i < mAtlasList.size(); i++ )
+  {
+    mAtlasContentList[i].isDraining = false;
+
+    const float occupancy = GetImplementation( mAtlasList[i] ).GetOccupancy();
+    destinations.push_back( std::make_pair( occupancy, i ) );
+    if( occupancy < sourceOccupancy && IsMovable( i ) )
+    {
+      sourceIndex = i;
+      sourceOccupancy = occupancy;
+    }
+  }
+
+  if( sourceIndex == mAtlasList.size() )
+  {
+    return false;
+  }
+
+  std::sort( destinations.begin(), destinations.end(), std::greater< std::pair< float, unsigned int > >() );
+
+  // Load the images again into the other atlases. They are only moved if they all fit.
+  const std::vector< AtlasImage >& images = mAtlasContentList[sourceIndex].images;
+  for( std::vector< AtlasImage >::const_iterator imageIter = images.begin(); imageIter != images.end(); ++imageIter )
+  {
+    bool packed = false;
+    for( std::vector< std::pair< float, unsigned int > >::iterator iter = destinations.begin(); iter != destinations.end(); ++iter )
+    {
+      const unsigned int destinationIndex = iter->second;
+      Vector4 textureRect;
+      if( destinationIndex != sourceIndex
+          && mAtlasList[destinationIndex].Upload( textureRect, imageIter->url, imageIter->size, imageIter->fittingMode, imageIter->orientationCorrection ) )
+      {
+        if( textureRect != Vector4::ZERO )
+        {
+          Migration migration;
+          migration.source = mTextureSetList[sourceIndex];
+          migration.destination = mTextureSetList[destinationIndex];
+          migration.sourceRect = imageIter->textureRect;
+          migration.destinationRect = textureRect;
+          mMigrations.push_back( migration );
+          packed = true;
+        }
+        break;
+      }
+    }
+
+    if( !packed )
+    {
+      for( MigrationContainer::iterator iter = mMigrations.begin(); iter != mMigrations.end(); ++iter )
+      {
+        mAtlasList[ GetAtlasIndex( iter->destination ) ].Remove( iter->destinationRect );
+      }
+      mMigrations.clear();
+      return false;
+    }
+  }
+
+  mAtlasContentList[sourceIndex].isDraining = true;
+  return true;
+}
+
+unsigned int ImageAtlasManager::GetNumberOfAtlases() const
+{
+  return mAtlasList.size();
+}
+
 void ImageAtlasManager::SetBrokenImage( const std::string& brokenImageUrl )
 {
   if( !brokenImageUrl.empty() )
@@ -144,6 +347,131 @@ void ImageAtlasManager::CreateNewAtlas()
   TextureSet textureSet = TextureSet::New();
   TextureSetImage( textureSet, 0u, newAtlas.GetAtlas() );
   mTextureSetList.push_back( textureSet );
+  mAtlasContentList.push_back( AtlasContent() );
+  GetImplementation( newAtlas ).SetUploadObserver( this );
+}
+
+void ImageAtlasManager::UploadCompleted( ImageAtlas& atlas, const Vector4& textureRect )
+{
+  MigrationContainer::iterator migrationIter = mMigrations.begin();
+  for( ; migrationIter != mMigrations.end(); ++migrationIter )
+  {
+    if( migrationIter->destinationRect == textureRect )
+    {
+      const unsigned int destinationIndex = GetAtlasIndex( migrationIter->destination );
+      if( destinationIndex < mAtlasList.size() && &GetImplementation( mAtlasList[destinationIndex] ) == &atlas )
+      {
+        break;
+      }
+    }
+  }
+
+  if( migrationIter == mMigrations.end() )
+  {
+    return;
+  }
+
+  const Migration migration = *migrationIter;
+  mMigrations.erase( migrationIter );
+
+  const unsigned int sourceIndex = GetAtlasIndex( migration.source );
+  const unsigned int destinationIndex = GetAtlasIndex( migration.destination );
+  std::vector< AtlasImage >& images = mAtlasContentList[sourceIndex].images;
+  for( std::vector< AtlasImage >::iterator iter = images.begin(); iter != images.end(); ++iter )
+  {
+    if( iter->textureRect == migration.sourceRect )
+    {
+      // The image is uploaded to the other atlas, switch the renderer to it.
+      Renderer renderer = iter->renderer.GetHandle();
+      if( renderer )
+      {
+        renderer.SetTextures( migration.destination );
+        Property::Index index = renderer.GetPropertyIndex( ATLAS_RECT_UNIFORM_NAME );
+        if( index != Property::INVALID_INDEX )
+        {
+          renderer.SetProperty( index, migration.destinationRect );
+        }
+      }
+
+      AtlasImage image = *iter;
+      image.textureRect = migration.destinationRect;
+      mAtlasContentList[destinationIndex].images.push_back( image );
+      images.erase( iter );
+      break;
+    }
+  }
+
+  mAtlasList[sourceIndex].Remove( migration.sourceRect );
+
+  // All the images are moved, free the atlas texture.
+  if( images.empty() )
+  {
+    RemoveAtlas( sourceIndex );
+  }
+
+  // Look for the next sparse atlas.
+  if( mMigrations.empty() )
+  {
+    StartCompactionTimer();
+  }
+}
+
+unsigned int ImageAtlasManager::GetAtlasIndex( TextureSet textureSet ) const
+{
+  unsigned int i = 0;
+  for( TextureSetContainer::const_iterator iter = mTextureSetList.begin(); iter != mTextureSetList.end(); ++iter )
+  {
+    if( (*iter) == textureSet )
+    {
+      break;
+    }
+    i++;
+  }
+  return i;
+}
+
+void ImageAtlasManager::RemoveAtlas( unsigned int index )
+{
+  GetImplementation( mAtlasList[index] ).SetUploadObserver( NULL );
+  mAtlasList.erase( mAtlasList.begin() + index );
+  mTextureSetList.erase( mTextureSetList.begin() + index );
+  mAtlasContentList.erase( mAtlasContentList.begin() + index );
+}
+
+bool ImageAtlasManager::IsMovable( unsigned int index )
+{
+  AtlasContent& content = mAtlasContentList[index];
+  if( content.images.empty() || !content.pixelDataRects.empty() || GetImplementation( mAtlasList[index] ).IsLoading() )
+  {
+    return false;
+  }
+
+  // The images without renderer can't be switched to the other atlas.
+  for( std::vector< AtlasImage >::iterator iter = content.images.begin(); iter != content.images.end(); ++iter )
+  {
+    if( !iter->renderer.GetHandle() )
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+void ImageAtlasManager::StartCompactionTimer()
+{
+  if( !mCompactionTimer )
+  {
+    mCompactionTimer = Timer::New( COMPACTION_DELAY );
+    mCompactionTimer.TickSignal().Connect( this, &ImageAtlasManager::OnCompactionTimer );
+  }
+
+  mCompactionTimer.Start();
+}
+
+bool ImageAtlasManager::OnCompactionTimer()
+{
+  Compact();
+  return false;
 }
 
 } // namespace Internal
@@ -19,12 +19,18 @@
 
 // EXTERNAL INCLUDES
 #include <string>
+#include <dali/public-api/adaptor-framework/timer.h>
 #include <dali/public-api/common/vector-wrapper.h>
 #include <dali/public-api/object/ref-object.h>
+#include <dali/public-api/rendering/renderer.h>
 #include <dali/public-api/rendering/texture-set.h>
+#include <dali/public-api/signals/connection-tracker.h>
+#include <dali/devel-api/object/weak-handle.h>
 
 // INTERNAL INCLUDES
 #include <dali-toolkit/devel-api/image-atlas/image-atlas.h>
+#include <dali-toolkit/internal/image-atlas/image-atlas-impl.h>
+#include <dali-toolkit/internal/image-atlas/image-dimensions-cache.h>
 
 namespace Dali
 {
@@ -37,8 +43,16 @@ namespace Internal
 
 /**
  * The manager for automatic image atlasing. Owned by VisualFactory
+ *
+ * New atlases are only created when an image doesn't fit into the existing ones, and removing an image just frees its area,
+ * so the atlases get sparse as the images come and go. When an atlas gets sparse, a compaction pass runs once the
+ * application has been idle for a while: the images of the sparsest atlas are loaded again into the denser atlases,
+ * their renderers are switched to the new texture areas once the images are uploaded, and the emptied atlas is freed.
+ *
+ * Only the images loaded from url with a registered renderer can be moved, as the pixels are not kept once uploaded.
+ * The atlases holding pixel buffers are never emptied by the compaction.
  */
-class ImageAtlasManager : public RefObject
+class ImageAtlasManager : public RefObject, public ConnectionTracker, public ImageAtlas::UploadObserver
 {
 public:
   typedef std::vector< Toolkit::ImageAtlas > AtlasContainer;
@@ -91,6 +105,34 @@ public:
    */
   void Remove( TextureSet textureSet, const Vector4& textureRect );
 
+  /**
+   * Register the renderer showing the image, so it's updated when the image is moved to another atlas.
+   *
+   * The renderer must use the texture set and have the texture rectangle registered as the "uAtlasRect" uniform.
+   * It's not kept alive by the manager.
+   *
+   * @param [in] textureSet The texture set containing the atlas image.
+   * @param [in] textureRect The texture area of the image.
+   * @param [in] renderer The renderer showing the image.
+   */
+  void RegisterRenderer( TextureSet textureSet, const Vector4& textureRect, Renderer renderer );
+
+  /**
+   * Run a compaction pass.
+   *
+   * The emptied atlases are freed, and the images of the sparsest atlas are moved into the denser ones if they all fit.
+   * The images are moved once they are loaded again, so the pass does nothing while the images of the previous pass are loading.
+   * It's called by the compaction timer, and can be called directly to compact at once.
+   *
+   * @return Whether the images of an atlas are being moved.
+   */
+  bool Compact();
+
+  /**
+   * Retrieve the number of atlases.
+   */
+  unsigned int GetNumberOfAtlases() const;
+
   /**
    * @brief Set the broken image which is used to replace the image if loading fails.
    *
@@ -112,6 +154,45 @@ private:
    */
   void CreateNewAtlas();
 
+  /**
+   * @copydoc ImageAtlas::UploadObserver::UploadCompleted
+   */
+  virtual void UploadCompleted( ImageAtlas& atlas, const Vector4& textureRect );
+
+  /**
+   * Retrieve the index of the atlas of the given texture set.
+   *
+   * @param[in] textureSet The texture set of the atlas.
+   * @return The index of the atlas, or the number of atlases if there is no atlas with the texture set.
+   */
+  unsigned int GetAtlasIndex( TextureSet textureSet ) const;
+
+  /**
+   * Free the atlas at the given index.
+   *
+   * @param[in] index The index of the atlas.
+   */
+  void RemoveAtlas( unsigned int index );
+
+  /**
+   * Query whether the images of the atlas at the given index can all be moved to other atlases.
+   *
+   * @param[in] index The index of the atlas.
+   */
+  bool IsMovable( unsigned int index );
+
+  /**
+   * Start the compaction timer, or restart it so the compaction waits until the images stop being removed.
+   */
+  void StartCompactionTimer();
+
+  /**
+   * Called when the compaction timer ticks.
+   *
+   * @return false, so the timer is stopped.
+   */
+  bool OnCompactionTimer();
+
 protected:
 
   /**
@@ -132,8 +213,51 @@ protected:
 
 private:
 
+  /**
+   * An image loaded from url, which can be moved to another atlas.
+   */
+  struct AtlasImage
+  {
+    std::string          url;
+    ImageDimensions      size;
+    FittingMode::Type    fittingMode;
+    bool                 orientationCorrection;
+    Vector4              textureRect;
+    WeakHandle<Renderer> renderer;    ///< The renderer showing the image, switched to the new texture area when the image is moved.
+  };
+
+  /**
+   * The content of an atlas.
+   */
+  struct AtlasContent
+  {
+    AtlasContent();
+
+    std::vector< AtlasImage > images;         ///< The images loaded from url.
+    std::vector< Vector4 >    pixelDataRects; ///< The texture areas of the pixel buffers, which can't be moved.
+    bool                      isDraining;     ///< Whether the images are being moved out of the atlas. No image is added then.
+  };
+
+  /**
+   * An image being moved to another atlas, until it's uploaded.
+   */
+  struct Migration
+  {
+    TextureSet source;      ///< The texture set of the atlas the image is moved from.
+    TextureSet destination; ///< The texture set of the atlas the image is moved to.
+    Vector4    sourceRect;
+    Vector4    destinationRect;
+  };
+
+  typedef std::vector< AtlasContent > AtlasContentContainer;
+  typedef std::vector< Migration > MigrationContainer;
+
   AtlasContainer    mAtlasList;
   TextureSetContainer mTextureSetList;
+  AtlasContentContainer mAtlasContentList; ///< The content of each atlas.
+  MigrationContainer mMigrations;          ///< The images of the current compaction pass which are not uploaded yet.
+  Timer             mCompactionTimer;      ///< Runs a compaction pass once the application has been idle for a while.
+  ImageDimensionsCachePtr mDimensionsCache; ///< The image dimensions shared by all the atlases and visuals.
   std::string       mBrokenImageUrl;
 
 };
@@ -144,6 +144,7 @@ ImageVisual::ImageVisual( VisualFactoryCache& factoryCache, ImageAtlasManager& a
   mDesiredSize(),
   mFittingMode( FittingMode::DEFAULT ),
   mSamplingMode( SamplingMode::DEFAULT ),
+  mRendererKey(),
   mNativeFragmentShaderCode( ),
   mNativeImageFlag( false )
 {
@@ -226,7 +227,7 @@ void ImageVisual::DoInitialize( Actor& actor, const Property::Map& propertyMap )
     }
     if( !oldImageUrl.empty() ) //clean old renderer from cache
     {
-      CleanCache( oldImageUrl );
+      CleanCache();
     }
   }
 
@@ -265,7 +266,7 @@ void ImageVisual::GetNaturalSize( Vector2& naturalSize ) const
   }
   else if( !mImageUrl.empty() )
   {
-    ImageDimensions dimentions = ResourceImage::GetImageSize( mImageUrl );
+    ImageDimensions dimentions = mFactoryCache.GetImageDimensionsCache().GetImageSize( mImageUrl );
     naturalSize.x = dimentions.GetWidth();
     naturalSize.y = dimentions.GetHeight();
     return;
@@ -449,7 +450,8 @@ void ImageVisual::InitializeRenderer( const std::string& imageUrl )
       ( strncasecmp( imageUrl.c_str(), HTTP_URL,  sizeof(HTTP_URL)  -1 ) != 0 ) && // ignore remote images
       ( strncasecmp( imageUrl.c_str(), HTTPS_URL, sizeof(HTTPS_URL) -1 ) != 0 ) )
   {
-    mImpl->mRenderer = mFactoryCache.GetRenderer( imageUrl );
+    mRendererKey = VisualFactoryCache::RendererKey( imageUrl, mDesiredSize, mFittingMode, mSamplingMode );
+    mImpl->mRenderer = mFactoryCache.GetRenderer( mRendererKey );
     if( !mImpl->mRenderer )
     {
       Vector4 atlasRect;
@@ -461,8 +463,9 @@ void ImageVisual::InitializeRenderer( const std::string& imageUrl )
       if( atlasRect != FULL_TEXTURE_RECT )
       {
         mImpl->mRenderer.RegisterProperty( ATLAS_RECT_UNIFORM_NAME, atlasRect );
+        mAtlasManager.RegisterRenderer( textureSet, atlasRect, mImpl->mRenderer );
       }
-      mFactoryCache.SaveRenderer( imageUrl, mImpl->mRenderer );
+      mFactoryCache.SaveRenderer( mRendererKey, mImpl->mRenderer );
     }
 
     mImpl->mFlags |= Impl::IS_FROM_CACHE;
@@ -510,7 +513,7 @@ void ImageVisual::DoSetOffStage( Actor& actor )
   if( !mImageUrl.empty() )
   {
     actor.RemoveRenderer( mImpl->mRenderer );
-    CleanCache(mImageUrl);
+    CleanCache();
     mImage.Reset();
   }
   else
@@ -591,7 +594,7 @@ void ImageVisual::SetImage( Actor& actor, const std::string& imageUrl, ImageDime
         //clean the cache
         if( !oldImageUrl.empty() )
         {
-          CleanCache(oldImageUrl);
+          CleanCache();
         }
 
         if( actor && actor.OnStage() ) // if actor on stage, create a new renderer and apply to actor
@@ -651,7 +654,7 @@ void ImageVisual::SetImage( Actor& actor, const Image& image )
         //clean the cache
         if( !mImageUrl.empty() )
         {
-          CleanCache(mImageUrl);
+          CleanCache();
         }
         mImageUrl.clear();
 
@@ -713,7 +716,7 @@ void ImageVisual::OnImageLoaded( ResourceImage image )
   }
 }
 
-void ImageVisual::CleanCache(const std::string& url)
+void ImageVisual::CleanCache()
 {
   TextureSet textureSet = mImpl->mRenderer.GetTextures();
 
@@ -726,7 +729,7 @@ void ImageVisual::CleanCache(const std::string& url)
   }
 
   mImpl->mRenderer.Reset();
-  if( mFactoryCache.CleanRendererCache( url ) && index != Property::INVALID_INDEX )
+  if( mFactoryCache.CleanRendererCache( mRendererKey ) && index != Property::INVALID_INDEX )
   {
     mAtlasManager.Remove( textureSet, atlasRect );
   }
@@ -243,7 +243,7 @@ private:
   /**
    * Clean the renderer from cache, and remove the image from atlas if it is not used anymore
    */
-  void CleanCache(const std::string& url);
+  void CleanCache();
 
   /**
    * Set shader code for nativeimage if it exists
@@ -259,6 +259,7 @@ private:
   Dali::ImageDimensions mDesiredSize;
   Dali::FittingMode::Type mFittingMode;
   Dali::SamplingMode::Type mSamplingMode;
+  VisualFactoryCache::RendererKey mRendererKey; ///< The key of the cached renderer, with the url and load parameters it was created with.
 
   std::string mNativeFragmentShaderCode;
   bool mNativeImageFlag;
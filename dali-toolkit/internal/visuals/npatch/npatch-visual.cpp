@@ -21,7 +21,6 @@
 // EXTERNAL INCLUDES
 #include <dali/integration-api/platform-abstraction.h>
 #include <dali/public-api/images/buffer-image.h>
-#include <dali/public-api/images/resource-image.h>
 #include <dali/devel-api/images/texture-set-image.h>
 
 // INTERNAL IINCLUDES
@@ -244,7 +243,7 @@ void NPatchVisual::GetNaturalSize( Vector2& naturalSize ) const
   }
   else if( !mImageUrl.empty() )
   {
-    ImageDimensions dimentions = ResourceImage::GetImageSize( mImageUrl );
+    ImageDimensions dimentions = mFactoryCache.GetImageDimensionsCache().GetImageSize( mImageUrl );
     naturalSize.x = dimentions.GetWidth();
     naturalSize.y = dimentions.GetHeight();
   }
@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include "svg-document-cache.h"
+
+// INTERNAL INCLUDES
+#include <dali-toolkit/third-party/nanosvg/nanosvg.h>
+
+namespace
+{
+const char * const UNITS("px");
+}
+
+namespace Dali
+{
+
+namespace Toolkit
+{
+
+namespace Internal
+{
+
+SvgDocument::SvgDocument( SvgDocumentCache& cache, const std::string& url, float dpi )
+: mCache( cache ),
+  mUrl( url ),
+  mMutex(),
+  mParsedImage( NULL ),
+  mNaturalSize(),
+  mDpi( dpi ),
+  mIsParsed( false ),
+  mHasNaturalSize( false )
+{
+}
+
+SvgDocument::~SvgDocument()
+{
+  mCache.RemoveDocument( this );
+
+  if( mParsedImage )
+  {
+    nsvgDelete( mParsedImage );
+  }
+}
+
+const std::string& SvgDocument::GetUrl() const
+{
+  return mUrl;
+}
+
+float SvgDocument::GetDpi() const
+{
+  return mDpi;
+}
+
+NSVGimage* SvgDocument::GetParsedImage()
+{
+  // Lock while parsing as the document may be requested by several worker threads at the same time.
+  Mutex::ScopedLock lock( mMutex );
+
+  if( !mIsParsed )
+  {
+    mParsedImage = nsvgParseFromFile( mUrl.c_str(), UNITS, mDpi );
+    mIsParsed = true;
+  }
+
+  return mParsedImage;
+}
+
+bool SvgDocument::HasNaturalSize() const
+{
+  return mHasNaturalSize;
+}
+
+const Vector2& SvgDocument::GetNaturalSize() const
+{
+  return mNaturalSize;
+}
+
+void SvgDocument::SetNaturalSize( const Vector2& naturalSize )
+{
+  mNaturalSize = naturalSize;
+  mHasNaturalSize = true;
+}
+
+SvgDocumentCache::SvgDocumentCache()
+: mDocuments()
+{
+}
+
+SvgDocumentCache::~SvgDocumentCache()
+{
+}
+
+SvgDocumentPtr SvgDocumentCache::GetDocument( const std::string& url, float dpi )
+{
+  Documents::iterator it = mDocuments.find( url );
+  if( it != mDocuments.end() )
+  {
+    return SvgDocumentPtr( it->second );
+  }
+
+  SvgDocument* document = new SvgDocument( *this, url, dpi );
+  mDocuments.insert( Documents::value_type( url, document ) );
+
+  return SvgDocumentPtr( document );
+}
+
+void SvgDocumentCache::RemoveDocument( SvgDocument* document )
+{
+  Documents::iterator it = mDocuments.find( document->GetUrl() );
+  if( ( it != mDocuments.end() ) && ( it->second == document ) )
+  {
+    mDocuments.erase( it );
+  }
+}
+
+} // namespace Internal
+
+} // namespace Toolkit
+
+} // namespace Dali
@@ -0,0 +1,189 @@
+#ifndef DALI_TOOLKIT_SVG_DOCUMENT_CACHE_H
+#define DALI_TOOLKIT_SVG_DOCUMENT_CACHE_H
+
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <map>
+#include <string>
+#include <dali/devel-api/threading/mutex.h>
+#include <dali/public-api/common/intrusive-ptr.h>
+#include <dali/public-api/math/vector2.h>
+#include <dali/public-api/object/ref-object.h>
+
+struct NSVGimage;
+
+namespace Dali
+{
+
+namespace Toolkit
+{
+
+namespace Internal
+{
+
+class SvgDocumentCache;
+class SvgDocument;
+typedef IntrusivePtr< SvgDocument > SvgDocumentPtr;
+
+/**
+ * A svg document shared by all the svg visuals with the same url.
+ *
+ * The document is parsed in a worker thread the first time the parsed image is requested, by the task queued
+ * when the first visual is given the url or by the first rasterization. The main thread never parses it;
+ * it only knows the natural size once a completed task is processed.
+ *
+ * The document is created and deleted in the main thread. The rasterizing tasks keep a reference to it and
+ * they are always deleted in the main thread.
+ */
+class SvgDocument : public RefObject
+{
+public:
+
+  /**
+   * Constructor
+   *
+   * @param[in] cache The cache where the document is registered.
+   * @param[in] url The url of the svg file.
+   * @param[in] dpi The dpi used to convert the units of the svg file to pixels.
+   */
+  SvgDocument( SvgDocumentCache& cache, const std::string& url, float dpi );
+
+  /**
+   * Retrieves the url of the svg file.
+   */
+  const std::string& GetUrl() const;
+
+  /**
+   * Retrieves the dpi used to convert the units of the svg file to pixels.
+   */
+  float GetDpi() const;
+
+  /**
+   * Retrieves the parsed svg image. The svg file is parsed the first time, called by the worker threads.
+   *
+   * @return The parsed image or NULL if the svg file can't be parsed.
+   */
+  NSVGimage* GetParsedImage();
+
+  /**
+   * Whether the natural size is known, i.e. a task which parsed the document has been processed by the main thread.
+   */
+  bool HasNaturalSize() const;
+
+  /**
+   * Retrieves the natural size of the svg image, called by the main thread.
+   *
+   * @return The natural size, or zero if it's not known yet or the svg file can't be parsed.
+   */
+  const Vector2& GetNaturalSize() const;
+
+  /**
+   * Sets the natural size of the parsed svg image, called by the main thread when a task which parsed the document has completed.
+   *
+   * @param[in] naturalSize The natural size, zero if the svg file can't be parsed.
+   */
+  void SetNaturalSize( const Vector2& naturalSize );
+
+protected:
+
+  /**
+   * A reference counted object may only be deleted by calling Unreference().
+   * Removes the document from the cache and deletes the parsed image.
+   */
+  virtual ~SvgDocument();
+
+private:
+
+  // Undefined
+  SvgDocument( const SvgDocument& document );
+
+  // Undefined
+  SvgDocument& operator=( const SvgDocument& document );
+
+private:
+
+  SvgDocumentCache& mCache;
+  std::string       mUrl;
+  Dali::Mutex       mMutex;
+  NSVGimage*        mParsedImage;
+  Vector2           mNaturalSize;      ///< The natural size, only accessed by the main thread.
+  float             mDpi;
+  bool              mIsParsed;         ///< Whether the svg file has been parsed, only accessed by the worker threads.
+  bool              mHasNaturalSize;   ///< Whether the natural size is known, only accessed by the main thread.
+};
+
+/**
+ * Keeps the svg documents used by the svg visuals, so the visuals with the same url share the parsed image.
+ *
+ * The cache doesn't keep the documents alive. A document is removed from the cache when the last visual or task which uses it is deleted.
+ * It's only accessed by the main thread.
+ */
+class SvgDocumentCache
+{
+public:
+
+  /**
+   * Constructor
+   */
+  SvgDocumentCache();
+
+  /**
+   * Destructor
+   */
+  ~SvgDocumentCache();
+
+  /**
+   * Retrieves the document of the given url. A new document is created if there isn't one in the cache.
+   *
+   * @param[in] url The url of the svg file.
+   * @param[in] dpi The dpi used to convert the units of the svg file to pixels if a new document is created.
+   *
+   * @return The document.
+   */
+  SvgDocumentPtr GetDocument( const std::string& url, float dpi );
+
+  /**
+   * Removes a document from the cache, called by the document when it's deleted.
+   *
+   * @param[in] document The document.
+   */
+  void RemoveDocument( SvgDocument* document );
+
+private:
+
+  // Undefined
+  SvgDocumentCache( const SvgDocumentCache& cache );
+
+  // Undefined
+  SvgDocumentCache& operator=( const SvgDocumentCache& cache );
+
+private:
+
+  typedef std::map< std::string, SvgDocument* > Documents;
+
+  Documents mDocuments; ///< The documents indexed by their url.
+};
+
+} // namespace Internal
+
+} // namespace Toolkit
+
+} // namespace Dali
+
+#endif // DALI_TOOLKIT_SVG_DOCUMENT_CACHE_H
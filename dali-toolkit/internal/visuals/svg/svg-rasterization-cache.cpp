@@ -0,0 +1,210 @@
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include "svg-rasterization-cache.h"
+
+// EXTERNAL INCLUDES
+#include <dali/devel-api/images/atlas.h>
+#include <dali/devel-api/images/texture-set-image.h>
+
+// INTERNAL INCLUDES
+#include <dali-toolkit/internal/visuals/image-atlas-manager.h>
+
+namespace
+{
+const Dali::Vector4 FULL_TEXTURE_RECT(0.f, 0.f, 1.f, 1.f);
+const unsigned int MEMORY_BUDGET = 8u * 1024u * 1024u; ///< The maximum size in bytes of the cached images. Images used by visuals are not deleted.
+}
+
+namespace Dali
+{
+
+namespace Toolkit
+{
+
+namespace Internal
+{
+
+SvgRasterizedImage::SvgRasterizedImage( ImageAtlasManager& atlasManager, PixelData pixelData )
+: mAtlasManager( &atlasManager ),
+  mTextureSet(),
+  mAtlasRect( FULL_TEXTURE_RECT ),
+  mDataSize( pixelData.GetWidth() * pixelData.GetHeight() * Pixel::GetBytesPerPixel( pixelData.GetPixelFormat() ) )
+{
+  mTextureSet = mAtlasManager->Add( mAtlasRect, pixelData );
+  if( !mTextureSet ) // no atlasing
+  {
+    Atlas texture = Atlas::New( pixelData.GetWidth(), pixelData.GetHeight() );
+    texture.Upload( pixelData, 0, 0 );
+
+    mTextureSet = TextureSet::New();
+    TextureSetImage( mTextureSet, 0u, texture );
+    mAtlasRect = FULL_TEXTURE_RECT;
+  }
+}
+
+SvgRasterizedImage::~SvgRasterizedImage()
+{
+  if( mAtlasRect != FULL_TEXTURE_RECT )
+  {
+    mAtlasManager->Remove( mTextureSet, mAtlasRect );
+  }
+}
+
+TextureSet SvgRasterizedImage::GetTextureSet() const
+{
+  return mTextureSet;
+}
+
+const Vector4& SvgRasterizedImage::GetAtlasRect() const
+{
+  return mAtlasRect;
+}
+
+unsigned int SvgRasterizedImage::GetDataSize() const
+{
+  return mDataSize;
+}
+
+SvgRasterizationCache::Key::Key( const std::string& url, unsigned int width, unsigned int height )
+: mUrl( url ),
+  mWidth( width ),
+  mHeight( height )
+{
+}
+
+bool SvgRasterizationCache::Key::operator<( const Key& rhs ) const
+{
+  if( mWidth != rhs.mWidth )
+  {
+    return mWidth < rhs.mWidth;
+  }
+
+  if( mHeight != rhs.mHeight )
+  {
+    return mHeight < rhs.mHeight;
+  }
+
+  return mUrl < rhs.mUrl;
+}
+
+SvgRasterizationCache::CachedImage::CachedImage( const Key& key, SvgRasterizedImagePtr image )
+: mKey( key ),
+  mImage( image )
+{
+}
+
+SvgRasterizationCache::SvgRasterizationCache()
+: mImages(),
+  mImageMap(),
+  mTasks(),
+  mDataSize( 0u )
+{
+}
+
+SvgRasterizationCache::~SvgRasterizationCache()
+{
+}
+
+SvgRasterizedImagePtr SvgRasterizationCache::GetImage( const std::string& url, unsigned int width, unsigned int height )
+{
+  ImageMap::iterator it = mImageMap.find( Key( url, width, height ) );
+  if( it == mImageMap.end() )
+  {
+    return SvgRasterizedImagePtr();
+  }
+
+  // Move the image to the front of the list.
+  mImages.splice( mImages.begin(), mImages, it->second );
+
+  return it->second->mImage;
+}
+
+void SvgRasterizationCache::AddImage( const std::string& url, unsigned int width, unsigned int height, SvgRasterizedImagePtr image )
+{
+  const Key key( url, width, height );
+
+  ImageMap::iterator it = mImageMap.find( key );
+  if( it != mImageMap.end() )
+  {
+    // Replace the image.
+    mDataSize -= it->second->mImage->GetDataSize();
+    mImages.erase( it->second );
+    mImageMap.erase( it );
+  }
+
+  mImages.push_front( CachedImage( key, image ) );
+  mImageMap.insert( ImageMap::value_type( key, mImages.begin() ) );
+  mDataSize += image->GetDataSize();
+
+  Evict();
+}
+
+RasterizingTaskPtr SvgRasterizationCache::GetTask( const std::string& url, unsigned int width, unsigned int height ) const
+{
+  TaskMap::const_iterator it = mTasks.find( Key( url, width, height ) );
+  if( it == mTasks.end() )
+  {
+    return RasterizingTaskPtr();
+  }
+
+  return RasterizingTaskPtr( it->second );
+}
+
+void SvgRasterizationCache::AddTask( RasterizingTaskPtr task )
+{
+  mTasks[ Key( task->GetUrl(), task->GetWidth(), task->GetHeight() ) ] = task.Get();
+}
+
+void SvgRasterizationCache::RemoveTask( RasterizingTaskPtr task )
+{
+  TaskMap::iterator it = mTasks.find( Key( task->GetUrl(), task->GetWidth(), task->GetHeight() ) );
+  if( ( it != mTasks.end() ) && ( it->second == task.Get() ) )
+  {
+    mTasks.erase( it );
+  }
+}
+
+unsigned int SvgRasterizationCache::GetDataSize() const
+{
+  return mDataSize;
+}
+
+void SvgRasterizationCache::Evict()
+{
+  // Traverse the images from the least recently used.
+  ImageList::iterator it = mImages.end();
+  while( ( mDataSize > MEMORY_BUDGET ) && ( it != mImages.begin() ) )
+  {
+    --it;
+
+    // The image is not used by any visual if the cache keeps the only reference.
+    if( 1 == it->mImage->ReferenceCount() )
+    {
+      mDataSize -= it->mImage->GetDataSize();
+      mImageMap.erase( it->mKey );
+      it = mImages.erase( it );
+    }
+  }
+}
+
+} // namespace Internal
+
+} // namespace Toolkit
+
+} // namespace Dali
@@ -0,0 +1,232 @@
+#ifndef DALI_TOOLKIT_SVG_RASTERIZATION_CACHE_H
+#define DALI_TOOLKIT_SVG_RASTERIZATION_CACHE_H
+
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <list>
+#include <map>
+#include <string>
+#include <dali/public-api/common/intrusive-ptr.h>
+#include <dali/public-api/images/pixel-data.h>
+#include <dali/public-api/math/vector4.h>
+#include <dali/public-api/object/ref-object.h>
+#include <dali/public-api/rendering/texture-set.h>
+
+// INTERNAL INCLUDES
+#include <dali-toolkit/internal/visuals/svg/svg-rasterize-thread.h>
+
+namespace Dali
+{
+
+namespace Toolkit
+{
+
+namespace Internal
+{
+
+class ImageAtlasManager;
+typedef IntrusivePtr< ImageAtlasManager > ImageAtlasManagerPtr;
+class SvgRasterizedImage;
+typedef IntrusivePtr< SvgRasterizedImage > SvgRasterizedImagePtr;
+
+/**
+ * A rasterized svg image shared by all the svg visuals with the same url and size.
+ *
+ * The pixels are added to the atlas once. The atlas area is released when the image is deleted.
+ */
+class SvgRasterizedImage : public RefObject
+{
+public:
+
+  /**
+   * Constructor. Adds the pixels to the atlas or, if they don't fit, to a texture of their own.
+   *
+   * @param[in] atlasManager The atlas manager.
+   * @param[in] pixelData The rasterized pixels.
+   */
+  SvgRasterizedImage( ImageAtlasManager& atlasManager, PixelData pixelData );
+
+  /**
+   * Get the texture set containing the image.
+   */
+  TextureSet GetTextureSet() const;
+
+  /**
+   * Get the texture area of the image.
+   */
+  const Vector4& GetAtlasRect() const;
+
+  /**
+   * Get the size in bytes of the rasterized pixels.
+   */
+  unsigned int GetDataSize() const;
+
+protected:
+
+  /**
+   * A reference counted object may only be deleted by calling Unreference().
+   * Removes the image from the atlas.
+   */
+  virtual ~SvgRasterizedImage();
+
+private:
+
+  // Undefined
+  SvgRasterizedImage( const SvgRasterizedImage& image );
+
+  // Undefined
+  SvgRasterizedImage& operator=( const SvgRasterizedImage& image );
+
+private:
+
+  ImageAtlasManagerPtr mAtlasManager;
+  TextureSet           mTextureSet;
+  Vector4              mAtlasRect;
+  unsigned int         mDataSize;
+};
+
+/**
+ * Caches the rasterized svg images by url and size, so the visuals showing the same icon at the same size
+ * share one rasterization and one atlas area.
+ *
+ * It also keeps the tasks being rasterized, so a visual which needs an image being rasterized for another
+ * visual waits for the same task instead of adding a new one.
+ *
+ * The least recently used images not used by any visual are deleted when the size of all the cached images
+ * exceeds the memory budget. It's only accessed by the main thread.
+ */
+class SvgRasterizationCache
+{
+public:
+
+  /**
+   * Constructor
+   */
+  SvgRasterizationCache();
+
+  /**
+   * Destructor
+   */
+  ~SvgRasterizationCache();
+
+  /**
+   * Retrieves a rasterized image and marks it as the most recently used.
+   *
+   * @param[in] url The url of the svg file.
+   * @param[in] width The rasterization width.
+   * @param[in] height The rasterization height.
+   *
+   * @return The rasterized image or an empty pointer if it's not in the cache.
+   */
+  SvgRasterizedImagePtr GetImage( const std::string& url, unsigned int width, unsigned int height );
+
+  /**
+   * Adds a rasterized image to the cache. The least recently used images not used by any visual may be deleted.
+   *
+   * @param[in] url The url of the svg file.
+   * @param[in] width The rasterization width.
+   * @param[in] height The rasterization height.
+   * @param[in] image The rasterized image.
+   */
+  void AddImage( const std::string& url, unsigned int width, unsigned int height, SvgRasterizedImagePtr image );
+
+  /**
+   * Retrieves the task rasterizing the svg file at the given size.
+   *
+   * @param[in] url The url of the svg file.
+   * @param[in] width The rasterization width.
+   * @param[in] height The rasterization height.
+   *
+   * @return The task or an empty pointer if there isn't one.
+   */
+  RasterizingTaskPtr GetTask( const std::string& url, unsigned int width, unsigned int height ) const;
+
+  /**
+   * Adds a task which has been added to the thread pool.
+   *
+   * @param[in] task The task.
+   */
+  void AddTask( RasterizingTaskPtr task );
+
+  /**
+   * Removes a task when it's completed or cancelled.
+   *
+   * @param[in] task The task.
+   */
+  void RemoveTask( RasterizingTaskPtr task );
+
+  /**
+   * Retrieves the size in bytes of all the cached images.
+   */
+  unsigned int GetDataSize() const;
+
+private:
+
+  /**
+   * Deletes the least recently used images not used by any visual until the size of the cached images is within the budget.
+   */
+  void Evict();
+
+  // Undefined
+  SvgRasterizationCache( const SvgRasterizationCache& cache );
+
+  // Undefined
+  SvgRasterizationCache& operator=( const SvgRasterizationCache& cache );
+
+private:
+
+  /**
+   * The key of the cached images and tasks.
+   */
+  struct Key
+  {
+    Key( const std::string& url, unsigned int width, unsigned int height );
+
+    bool operator<( const Key& rhs ) const;
+
+    std::string  mUrl;
+    unsigned int mWidth;
+    unsigned int mHeight;
+  };
+
+  struct CachedImage
+  {
+    CachedImage( const Key& key, SvgRasterizedImagePtr image );
+
+    Key                   mKey;
+    SvgRasterizedImagePtr mImage;
+  };
+
+  typedef std::list< CachedImage > ImageList;
+  typedef std::map< Key, ImageList::iterator > ImageMap;
+  typedef std::map< Key, RasterizingTask* > TaskMap;
+
+  ImageList    mImages;       ///< The cached images. The most recently used first.
+  ImageMap     mImageMap;     ///< The cached images indexed by url and size.
+  TaskMap      mTasks;        ///< The tasks being rasterized indexed by url and size.
+  unsigned int mDataSize;     ///< The size in bytes of all the cached images.
+};
+
+} // namespace Internal
+
+} // namespace Toolkit
+
+} // namespace Dali
+
+#endif // DALI_TOOLKIT_SVG_RASTERIZATION_CACHE_H
@@ -18,10 +18,59 @@
 // CLASS HEADER
 #include "svg-rasterize-thread.h"
 
+// EXTERNAL INCLUDES
+#include <algorithm>
+#include <cstdlib>
+#include <unistd.h>
+#include <dali/devel-api/adaptor-framework/environment-variable.h>
+
 // INTERNAL INCLUDES
 #include <dali-toolkit/third-party/nanosvg/nanosvgrast.h>
 #include <dali-toolkit/internal/visuals/svg/svg-visual.h>
 
+namespace
+{
+const char* const DALI_SVG_RASTERIZE_THREADS = "DALI_SVG_RASTERIZE_THREADS";
+const char* const DALI_SVG_RASTERIZE_SIMD = "DALI_SVG_RASTERIZE_SIMD";
+const unsigned int MAX_NUMBER_OF_RASTERIZE_THREADS = 8u;
+const unsigned int DEFAULT_MAX_NUMBER_OF_RASTERIZE_THREADS = 4u; ///< Maximum number of threads if it's not set with the environment variable.
+
+/**
+ * Retrieves the number of worker threads. One less than the number of cores, as the main thread
+ * is busy as well, unless it's set with the DALI_SVG_RASTERIZE_THREADS environment variable.
+ */
+unsigned int GetNumberOfRasterizeThreads()
+{
+  const char* threads = Dali::EnvironmentVariable::GetEnvironmentVariable( DALI_SVG_RASTERIZE_THREADS );
+  if( NULL != threads )
+  {
+    const long value = std::strtol( threads, NULL, 10 );
+    if( value > 0 )
+    {
+      return std::min( static_cast<unsigned int>( value ), MAX_NUMBER_OF_RASTERIZE_THREADS );
+    }
+  }
+
+  const long numberOfCores = sysconf( _SC_NPROCESSORS_ONLN );
+  if( numberOfCores > 2 )
+  {
+    return std::min( static_cast<unsigned int>( numberOfCores - 1 ), DEFAULT_MAX_NUMBER_OF_RASTERIZE_THREADS );
+  }
+
+  return 1u;
+}
+
+/**
+ * Whether the rasterizers use the vectorised span compositing. Enabled unless the DALI_SVG_RASTERIZE_SIMD environment variable is set to 0.
+ */
+bool IsRasterizeSimdEnabled()
+{
+  const char* simd = Dali::EnvironmentVariable::GetEnvironmentVariable( DALI_SVG_RASTERIZE_SIMD );
+  return ( NULL == simd ) || ( 0 != std::strtol( simd, NULL, 10 ) );
+}
+
+} // unnamed namespace
+
 namespace Dali
 {
 
@@ -31,36 +80,87 @@ namespace Toolkit
 namespace Internal
 {
 
-RasterizingTask::RasterizingTask( SvgVisual* svgRenderer, NSVGimage* parsedSvg, unsigned int width, unsigned int height )
-: mSvgVisual( svgRenderer ),
-  mParsedSvg( parsedSvg ),
+RasterizingTask::RasterizingTask( SvgVisual* svgRenderer, SvgDocumentPtr document, unsigned int width, unsigned int height, Priority priority )
+: mSvgVisuals(),
+  mDocument( document ),
+  mNaturalSize(),
   mWidth( width ),
-  mHeight( height )
+  mHeight( height ),
+  mPriority( priority ),
+  mIsParsed( false )
 {
+  mSvgVisuals.PushBack( svgRenderer );
 }
 
-void RasterizingTask::Rasterize( NSVGrasterizer* rasterizer )
+const unsigned char* RasterizingTask::Rasterize( NSVGrasterizer* rasterizer, const ImageDiskCache* diskCache )
 {
-  if( mWidth > 0u && mHeight > 0u )
+  if( diskCache && mWidth > 0u && mHeight > 0u )
   {
-    float scaleX =  static_cast<float>( mWidth ) /  mParsedSvg->width;
-    float scaleY =  static_cast<float>( mHeight ) /  mParsedSvg->height;
+    // The stored pixels don't need the document to be parsed.
+    mPixelData = diskCache->Load( GetDiskCacheKey() );
+    if( mPixelData )
+    {
+      return NULL;
+    }
+  }
+
+  // Parses the document the first time it's rasterized.
+  NSVGimage* parsedSvg = mDocument->GetParsedImage();
+  mIsParsed = true;
+  if( parsedSvg )
+  {
+    mNaturalSize = Vector2( parsedSvg->width, parsedSvg->height );
+  }
+
+  if( parsedSvg && mWidth > 0u && mHeight > 0u )
+  {
+    float scaleX =  static_cast<float>( mWidth ) /  parsedSvg->width;
+    float scaleY =  static_cast<float>( mHeight ) /  parsedSvg->height;
     float scale = scaleX < scaleY ? scaleX : scaleY;
     unsigned int bufferStride = mWidth*Pixel::GetBytesPerPixel( Pixel::RGBA8888 );
     unsigned int bufferSize = bufferStride * mHeight;
 
     unsigned char* buffer = new unsigned char [bufferSize];
-    nsvgRasterize(rasterizer, mParsedSvg, 0.f,0.f,scale,
+    nsvgRasterize(rasterizer, parsedSvg, 0.f,0.f,scale,
         buffer, mWidth, mHeight,
         bufferStride );
 
     mPixelData = Dali::PixelData::New( buffer, bufferSize, mWidth, mHeight, Pixel::RGBA8888, Dali::PixelData::DELETE_ARRAY );
+    return buffer;
   }
+
+  return NULL;
+}
+
+ImageDiskCache::Key RasterizingTask::GetDiskCacheKey() const
+{
+  // The units of the svg file are converted to pixels with the dpi, so the pixels depend on it.
+  return ImageDiskCache::Key( GetUrl(), ImageDimensions( mWidth, mHeight ), FittingMode::DEFAULT, SamplingMode::DEFAULT, mDocument->GetDpi() );
+}
+
+const Vector<SvgVisual*>& RasterizingTask::GetSvgVisuals() const
+{
+  return mSvgVisuals;
 }
 
-SvgVisual* RasterizingTask::GetSvgVisual() const
+const std::string& RasterizingTask::GetUrl() const
 {
-  return mSvgVisual.Get();
+  return mDocument->GetUrl();
+}
+
+unsigned int RasterizingTask::GetWidth() const
+{
+  return mWidth;
+}
+
+unsigned int RasterizingTask::GetHeight() const
+{
+  return mHeight;
+}
+
+RasterizingTask::Priority RasterizingTask::GetPriority() const
+{
+  return mPriority;
 }
 
 PixelData RasterizingTask::GetPixelData() const
@@ -68,66 +168,148 @@ PixelData RasterizingTask::GetPixelData() const
   return mPixelData;
 }
 
-SvgRasterizeThread::SvgRasterizeThread( EventThreadCallback* trigger )
-: mTrigger( trigger ),
-  mIsThreadWaiting( false )
+bool RasterizingTask::GetNaturalSize( Vector2& naturalSize ) const
+{
+  naturalSize = mNaturalSize;
+  return mIsParsed;
+}
+
+SvgDocumentPtr RasterizingTask::GetDocument() const
+{
+  return mDocument;
+}
+
+void RasterizingTask::AddSvgVisual( SvgVisual* svgVisual )
+{
+  mSvgVisuals.PushBack( svgVisual );
+}
+
+void RasterizingTask::RemoveSvgVisual( SvgVisual* svgVisual )
+{
+  for( Vector<SvgVisual*>::Iterator it = mSvgVisuals.Begin(), endIt = mSvgVisuals.End(); it != endIt; ++it )
+  {
+    if( *it == svgVisual )
+    {
+      mSvgVisuals.Erase( it );
+      break;
+    }
+  }
+}
+
+bool RasterizingTask::IsCancelled() const
+{
+  return mSvgVisuals.Empty();
+}
+
+SvgRasterizeThread::SvgRasterizeThread( SvgRasterizeThreadPool& threadPool )
+: mThreadPool( threadPool )
 {
   mRasterizer = nsvgCreateRasterizer();
+  nsvgSetRasterizerSimd( mRasterizer, IsRasterizeSimdEnabled() );
 }
 
 SvgRasterizeThread::~SvgRasterizeThread()
 {
-
   nsvgDeleteRasterizer( mRasterizer );
-  delete mTrigger;
 }
 
-void SvgRasterizeThread::TerminateThread( SvgRasterizeThread*& thread )
+void SvgRasterizeThread::Run()
+{
+  const ImageDiskCache* diskCache = mThreadPool.mDiskCache.Get();
+  while( RasterizingTaskPtr task = mThreadPool.NextTaskToProcess() )
+  {
+    const unsigned char* pixels = task->Rasterize( mRasterizer, diskCache );
+    if( diskCache && pixels )
+    {
+      // The pixels are stored once the main thread has been woken up to apply them. The task is released when it's
+      // added to the completed queue, so the key and the pixel data owning the pixels are kept by the thread.
+      const ImageDiskCache::Key key = task->GetDiskCacheKey();
+      PixelData pixelData = task->GetPixelData();
+      mThreadPool.AddCompletedTask( task );
+
+      diskCache->Store( key, pixels, pixelData.GetWidth(), pixelData.GetHeight(), pixelData.GetPixelFormat() );
+    }
+    else
+    {
+      mThreadPool.AddCompletedTask( task );
+    }
+  }
+}
+
+SvgRasterizeThreadPool::SvgRasterizeThreadPool( EventThreadCallback* trigger )
+: mDiskCache( ImageDiskCache::Get() ),
+  mTrigger( trigger ),
+  mIsTerminating( false )
 {
-  if( thread )
+  const unsigned int numberOfThreads = GetNumberOfRasterizeThreads();
+  mThreads.reserve( numberOfThreads );
+  for( unsigned int index = 0u; index < numberOfThreads; ++index )
   {
-    // add an empty task would stop the thread from conditional wait.
-    thread->AddTask( RasterizingTaskPtr() );
-    // stop the thread
-    thread->Join();
-    // delete the thread
-    delete thread;
-    thread = NULL;
+    mThreads.push_back( new SvgRasterizeThread( *this ) );
   }
 }
 
-void SvgRasterizeThread::AddTask( RasterizingTaskPtr task )
+SvgRasterizeThreadPool::~SvgRasterizeThreadPool()
 {
-  bool wasEmpty = false;
+  for( std::vector< SvgRasterizeThread* >::iterator it = mThreads.begin(), endIt = mThreads.end(); it != endIt; ++it )
+  {
+    delete *it;
+  }
 
+  delete mTrigger;
+}
+
+void SvgRasterizeThreadPool::Start()
+{
+  for( std::vector< SvgRasterizeThread* >::iterator it = mThreads.begin(), endIt = mThreads.end(); it != endIt; ++it )
+  {
+    (*it)->Start();
+  }
+}
+
+void SvgRasterizeThreadPool::TerminateThreadPool( SvgRasterizeThreadPool*& threadPool )
+{
+  if( threadPool )
   {
-    // Lock while adding task to the queue
-    ConditionalWait::ScopedLock lock( mConditionalWait );
-    wasEmpty = mRasterizeTasks.empty();
-    if( !wasEmpty && task != NULL)
     {
-      // Remove the tasks with the same renderer.
-      // Older task which waiting to rasterize and apply the svg to the same renderer is expired.
-      for( std::vector< RasterizingTaskPtr >::iterator it = mRasterizeTasks.begin(), endIt = mRasterizeTasks.end(); it != endIt; ++it )
-      {
-        if( (*it) && (*it)->GetSvgVisual() == task->GetSvgVisual() )
-        {
-          mRasterizeTasks.erase( it );
-          break;
-        }
-      }
+      // the terminating flag stops the threads from conditional wait.
+      ConditionalWait::ScopedLock lock( threadPool->mConditionalWait );
+      threadPool->mIsTerminating = true;
     }
-    mRasterizeTasks.push_back( task );
+
+    // stop the threads. Notify once per thread in case each notification wakes up only one of them.
+    for( std::vector< SvgRasterizeThread* >::iterator it = threadPool->mThreads.begin(), endIt = threadPool->mThreads.end(); it != endIt; ++it )
+    {
+      threadPool->mConditionalWait.Notify();
+    }
+
+    for( std::vector< SvgRasterizeThread* >::iterator it = threadPool->mThreads.begin(), endIt = threadPool->mThreads.end(); it != endIt; ++it )
+    {
+      (*it)->Join();
+    }
+
+    // delete the thread pool
+    delete threadPool;
+    threadPool = NULL;
   }
+}
 
-  if( wasEmpty)
+void SvgRasterizeThreadPool::AddTask( RasterizingTaskPtr task )
+{
   {
-    // wake up the image loading thread
-    mConditionalWait.Notify();
+    // Lock while adding task to the queue
+    ConditionalWait::ScopedLock lock( mConditionalWait );
+
+    ReleaseCancelledTasks();
+
+    mRasterizeTasks[task->GetPriority()].push_back( task );
   }
+
+  // wake up a worker thread
+  mConditionalWait.Notify();
 }
 
-RasterizingTaskPtr SvgRasterizeThread::NextCompletedTask()
+RasterizingTaskPtr SvgRasterizeThreadPool::NextCompletedTask()
 {
   // Lock while popping task out from the queue
   Mutex::ScopedLock lock( mMutex );
@@ -137,95 +319,88 @@ RasterizingTaskPtr SvgRasterizeThread::NextCompletedTask()
     return RasterizingTaskPtr();
   }
 
-  std::vector< RasterizingTaskPtr >::iterator next = mCompletedTasks.begin();
-  RasterizingTaskPtr nextTask = *next;
-  mCompletedTasks.erase( next );
+  RasterizingTaskPtr nextTask = mCompletedTasks.front();
+  mCompletedTasks.pop_front();
 
   return nextTask;
 }
 
-void SvgRasterizeThread::RemoveTask( SvgVisual* visual )
+void SvgRasterizeThreadPool::AddVisualToTask( RasterizingTaskPtr task, SvgVisual* visual )
 {
-  // Lock while remove task from the queue
+  // Lock while adding the visual, so the worker threads can't check whether the task is cancelled at the same time.
   ConditionalWait::ScopedLock lock( mConditionalWait );
-  if( !mRasterizeTasks.empty() )
-  {
-    for( std::vector< RasterizingTaskPtr >::iterator it = mRasterizeTasks.begin(), endIt = mRasterizeTasks.end(); it != endIt; ++it )
-    {
-      if( (*it) &&  (*it)->GetSvgVisual() == visual )
-      {
-        mRasterizeTasks.erase( it );
-        break;
-      }
-    }
-  }
+
+  task->AddSvgVisual( visual );
 }
 
-void SvgRasterizeThread::DeleteImage( NSVGimage* parsedSvg )
+bool SvgRasterizeThreadPool::RemoveTask( RasterizingTaskPtr task, SvgVisual* visual )
 {
-  // Lock while adding image to the delete queue
+  // Lock while cancelling the task, so the worker threads can't pop it at the same time.
   ConditionalWait::ScopedLock lock( mConditionalWait );
 
-  if( mIsThreadWaiting ) // no rasterization is ongoing, save to delete
-  {
-    nsvgDelete( parsedSvg );
-  }
-  else // wait to delete until current rasterization completed.
-  {
-    mDeleteSvg.PushBack( parsedSvg );
-  }
+  // If there are no visuals left, the task is cancelled. It's left in the queue and skipped by the worker threads.
+  task->RemoveSvgVisual( visual );
+
+  ReleaseCancelledTasks();
+
+  return task->IsCancelled();
 }
 
-RasterizingTaskPtr SvgRasterizeThread::NextTaskToProcess()
+unsigned int SvgRasterizeThreadPool::GetNumberOfThreads() const
+{
+  return static_cast<unsigned int>( mThreads.size() );
+}
+
+RasterizingTaskPtr SvgRasterizeThreadPool::NextTaskToProcess()
 {
   // Lock while popping task out from the queue
   ConditionalWait::ScopedLock lock( mConditionalWait );
 
-  // Delete the image here to make sure that it is not used in the nsvgRasterize()
-  if( !mDeleteSvg.Empty() )
+  while( !mIsTerminating )
   {
-    for( Vector< NSVGimage* >::Iterator it = mDeleteSvg.Begin(), endIt = mDeleteSvg.End();
-        it != endIt;
-        ++it )
+    // pop out the next task from the queue with the highest priority
+    for( unsigned int priority = RasterizingTask::HIGH; priority <= RasterizingTask::NORMAL; ++priority )
     {
-      nsvgDelete( *it );
+      TaskQueue& queue = mRasterizeTasks[priority];
+      while( !queue.empty() )
+      {
+        RasterizingTaskPtr nextTask = queue.front();
+        queue.pop_front();
+
+        if( !nextTask->IsCancelled() )
+        {
+          return nextTask;
+        }
+
+        // The cancelled task is deleted in the main thread.
+        mCancelledTasks.push_back( nextTask );
+      }
     }
-    mDeleteSvg.Clear();
-  }
 
-  // conditional wait
-  while( mRasterizeTasks.empty() )
-  {
-    mIsThreadWaiting = true;
+    // conditional wait
     mConditionalWait.Wait( lock );
   }
-  mIsThreadWaiting = false;
 
-  // pop out the next task from the queue
-  std::vector< RasterizingTaskPtr >::iterator next = mRasterizeTasks.begin();
-  RasterizingTaskPtr nextTask = *next;
-  mRasterizeTasks.erase( next );
-
-  return nextTask;
+  return RasterizingTaskPtr();
 }
 
-void SvgRasterizeThread::AddCompletedTask( RasterizingTaskPtr task )
+void SvgRasterizeThreadPool::AddCompletedTask( RasterizingTaskPtr& task )
 {
   // Lock while adding task to the queue
   Mutex::ScopedLock lock( mMutex );
   mCompletedTasks.push_back( task );
 
+  // The main thread can't pop the task until the lock is released, so it keeps the last reference.
+  task.Reset();
+
   // wake up the main thread
   mTrigger->Trigger();
 }
 
-void SvgRasterizeThread::Run()
+void SvgRasterizeThreadPool::ReleaseCancelledTasks()
 {
-  while( RasterizingTaskPtr task = NextTaskToProcess() )
-  {
-    task->Rasterize( mRasterizer );
-    AddCompletedTask( task );
-  }
+  // Called with the queue locked.
+  mCancelledTasks.clear();
 }
 
 } // namespace Internal
@@ -18,18 +18,24 @@
  */
 
 // EXTERNAL INCLUDES
+#include <deque>
 #include <dali/devel-api/adaptor-framework/event-thread-callback.h>
 #include <dali/devel-api/threading/conditional-wait.h>
 #include <dali/devel-api/threading/mutex.h>
 #include <dali/devel-api/threading/thread.h>
+#include <dali/public-api/common/dali-vector.h>
 #include <dali/public-api/images/buffer-image.h>
 #include <dali/public-api/images/pixel-data.h>
+#include <dali/public-api/math/vector2.h>
 #include <dali/public-api/common/intrusive-ptr.h>
 #include <dali/public-api/common/vector-wrapper.h>
 #include <dali/public-api/object/ref-object.h>
 #include <dali/public-api/rendering/texture-set.h>
 
-struct NSVGimage;
+// INTERNAL INCLUDES
+#include <dali-toolkit/internal/image-atlas/image-disk-cache.h>
+#include <dali-toolkit/internal/visuals/svg/svg-document-cache.h>
+
 struct NSVGrasterizer;
 
 namespace Dali
@@ -42,44 +48,85 @@ namespace Internal
 {
 
 class SvgVisual;
-typedef IntrusivePtr< SvgVisual > SvgVisualPtr;
 class RasterizingTask;
 typedef IntrusivePtr< RasterizingTask > RasterizingTaskPtr;
 
 /**
- * The svg rasterizing tasks to be processed in the worker thread.
+ * The svg rasterizing tasks to be processed in the worker threads.
  *
  * Life cycle of a rasterizing task is as follows:
  * 1. Created by SvgVisual in the main thread
- * 2. Queued in the worked thread waiting to be processed.
- * 3. If this task gets its turn to do the rasterization, it triggers main thread to apply the rasterized image to material then been deleted in main thread call back
- *    Or if this task is been removed ( new image/size set to the visual or actor off stage) before its turn to be processed, it then been deleted in the worker thread.
+ * 2. Queued in the thread pool waiting to be processed.
+ * 3. If this task gets its turn, it parses the svg document if it's not parsed yet and does the rasterization.
+ *    A task with a zero size only parses the document, so the natural size of the visuals is known without parsing in the main thread.
+ *    Then it triggers main thread to apply the rasterized image to material then been deleted in main thread call back
+ *    Or if this task is been cancelled ( new image/size set to the visual or actor off stage), it's not applied and it's deleted in the main thread too.
  */
 class RasterizingTask : public RefObject
 {
 public:
+
+  /**
+   * The priority of the task.
+   */
+  enum Priority
+  {
+    HIGH,  ///< The visual has just been put on stage and it's not showing any image.
+    NORMAL ///< The visual is already showing an image. i.e. it's resized or its url has changed.
+  };
+
   /**
    * Constructor
    *
-   * @param[in] svgRenderer The renderer which the rasterized image to be applied.
-   * @param[in] parsedSvg The parsed svg for rasterizing.
-   *            Note, after the task is added to the worker thread, the worker thread takes over the ownership.
-   *            When the image is to be deleted, delete it in the worker thread by calling SvgRasterizeThread::DeleteImage( parsedSvg ).
-   * @param[in] width The rasterization width.
-   * @param[in] height The rasterization height.
+   * @param[in] svgRenderer The renderer which the rasterized image to be applied. Other visuals with the same url and size may share the task later.
+   *            The visuals must remove themselves from the task calling SvgRasterizeThreadPool::RemoveTask() before they are deleted.
+   * @param[in] document The svg document to be parsed and rasterized. It may be shared with other tasks and visuals.
+   * @param[in] width The rasterization width, zero to only parse the document.
+   * @param[in] height The rasterization height, zero to only parse the document.
+   * @param[in] priority The priority of the task.
    */
-  RasterizingTask( SvgVisual* svgRenderer, NSVGimage* parsedSvg, unsigned int width, unsigned int height );
+  RasterizingTask( SvgVisual* svgRenderer, SvgDocumentPtr document, unsigned int width, unsigned int height, Priority priority );
 
   /**
-   * Do the rasterization with the given rasterizer.
+   * Parse the svg document if it's not parsed yet and do the rasterization with the given rasterizer.
+   * If the disk cache has the pixels of the svg file at this size, they are loaded without parsing.
    *@param[in] rasterizer The rasterizer that rasterize the SVG to a buffer image
+   *@param[in] diskCache The disk cache of the rasterized pixels, or NULL if it's not enabled.
+   *@return The rasterized pixels owned by the pixel data, to be stored in the disk cache. NULL if they were loaded from the disk cache or not rasterized.
+   */
+  const unsigned char* Rasterize( NSVGrasterizer* rasterizer, const ImageDiskCache* diskCache );
+
+  /**
+   * Get the key of the rasterized pixels in the disk cache.
+   */
+  ImageDiskCache::Key GetDiskCacheKey() const;
+
+  /**
+   * Get the svg visuals which the rasterized image is applied to.
+   *
+   * @return The svg visuals. It's empty if the task has been cancelled.
+   */
+  const Vector<SvgVisual*>& GetSvgVisuals() const;
+
+  /**
+   * Get the url of the svg document.
+   */
+  const std::string& GetUrl() const;
+
+  /**
+   * Get the rasterization width.
+   */
+  unsigned int GetWidth() const;
+
+  /**
+   * Get the rasterization height.
    */
-  void Rasterize( NSVGrasterizer* rasterizer );
+  unsigned int GetHeight() const;
 
   /**
-   * Get the svg visual
+   * Get the priority of the task.
    */
-  SvgVisual* GetSvgVisual() const;
+  Priority GetPriority() const;
 
   /**
    * Get the rasterization result.
@@ -87,8 +134,43 @@ public:
    */
   PixelData GetPixelData() const;
 
+  /**
+   * Get the natural size of the svg image, if this task parsed the document.
+   *
+   * @param[out] naturalSize The natural size, zero if the svg file can't be parsed.
+   * @return Whether the document has been parsed by this task, i.e. it wasn't loaded from the disk cache.
+   */
+  bool GetNaturalSize( Vector2& naturalSize ) const;
+
+  /**
+   * Get the svg document.
+   */
+  SvgDocumentPtr GetDocument() const;
+
 private:
 
+  friend class SvgRasterizeThreadPool;
+
+  /**
+   * Add a visual which the rasterized image is applied to, called by the thread pool in the main thread with the queue locked.
+   *
+   * @param[in] svgVisual The svg visual.
+   */
+  void AddSvgVisual( SvgVisual* svgVisual );
+
+  /**
+   * Remove a visual, called by the thread pool in the main thread with the queue locked.
+   * The task is cancelled when there are no visuals left.
+   *
+   * @param[in] svgVisual The svg visual.
+   */
+  void RemoveSvgVisual( SvgVisual* svgVisual );
+
+  /**
+   * Whether the task has been cancelled.
+   */
+  bool IsCancelled() const;
+
   // Undefined
   RasterizingTask( const RasterizingTask& task );
 
@@ -96,19 +178,71 @@ private:
   RasterizingTask& operator=( const RasterizingTask& task );
 
 private:
-  SvgVisualPtr  mSvgVisual;
-  PixelData       mPixelData;
-  NSVGimage*      mParsedSvg;
-  unsigned int    mWidth;
-  unsigned int    mHeight;
+  Vector<SvgVisual*> mSvgVisuals;
+  PixelData          mPixelData;
+  SvgDocumentPtr     mDocument;
+  Vector2            mNaturalSize;
+  unsigned int       mWidth;
+  unsigned int       mHeight;
+  Priority           mPriority;
+  bool               mIsParsed;    ///< Whether the document has been parsed by this task.
 };
 
+class SvgRasterizeThreadPool;
 
 /**
- * The worker thread for SVG rasterization.
+ * A worker thread for SVG rasterization. Each thread has its own rasterizer.
  */
 class SvgRasterizeThread : public Thread
 {
+public:
+
+  /**
+   * Constructor.
+   *
+   * @param[in] threadPool The thread pool which provides the tasks.
+   */
+  SvgRasterizeThread( SvgRasterizeThreadPool& threadPool );
+
+  /**
+   * Destructor.
+   */
+  virtual ~SvgRasterizeThread();
+
+protected:
+
+  /**
+   * The entry function of the worker thread.
+   * It fetches task from the Queue, rasterizes the image and apply to the renderer.
+   */
+  virtual void Run();
+
+private:
+
+  // Undefined
+  SvgRasterizeThread( const SvgRasterizeThread& thread );
+
+  // Undefined
+  SvgRasterizeThread& operator=( const SvgRasterizeThread& thread );
+
+private:
+
+  SvgRasterizeThreadPool& mThreadPool;
+  NSVGrasterizer*         mRasterizer;
+};
+
+/**
+ * The pool of worker threads for SVG rasterization.
+ *
+ * The tasks are queued by priority. The visuals keep a reference to their task, so replacing or cancelling it doesn't need to traverse the queues.
+ * The cancelled tasks are skipped by the worker threads and deleted in the main thread.
+ *
+ * The number of worker threads is set with the DALI_SVG_RASTERIZE_THREADS environment variable. By default it depends on the number of cores.
+ * The vectorised span compositing of the rasterizers is disabled by setting the DALI_SVG_RASTERIZE_SIMD environment variable to 0.
+ * The rasterized pixels are kept in the image disk cache if it's enabled with the DALI_IMAGE_DISK_CACHE_DIR environment variable.
+ */
+class SvgRasterizeThreadPool
+{
 public:
 
   /**
@@ -116,15 +250,25 @@ public:
    *
    * @param[in] trigger The trigger to wake up the main thread.
    */
-  SvgRasterizeThread( EventThreadCallback* trigger );
+  SvgRasterizeThreadPool( EventThreadCallback* trigger );
+
+  /**
+   * Destructor.
+   */
+  ~SvgRasterizeThreadPool();
+
+  /**
+   * Start the worker threads.
+   */
+  void Start();
 
   /**
-   * Terminate the svg rasterize thread, join and delete.
+   * Terminate the worker threads, join them and delete the pool.
    */
-  static void TerminateThread( SvgRasterizeThread*& thread );
+  static void TerminateThreadPool( SvgRasterizeThreadPool*& threadPool );
 
   /**
-   * Add a rasterization task into the waiting queue, called by main thread.
+   * Add a rasterization task into the waiting queue of its priority, called by main thread.
    *
    * @param[in] task The task added to the queue.
    */
@@ -138,73 +282,83 @@ public:
   RasterizingTaskPtr NextCompletedTask();
 
   /**
-   * Remove the task with the given visual from the waiting queue, called by main thread.
+   * Add a visual to a task already added, called by main thread.
    *
-   * Typically called when the actor is put off stage, so the renderer is not needed anymore.
+   * Used to share one rasterization between visuals with the same url and size.
    *
-   * @param[in] visual The visual pointer.
+   * @param[in] task The task.
+   * @param[in] visual The visual which the rasterized image is applied to.
    */
-  void RemoveTask( SvgVisual* visual );
+  void AddVisualToTask( RasterizingTaskPtr task, SvgVisual* visual );
 
   /**
-   * Delete the parsed SVG image, called by main thread.
+   * Remove a visual from a task, called by main thread. The task is cancelled if there are no visuals left.
    *
-   * The parsed svg should be delelted in worker thread, as the main thread does not know whether a rasterization of this svg is ongoing.
+   * Typically called when a new task is added for the same visual or when the actor is put off stage, so the renderer is not needed anymore.
+   * If the task is being rasterized, the result is not applied to the visual.
    *
-   * @param[in] parsedImage The image to be deleted
+   * @param[in] task The task.
+   * @param[in] visual The visual.
+   *
+   * @return @e true if the task has been cancelled.
    */
-  void DeleteImage( NSVGimage* parsedSvg );
+  bool RemoveTask( RasterizingTaskPtr task, SvgVisual* visual );
+
+  /**
+   * Retrieves the number of worker threads.
+   */
+  unsigned int GetNumberOfThreads() const;
 
 private:
 
+  friend class SvgRasterizeThread;
+
   /**
-   * Pop the next task out from the queue.
+   * Pop the next task out from the queues, called by the worker threads.
    *
-   * @return The next task to be processed.
+   * The cancelled tasks are skipped.
+   *
+   * @return The next task to be processed or an empty pointer if the threads are terminated.
    */
   RasterizingTaskPtr NextTaskToProcess();
 
   /**
-   * Add a task in to the queue
+   * Add a task in to the completed queue, called by the worker threads.
    *
-   * @param[in] task The task added to the queue.
-   */
-  void AddCompletedTask( RasterizingTaskPtr task );
-
-protected:
-
-  /**
-   * Destructor.
+   * The reference of the worker thread to the task is released while the queue is locked,
+   * so the task and its svg document are always deleted in the main thread.
+   *
+   * @param[in,out] task The task added to the queue. It's reset.
    */
-  virtual ~SvgRasterizeThread();
-
+  void AddCompletedTask( RasterizingTaskPtr& task );
 
   /**
-   * The entry function of the worker thread.
-   * It fetches task from the Queue, rasterizes the image and apply to the renderer.
+   * Release the cancelled tasks skipped by the worker threads, called by main thread.
    */
-  virtual void Run();
-
-private:
+  void ReleaseCancelledTasks();
 
   // Undefined
-  SvgRasterizeThread( const SvgRasterizeThread& thread );
+  SvgRasterizeThreadPool( const SvgRasterizeThreadPool& threadPool );
 
   // Undefined
-  SvgRasterizeThread& operator=( const SvgRasterizeThread& thread );
+  SvgRasterizeThreadPool& operator=( const SvgRasterizeThreadPool& threadPool );
 
 private:
 
-  std::vector<RasterizingTaskPtr>  mRasterizeTasks;     //The queue of the tasks waiting to rasterize the SVG image
-  std::vector <RasterizingTaskPtr> mCompletedTasks;     //The queue of the tasks with the SVG rasterization completed
-  Vector<NSVGimage*>               mDeleteSvg;          //The images that the event thread requested to delete
+  typedef std::deque<RasterizingTaskPtr> TaskQueue;
+
+  TaskQueue                        mRasterizeTasks[RasterizingTask::NORMAL + 1]; //The queues of the tasks waiting to rasterize the SVG image, one per priority
+  std::vector<RasterizingTaskPtr>  mCancelledTasks;     //The cancelled tasks skipped by the worker threads, waiting to be deleted in main thread
+  TaskQueue                        mCompletedTasks;     //The queue of the tasks with the SVG rasterization completed
+
+  std::vector<SvgRasterizeThread*> mThreads;            //The worker threads
+  ImageDiskCachePtr                mDiskCache;          //The disk cache of the rasterized pixels. Empty if it's not enabled
 
   ConditionalWait            mConditionalWait;
   Dali::Mutex                mMutex;
   EventThreadCallback*       mTrigger;
 
-  NSVGrasterizer*            mRasterizer;
-  bool                       mIsThreadWaiting;
+  bool                       mIsTerminating;
 };
 
 } // namespace Internal
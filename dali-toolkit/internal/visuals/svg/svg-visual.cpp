@@ -19,11 +19,7 @@
 #include "svg-visual.h"
 
 // EXTERNAL INCLUDES
-#include <dali/public-api/images/buffer-image.h>
 #include <dali/public-api/common/stage.h>
-#include <dali/public-api/math/vector4.h>
-#include <dali/devel-api/images/atlas.h>
-#include <dali/devel-api/images/texture-set-image.h>
 #include <dali/integration-api/debug.h>
 
 // INTERNAL INCLUDES
@@ -36,13 +32,6 @@
 #include <dali-toolkit/internal/visuals/visual-base-data-impl.h>
 
 
-namespace
-{
-const char * const UNITS("px");
-
-const Dali::Vector4 FULL_TEXTURE_RECT(0.f, 0.f, 1.f, 1.f);
-}
-
 namespace Dali
 {
 
@@ -54,9 +43,12 @@ namespace Internal
 
 SvgVisual::SvgVisual( VisualFactoryCache& factoryCache, ImageAtlasManager& atlasManager )
 : Visual::Base( factoryCache ),
-  mAtlasRect( FULL_TEXTURE_RECT ),
   mAtlasManager( atlasManager ),
-  mParsedImage( NULL )
+  mDocument(),
+  mRasterizingTask(),
+  mParsingTask(),
+  mPlacementActor(),
+  mRasterizedImage()
 {
   // the rasterized image is with pre-multiplied alpha format
   mImpl->mFlags |= Impl::IS_PREMULTIPLIED_ALPHA;
@@ -64,10 +56,9 @@ SvgVisual::SvgVisual( VisualFactoryCache& factoryCache, ImageAtlasManager& atlas
 
 SvgVisual::~SvgVisual()
 {
-  if( mParsedImage )
-  {
-    nsvgDelete( mParsedImage );
-  }
+  // The tasks keep a pointer to the visual.
+  RemoveRasterizationTask();
+  RemoveParsingTask();
 }
 
 bool SvgVisual::IsSvgUrl( const std::string& url )
@@ -104,27 +95,33 @@ void SvgVisual::DoSetOnStage( Actor& actor )
   TextureSet textureSet = TextureSet::New();
   mImpl->mRenderer = Renderer::New( geometry, shader );
   mImpl->mRenderer.SetTextures( textureSet );
+  mPlacementActor = WeakHandle<Actor>( actor );
 
-  if( mImpl->mSize != Vector2::ZERO && mParsedImage )
+  if( mImpl->mSize != Vector2::ZERO && mDocument )
   {
-    AddRasterizationTask( mImpl->mSize );
+    // The visual is not showing any image yet.
+    AddRasterizationTask( mImpl->mSize, RasterizingTask::HIGH );
   }
 }
 
 void SvgVisual::DoSetOffStage( Actor& actor )
 {
-  mFactoryCache.GetSVGRasterizationThread()->RemoveTask( this );
+  RemoveRasterizationTask();
+
+  // The image stays in the rasterization cache until it's evicted.
+  mRasterizedImage.Reset();
 
   actor.RemoveRenderer( mImpl->mRenderer );
   mImpl->mRenderer.Reset();
+  mPlacementActor = WeakHandle<Actor>();
 }
 
 void SvgVisual::GetNaturalSize( Vector2& naturalSize ) const
 {
-  if( mParsedImage )
+  // The document is never parsed in the main thread. The natural size is zero until the worker thread has parsed it.
+  if( mDocument )
   {
-    naturalSize.x = mParsedImage->width;
-    naturalSize.y = mParsedImage->height;
+    naturalSize = mDocument->GetNaturalSize();
   }
   else
   {
@@ -134,9 +131,9 @@ void SvgVisual::GetNaturalSize( Vector2& naturalSize ) const
 
 void SvgVisual::SetSize( const Vector2& size )
 {
-  if(mImpl->mSize != size && mParsedImage && GetIsOnStage() )
+  if(mImpl->mSize != size && mDocument && GetIsOnStage() )
   {
-    AddRasterizationTask( size );
+    AddRasterizationTask( size, RasterizingTask::NORMAL );
   }
   mImpl->mSize = size;
 }
@@ -157,11 +154,15 @@ void SvgVisual::SetImage( const std::string& imageUrl, ImageDimensions size )
   {
     mImageUrl = imageUrl;
 
-    NSVGimage* parsedImageOld = mParsedImage;
+    // The pending tasks parse and rasterize the previous document.
+    RemoveRasterizationTask();
+    RemoveParsingTask();
 
+    // The document is parsed in the worker thread. The previous one is deleted when it's not used by any other visual or task.
     Vector2 dpi = Stage::GetCurrent().GetDpi();
     float meanDpi = (dpi.height + dpi.width) * 0.5f;
-    mParsedImage = nsvgParseFromFile(mImageUrl.c_str(), UNITS, meanDpi);
+    mDocument = mFactoryCache.GetSvgDocumentCache().GetDocument( mImageUrl, meanDpi );
+    AddParsingTask();
 
     if( size.GetWidth() != 0u && size.GetHeight() != 0u)
     {
@@ -171,74 +172,136 @@ void SvgVisual::SetImage( const std::string& imageUrl, ImageDimensions size )
 
     if( mImpl->mSize != Vector2::ZERO && GetIsOnStage() )
     {
-      AddRasterizationTask( mImpl->mSize );
+      AddRasterizationTask( mImpl->mSize, RasterizingTask::NORMAL );
     }
-
-    mFactoryCache.GetSVGRasterizationThread()->DeleteImage( parsedImageOld );
   }
 }
 
-void SvgVisual::AddRasterizationTask( const Vector2& size )
+void SvgVisual::AddRasterizationTask( const Vector2& size, RasterizingTask::Priority priority )
 {
-  if( mImpl->mRenderer && mParsedImage )
+  unsigned int width = static_cast<unsigned int>(size.width);
+  unsigned int height = static_cast<unsigned int>( size.height );
+
+  // A zero size is only used by the parsing tasks.
+  if( mImpl->mRenderer && mDocument && width > 0u && height > 0u )
   {
-    unsigned int width = static_cast<unsigned int>(size.width);
-    unsigned int height = static_cast<unsigned int>( size.height );
-    BufferImage image = BufferImage::New( width, height, Pixel::RGBA8888);
+    // Older task which waiting to rasterize and apply the svg to this visual is expired.
+    RemoveRasterizationTask();
 
-    RasterizingTaskPtr newTask = new RasterizingTask( this, mParsedImage, width, height );
-    mFactoryCache.GetSVGRasterizationThread()->AddTask( newTask );
+    SvgRasterizationCache& cache = mFactoryCache.GetSvgRasterizationCache();
+
+    // The image may have been rasterized already for another visual.
+    SvgRasterizedImagePtr image = cache.GetImage( mImageUrl, width, height );
+    if( image )
+    {
+      SetRasterizedImage( image );
+      return;
+    }
+
+    // Or it may be being rasterized for another visual.
+    mRasterizingTask = cache.GetTask( mImageUrl, width, height );
+    if( mRasterizingTask )
+    {
+      mFactoryCache.GetSVGRasterizationThreadPool()->AddVisualToTask( mRasterizingTask, this );
+    }
+    else
+    {
+      mRasterizingTask = new RasterizingTask( this, mDocument, width, height, priority );
+      cache.AddTask( mRasterizingTask );
+      mFactoryCache.GetSVGRasterizationThreadPool()->AddTask( mRasterizingTask );
+    }
+  }
+}
+
+void SvgVisual::RemoveRasterizationTask()
+{
+  if( mRasterizingTask )
+  {
+    if( mFactoryCache.GetSVGRasterizationThreadPool()->RemoveTask( mRasterizingTask, this ) )
+    {
+      // No other visual is waiting for the task.
+      mFactoryCache.GetSvgRasterizationCache().RemoveTask( mRasterizingTask );
+    }
+    mRasterizingTask.Reset();
   }
 }
 
-void SvgVisual::ApplyRasterizedImage( PixelData rasterizedPixelData )
+void SvgVisual::AddParsingTask()
 {
-  if( GetIsOnStage()  )
+  if( mDocument && !mDocument->HasNaturalSize() )
   {
-    TextureSet currentTextureSet = mImpl->mRenderer.GetTextures();
-    if( mAtlasRect != FULL_TEXTURE_RECT )
+    // The document may be being parsed for another visual.
+    SvgRasterizationCache& cache = mFactoryCache.GetSvgRasterizationCache();
+    mParsingTask = cache.GetTask( mImageUrl, 0u, 0u );
+    if( mParsingTask )
+    {
+      mFactoryCache.GetSVGRasterizationThreadPool()->AddVisualToTask( mParsingTask, this );
+    }
+    else
     {
-      mAtlasManager.Remove( currentTextureSet, mAtlasRect );
+      // The layout waits for the natural size.
+      mParsingTask = new RasterizingTask( this, mDocument, 0u, 0u, RasterizingTask::HIGH );
+      cache.AddTask( mParsingTask );
+      mFactoryCache.GetSVGRasterizationThreadPool()->AddTask( mParsingTask );
     }
+  }
+}
 
-    Vector4 atlasRect;
-    TextureSet textureSet = mAtlasManager.Add(atlasRect, rasterizedPixelData );
-    if( textureSet ) // atlasing
+void SvgVisual::RemoveParsingTask()
+{
+  if( mParsingTask )
+  {
+    if( mFactoryCache.GetSVGRasterizationThreadPool()->RemoveTask( mParsingTask, this ) )
     {
-      if( textureSet != currentTextureSet )
-      {
-        mImpl->mRenderer.SetTextures( textureSet );
-      }
-      mImpl->mRenderer.RegisterProperty( ATLAS_RECT_UNIFORM_NAME, atlasRect );
-      mAtlasRect = atlasRect;
+      // No other visual is waiting for the task.
+      mFactoryCache.GetSvgRasterizationCache().RemoveTask( mParsingTask );
     }
-    else // no atlasing
+    mParsingTask.Reset();
+  }
+}
+
+void SvgVisual::ApplyRasterizedImage( const RasterizingTask& task )
+{
+  if( &task == mParsingTask.Get() )
+  {
+    // The natural size has been set to the document. The control showing the visual lays it out again.
+    mParsingTask.Reset();
+    NaturalSizeChanged();
+    return;
+  }
+
+  // The task has completed.
+  mRasterizingTask.Reset();
+
+  // The pixel data is empty if the svg file couldn't be parsed.
+  PixelData rasterizedPixelData = task.GetPixelData();
+  if( GetIsOnStage() && rasterizedPixelData )
+  {
+    // The first visual of the task adds the image to the cache. The others share it.
+    SvgRasterizationCache& cache = mFactoryCache.GetSvgRasterizationCache();
+    SvgRasterizedImagePtr image = cache.GetImage( task.GetUrl(), task.GetWidth(), task.GetHeight() );
+    if( !image )
     {
-      Atlas texture = Atlas::New( rasterizedPixelData.GetWidth(), rasterizedPixelData.GetHeight() );
-      texture.Upload( rasterizedPixelData, 0, 0 );
-
-      if( mAtlasRect == FULL_TEXTURE_RECT )
-      {
-        textureSet = currentTextureSet;
-      }
-      else
-      {
-        textureSet = TextureSet::New();
-        mImpl->mRenderer.SetTextures( textureSet );
-
-        mImpl->mRenderer.RegisterProperty( ATLAS_RECT_UNIFORM_NAME, FULL_TEXTURE_RECT );
-        mAtlasRect = FULL_TEXTURE_RECT;
-      }
-
-      if( textureSet )
-      {
-        TextureSetImage( textureSet, 0u, texture );
-      }
+      image = new SvgRasterizedImage( mAtlasManager, rasterizedPixelData );
+      cache.AddImage( task.GetUrl(), task.GetWidth(), task.GetHeight(), image );
     }
+
+    SetRasterizedImage( image );
   }
 }
 
+void SvgVisual::SetRasterizedImage( SvgRasterizedImagePtr image )
+{
+  TextureSet textureSet = image->GetTextureSet();
+  if( textureSet != mImpl->mRenderer.GetTextures() )
+  {
+    mImpl->mRenderer.SetTextures( textureSet );
+  }
+  mImpl->mRenderer.RegisterProperty( ATLAS_RECT_UNIFORM_NAME, image->GetAtlasRect() );
 
+  // Its atlas area is freed when the previous image is not used by the cache or any other visual.
+  mRasterizedImage = image;
+}
 
 } // namespace Internal
 
@@ -18,11 +18,15 @@
  *
  */
 
+// EXTERNAL INCLUDES
+#include <dali/devel-api/object/weak-handle.h>
+
 // INTERNAL INCLUDES
 #include <dali-toolkit/internal/visuals/visual-base-impl.h>
 #include <dali-toolkit/internal/visuals/image-atlas-manager.h>
-
-struct NSVGimage;
+#include <dali-toolkit/internal/visuals/svg/svg-document-cache.h>
+#include <dali-toolkit/internal/visuals/svg/svg-rasterization-cache.h>
+#include <dali-toolkit/internal/visuals/svg/svg-rasterize-thread.h>
 
 namespace Dali
 {
@@ -105,8 +109,9 @@ public:
 
   /**
    * @brief Sets the svg image of this visual to the resource at imageUrl
-   * The visual will parse the svg image once it is set.
-   * And rasterize it into BufferImage synchronously when the associated actor is put on stage, and destroy the BufferImage when it is off stage
+   * The svg document is shared with the other visuals with the same url. It's parsed in the worker thread straight away,
+   * the natural size is zero until the parsing has completed.
+   * And rasterize it into BufferImage asynchronously when the associated actor is put on stage, and destroy the BufferImage when it is off stage
    *
    * @param[in] imageUrl The URL to svg resource to use
    */
@@ -115,17 +120,51 @@ public:
   /**
    * @bried Apply the rasterized image to the visual.
    *
-   * @param[in] rasterizedPixelData The pixel buffer with the rasterized pixels
+   * The image is shared through the rasterization cache with the other visuals with the same url and size.
+   * If the task only parsed the document, the relayout of the image view is requested as its natural size is known now.
+   *
+   * @param[in] task The completed task with the rasterized pixels
    */
-  void ApplyRasterizedImage( PixelData rasterizedPixelData );
+  void ApplyRasterizedImage( const RasterizingTask& task );
 
 private:
   /**
    * @bried Rasterize the svg with the given size, and add it to the visual.
    *
+   * The previous task of the visual is cancelled if it hasn't completed yet.
+   *
    * @param[in] size The target size of the SVG rasterization.
+   * @param[in] priority The priority of the rasterization.
+   */
+  void AddRasterizationTask( const Vector2& size, RasterizingTask::Priority priority );
+
+  /**
+   * @brief Cancel the rasterization task of the visual if it hasn't completed yet.
+   *
+   * The task is only cancelled if no other visual is waiting for it.
+   */
+  void RemoveRasterizationTask();
+
+  /**
+   * @brief Parse the svg document in the worker thread, unless its natural size is known already.
+   *
+   * The task is shared with the other visuals with the same url.
+   */
+  void AddParsingTask();
+
+  /**
+   * @brief Cancel the parsing task of the visual if it hasn't completed yet.
+   *
+   * The task is only cancelled if no other visual is waiting for it.
+   */
+  void RemoveParsingTask();
+
+  /**
+   * @brief Set the textures of the renderer to show the rasterized image.
+   *
+   * @param[in] image The rasterized image.
    */
-  void AddRasterizationTask( const Vector2& size );
+  void SetRasterizedImage( SvgRasterizedImagePtr image );
 
 
   // Undefined
@@ -135,10 +174,13 @@ private:
   SvgVisual& operator=( const SvgVisual& svgRenderer );
 
 private:
-  Vector4              mAtlasRect;
-  ImageAtlasManager&   mAtlasManager;
-  std::string          mImageUrl;
-  NSVGimage*           mParsedImage;
+  ImageAtlasManager&    mAtlasManager;
+  std::string           mImageUrl;
+  SvgDocumentPtr        mDocument;
+  RasterizingTaskPtr    mRasterizingTask;   ///< The task waiting for or doing the rasterization.
+  RasterizingTaskPtr    mParsingTask;       ///< The task waiting for or doing the parsing, to know the natural size.
+  WeakHandle<Actor>     mPlacementActor;    ///< The actor the visual is on stage with, requested to relayout when the natural size is known.
+  SvgRasterizedImagePtr mRasterizedImage;   ///< The image shown by the visual. It may be shared with other visuals.
 
 };
 
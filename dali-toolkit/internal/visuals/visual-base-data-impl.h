@@ -63,6 +63,8 @@ struct Base::Impl
 
   CustomShader* mCustomShader;
 
+  Toolkit::Visual::Base::NaturalSizeChangedSignalType mNaturalSizeChangedSignal;
+
   Vector2   mSize;
   Vector2   mOffset;
   float     mDepthIndex;
@@ -177,6 +177,11 @@ void Base::CreatePropertyMap( Property::Map& map ) const
   }
 }
 
+Toolkit::Visual::Base::NaturalSizeChangedSignalType& Base::NaturalSizeChangedSignal()
+{
+  return mImpl->mNaturalSizeChangedSignal;
+}
+
 bool Base::GetIsOnStage() const
 {
   return mImpl->mFlags & Impl::IS_ON_STAGE;
@@ -187,6 +192,15 @@ bool Base::GetIsFromCache() const
   return mImpl->mFlags & Impl::IS_FROM_CACHE;
 }
 
+void Base::NaturalSizeChanged()
+{
+  if( !mImpl->mNaturalSizeChangedSignal.Empty() )
+  {
+    Toolkit::Visual::Base handle( this );
+    mImpl->mNaturalSizeChangedSignal.Emit( handle );
+  }
+}
+
 } // namespace Visual
 
 } // namespace Internal
@@ -154,6 +154,11 @@ public:
    */
   void SetCustomShader( const Property::Map& propertyMap );
 
+  /**
+   * @copydoc Toolkit::Visual::Base::NaturalSizeChangedSignal
+   */
+  Toolkit::Visual::Base::NaturalSizeChangedSignalType& NaturalSizeChangedSignal();
+
 protected:
 
   /**
@@ -215,6 +220,13 @@ protected:
    */
   bool GetIsFromCache() const;
 
+  /**
+   * @brief Emits the natural size changed signal.
+   *
+   * Called by the visuals which only know their natural size once their resource is loaded.
+   */
+  void NaturalSizeChanged();
+
 private:
 
   // Undefined
@@ -18,6 +18,7 @@
 #include "visual-factory-cache.h"
 
 // EXTERNAL HEADER
+#include <algorithm>
 #include <dali/devel-api/common/hash.h>
 
 // INTERNAL HEADER
@@ -33,14 +34,25 @@ namespace Toolkit
 namespace Internal
 {
 
+namespace
+{
+const std::size_t MIN_RENDERER_SWEEP_THRESHOLD = 64u; ///< The number of cached renderers before the first sweep.
+}
+
 VisualFactoryCache::VisualFactoryCache()
-: mSvgRasterizeThread( NULL )
+: mRenderers(),
+  mRendererStatistics(),
+  mRendererSweepThreshold( MIN_RENDERER_SWEEP_THRESHOLD ),
+  mSvgDocumentCache(),
+  mSvgRasterizationCache(),
+  mSvgRasterizeThreadPool( NULL ),
+  mImageDimensionsCache( ImageDimensionsCache::Get() )
 {
 }
 
 VisualFactoryCache::~VisualFactoryCache()
 {
-  SvgRasterizeThread::TerminateThread( mSvgRasterizeThread );
+  SvgRasterizeThreadPool::TerminateThreadPool( mSvgRasterizeThreadPool );
 }
 
 Geometry VisualFactoryCache::GetGeometry( GeometryType type )
@@ -63,84 +75,126 @@ void VisualFactoryCache::SaveShader( ShaderType type, Shader shader )
   mShader[type] = shader;
 }
 
-int VisualFactoryCache::FindRenderer( const std::string& key ) const
+VisualFactoryCache::RendererKey::RendererKey()
+: url(),
+  size(),
+  fittingMode( FittingMode::DEFAULT ),
+  samplingMode( SamplingMode::DEFAULT ),
+  hash( 0u )
+{
+}
+
+VisualFactoryCache::RendererKey::RendererKey( const std::string& url, ImageDimensions size, FittingMode::Type fittingMode, SamplingMode::Type samplingMode )
+: url( url ),
+  size( size ),
+  fittingMode( fittingMode ),
+  samplingMode( samplingMode ),
+  hash( Dali::CalculateHash( url ) )
+{
+  // Combine the load parameters with the hash of the url.
+  hash = hash * 33 + size.GetWidth();
+  hash = hash * 33 + size.GetHeight();
+  hash = hash * 33 + static_cast<std::size_t>( fittingMode );
+  hash = hash * 33 + static_cast<std::size_t>( samplingMode );
+}
+
+bool VisualFactoryCache::RendererKey::operator==( const RendererKey& rhs ) const
 {
-  int hash = Dali::CalculateHash( key );
+  return ( hash == rhs.hash ) &&
+         ( size == rhs.size ) &&
+         ( fittingMode == rhs.fittingMode ) &&
+         ( samplingMode == rhs.samplingMode ) &&
+         ( url == rhs.url );
+}
 
-  HashVector::Iterator startIt = mRendererHashes.Begin();
-  HashVector::Iterator it;
+VisualFactoryCache::RendererCacheStatistics::RendererCacheStatistics()
+: hits( 0u ),
+  misses( 0u ),
+  sweptEntries( 0u ),
+  numberOfEntries( 0u )
+{
+}
 
-  for(;;)
+Renderer VisualFactoryCache::GetRenderer( const RendererKey& key )
+{
+  std::pair< CachedRenderers::iterator, CachedRenderers::iterator > range = mRenderers.equal_range( key.hash );
+  for( CachedRenderers::iterator it = range.first; it != range.second; ++it )
   {
-    it = std::find( startIt, mRendererHashes.End(), hash );
-    if( it != mRendererHashes.End() )
+    if( it->second.mKey == key )
     {
-      int index = it - mRendererHashes.Begin();
-      const CachedRenderer* cachedRenderer = mRenderers[ index ];
-
-      if( cachedRenderer && cachedRenderer->mKey == key )
+      Renderer renderer = it->second.mRenderer.GetHandle();
+      if( renderer )
       {
-        return index;
+        ++mRendererStatistics.hits;
+        return renderer;
       }
     }
-    else
-    {
-      break;
-    }
-    startIt = it + 1;
   }
 
-  return -1;
+  ++mRendererStatistics.misses;
+  return Renderer();
 }
 
-Renderer VisualFactoryCache::GetRenderer( const std::string& key ) const
+void VisualFactoryCache::SaveRenderer( const RendererKey& key, Renderer& renderer )
 {
-  int index = FindRenderer( key );
-  if( index != -1 )
+  // Reuse the entry of the key if its renderer has been deleted.
+  std::pair< CachedRenderers::iterator, CachedRenderers::iterator > range = mRenderers.equal_range( key.hash );
+  for( CachedRenderers::iterator it = range.first; it != range.second; ++it )
   {
-    return mRenderers[ index ]->mRenderer.GetHandle();
+    if( ( it->second.mKey == key ) && !it->second.mRenderer.GetHandle() )
+    {
+      it->second.mRenderer = WeakHandle< Renderer >( renderer );
+      return;
+    }
   }
-  else
+
+  mRenderers.insert( CachedRenderers::value_type( key.hash, CachedRenderer( key, renderer ) ) );
+
+  // The renderers of the visuals deleted without cleaning the cache leave dead entries behind.
+  if( mRenderers.size() >= mRendererSweepThreshold )
   {
-    return Renderer();
+    SweepRenderers();
   }
 }
 
-void VisualFactoryCache::SaveRenderer( const std::string& key, Renderer& renderer )
+bool VisualFactoryCache::CleanRendererCache( const RendererKey& key )
 {
-  int hash = Dali::CalculateHash( key );
-  const CachedRenderer* cachedRenderer = new CachedRenderer( key, renderer );
-
-  CachedRenderers::Iterator it = std::find( mRenderers.Begin(), mRenderers.End(), static_cast< CachedRenderer* >( NULL ) );
-  if( it != mRenderers.End() )
-  {
-    *it = cachedRenderer;
-    int index = it - mRenderers.Begin();
-    mRendererHashes[ index ] = hash;
-  }
-  else
+  std::pair< CachedRenderers::iterator, CachedRenderers::iterator > range = mRenderers.equal_range( key.hash );
+  for( CachedRenderers::iterator it = range.first; it != range.second; ++it )
   {
-    mRendererHashes.PushBack( hash );
-    mRenderers.PushBack( cachedRenderer );
+    if( ( it->second.mKey == key ) && !it->second.mRenderer.GetHandle() )
+    {
+      mRenderers.erase( it );
+      return true;
+    }
   }
+  return false;
+}
+
+VisualFactoryCache::RendererCacheStatistics VisualFactoryCache::GetRendererCacheStatistics() const
+{
+  RendererCacheStatistics statistics( mRendererStatistics );
+  statistics.numberOfEntries = static_cast<unsigned int>( mRenderers.size() );
+  return statistics;
 }
 
-bool VisualFactoryCache::CleanRendererCache( const std::string& key )
+void VisualFactoryCache::SweepRenderers()
 {
-  int index = FindRenderer( key );
-  if( index != -1 )
+  for( CachedRenderers::iterator it = mRenderers.begin(); it != mRenderers.end(); )
   {
-    const CachedRenderer*& cachedRenderer = mRenderers[ index ];
-    if( !cachedRenderer->mRenderer.GetHandle() )
+    if( !it->second.mRenderer.GetHandle() )
     {
-      mRendererHashes[ index ] = Dali::INITIAL_HASH_VALUE;
-
-      delete cachedRenderer;
-      cachedRenderer = NULL;
-      return true;
+      mRenderers.erase( it++ );
+      ++mRendererStatistics.sweptEntries;
+    }
+    else
+    {
+      ++it;
     }
   }
-  return false;
+
+  // Sweep again when the number of entries doubles, so the sweeping cost is amortised over the insertions.
+  mRendererSweepThreshold = std::max( MIN_RENDERER_SWEEP_THRESHOLD, mRenderers.size() * 2u );
 }
 
 void VisualFactoryCache::CacheDebugRenderer( Renderer& renderer )
@@ -179,21 +233,51 @@ Geometry VisualFactoryCache::CreateQuadGeometry()
   return geometry;
 }
 
-SvgRasterizeThread* VisualFactoryCache::GetSVGRasterizationThread()
+SvgRasterizeThreadPool* VisualFactoryCache::GetSVGRasterizationThreadPool()
 {
-  if( !mSvgRasterizeThread )
+  if( !mSvgRasterizeThreadPool )
   {
-    mSvgRasterizeThread = new SvgRasterizeThread( new EventThreadCallback( MakeCallback( this, &VisualFactoryCache::ApplyRasterizedSVGToSampler ) ) );
-    mSvgRasterizeThread->Start();
+    mSvgRasterizeThreadPool = new SvgRasterizeThreadPool( new EventThreadCallback( MakeCallback( this, &VisualFactoryCache::ApplyRasterizedSVGToSampler ) ) );
+    mSvgRasterizeThreadPool->Start();
   }
-  return mSvgRasterizeThread;
+  return mSvgRasterizeThreadPool;
+}
+
+SvgDocumentCache& VisualFactoryCache::GetSvgDocumentCache()
+{
+  return mSvgDocumentCache;
+}
+
+SvgRasterizationCache& VisualFactoryCache::GetSvgRasterizationCache()
+{
+  return mSvgRasterizationCache;
+}
+
+ImageDimensionsCache& VisualFactoryCache::GetImageDimensionsCache()
+{
+  return *mImageDimensionsCache;
 }
 
 void VisualFactoryCache::ApplyRasterizedSVGToSampler()
 {
-  while( RasterizingTaskPtr task = mSvgRasterizeThread->NextCompletedTask() )
+  while( RasterizingTaskPtr task = mSvgRasterizeThreadPool->NextCompletedTask() )
   {
-    task->GetSvgVisual()->ApplyRasterizedImage( task->GetPixelData() );
+    // The visuals requesting the same url and size add new tasks from now on.
+    mSvgRasterizationCache.RemoveTask( task );
+
+    // The natural size is only set in the main thread, so the visuals don't need to lock the document.
+    Vector2 naturalSize;
+    if( task->GetNaturalSize( naturalSize ) )
+    {
+      task->GetDocument()->SetNaturalSize( naturalSize );
+    }
+
+    // There are no visuals if the task has been cancelled while it was rasterized.
+    const Vector<SvgVisual*>& visuals = task->GetSvgVisuals();
+    for( Vector<SvgVisual*>::ConstIterator it = visuals.Begin(), endIt = visuals.End(); it != endIt; ++it )
+    {
+      (*it)->ApplyRasterizedImage( *task );
+    }
   }
 }
 
@@ -18,15 +18,20 @@
  */
 
 // INTERNAL INCLUDES
+#include "svg/svg-document-cache.h"
+#include "svg/svg-rasterization-cache.h"
 #include "svg/svg-rasterize-thread.h"
+#include <dali-toolkit/internal/image-atlas/image-dimensions-cache.h>
 
 // EXTERNAL INCLUDES
+#include <map>
+#include <string>
+#include <dali/public-api/images/image-operations.h>
 #include <dali/public-api/math/uint-16-pair.h>
 #include <dali/public-api/object/ref-object.h>
 #include <dali/public-api/rendering/geometry.h>
 #include <dali/public-api/rendering/renderer.h>
 #include <dali/public-api/rendering/shader.h>
-#include <dali/devel-api/common/owner-container.h>
 #include <dali/devel-api/object/weak-handle.h>
 
 
@@ -125,22 +130,62 @@ public:
 public:
 
   /**
-   * @brief Request renderer from the url
+   * The key of the cached renderers: the url and the parameters the image is loaded with.
+   */
+  struct RendererKey
+  {
+    /**
+     * Default constructor. The key of an empty url.
+     */
+    RendererKey();
+
+    /**
+     * Constructor. Calculates the hash of the key.
+     */
+    RendererKey( const std::string& url, ImageDimensions size, FittingMode::Type fittingMode, SamplingMode::Type samplingMode );
+
+    bool operator==( const RendererKey& rhs ) const;
+
+    std::string        url;
+    ImageDimensions    size;
+    FittingMode::Type  fittingMode;
+    SamplingMode::Type samplingMode;
+    std::size_t        hash;
+  };
+
+  /**
+   * The usage of the renderer cache.
+   */
+  struct RendererCacheStatistics
+  {
+    RendererCacheStatistics();
+
+    unsigned int hits;            ///< The number of renderers found in the cache.
+    unsigned int misses;          ///< The number of renderers not found in the cache.
+    unsigned int sweptEntries;    ///< The number of entries removed because their renderer had been deleted.
+    unsigned int numberOfEntries; ///< The number of entries in the cache, including the ones not swept yet.
+  };
+
+  /**
+   * @brief Request renderer from the url and load parameters
+   *
+   * @param[in] key The key used for caching
    *
    * @return The cached renderer if exist in the cache. Otherwise an empty handle is returned.
    */
-  Renderer GetRenderer( const std::string& key ) const;
+  Renderer GetRenderer( const RendererKey& key );
 
   /**
    * @brief Cache the renderer based on the given key.
    *
-   * If the key already exists in the cache, then the cache will save an additional renderer to the cache.
-   * RemoveRenderer will then need to be called twice to remove both items from the cache.
+   * The cache only keeps a weak handle of the renderer. If the key already exists in the cache with a
+   * renderer still in use, then the cache will save an additional renderer to the cache.
+   * CleanRendererCache will then need to be called twice to remove both items from the cache.
    *
    * @param[in] key The key to use for caching
    * @param[in] renderer The Renderer to be cached
    */
-  void SaveRenderer( const std::string& key, Renderer& renderer );
+  void SaveRenderer( const RendererKey& key, Renderer& renderer );
 
   /**
    * @brief Cleans the renderer cache by removing the renderer from the cache based on the given key if there are no longer any references to it
@@ -149,7 +194,12 @@ public:
    *
    * @return True if the renderer is no longer used anywhere, false otherwise
    */
-  bool CleanRendererCache( const std::string& key );
+  bool CleanRendererCache( const RendererKey& key );
+
+  /**
+   * @brief Retrieves the usage of the renderer cache.
+   */
+  RendererCacheStatistics GetRendererCacheStatistics() const;
 
   /**
    * @brief Cache the debug renderer
@@ -162,12 +212,30 @@ public:
   Renderer GetDebugRenderer();
 
   /**
-   * Get the SVG rasterization thread.
-   * @return A pointer pointing to the SVG rasterization thread.
+   * Get the SVG rasterization thread pool.
+   * @return A pointer pointing to the SVG rasterization thread pool.
+   */
+  SvgRasterizeThreadPool* GetSVGRasterizationThreadPool();
+
+  /**
+   * Get the cache of the svg documents shared by the svg visuals.
+   * @return A reference to the svg document cache.
+   */
+  SvgDocumentCache& GetSvgDocumentCache();
+
+  /**
+   * Get the cache of the rasterized svg images and the pending rasterization tasks shared by the svg visuals.
+   * @return A reference to the svg rasterization cache.
+   */
+  SvgRasterizationCache& GetSvgRasterizationCache();
+
+  /**
+   * Get the cache of the image dimensions shared by the visuals and the atlases.
+   * @return A reference to the image dimensions cache.
    */
-  SvgRasterizeThread* GetSVGRasterizationThread();
+  ImageDimensionsCache& GetImageDimensionsCache();
 
-private: // for svg rasterization thread
+private: // for svg rasterization thread pool
 
   /**
    * Applies the rasterized image to material
@@ -192,37 +260,40 @@ protected:
   VisualFactoryCache& operator=(const VisualFactoryCache& rhs);
 
 private:
+
   struct CachedRenderer
   {
-    std::string mKey;
+    RendererKey mKey;
     WeakHandle< Renderer > mRenderer;
 
-    CachedRenderer( const std::string& key, Renderer& renderer )
+    CachedRenderer( const RendererKey& key, Renderer& renderer )
     : mKey( key ),
       mRenderer( renderer)
     {}
   };
 
-  typedef Dali::Vector< std::size_t > HashVector;
-  typedef Dali::OwnerContainer< const CachedRenderer* > CachedRenderers;
+  typedef std::multimap< std::size_t, CachedRenderer > CachedRenderers;
 
   /**
-   * @brief Finds the first index into the cached visuals from the url
-   *
-   * @return Returns the first index into the cached renderer from the url if it exists in the cache, otherwise returns -1
+   * @brief Removes the entries whose renderer has been deleted.
    */
-  int FindRenderer( const std::string& key ) const;
+  void SweepRenderers();
 
 private:
   Geometry mGeometry[GEOMETRY_TYPE_MAX+1];
   Shader mShader[SHADER_TYPE_MAX+1];
 
-  HashVector mRendererHashes;
-  CachedRenderers mRenderers;
+  CachedRenderers mRenderers;               ///< The weak handles of the cached renderers, indexed by the hash of their key.
+  RendererCacheStatistics mRendererStatistics;
+  std::size_t mRendererSweepThreshold;      ///< The dead entries are swept when the number of entries reaches it.
 
   Renderer mDebugRenderer;
 
-  SvgRasterizeThread*  mSvgRasterizeThread;
+  SvgDocumentCache        mSvgDocumentCache;
+  SvgRasterizationCache   mSvgRasterizationCache;
+  SvgRasterizeThreadPool* mSvgRasterizeThreadPool;
+
+  ImageDimensionsCachePtr mImageDimensionsCache;
 };
 
 } // namespace Internal
@@ -60,6 +60,7 @@ class TextLabel;
  * | Property::AUTO_SCROLL_GAP        | autoScrollGap       |  INTEGER     | O      | X        |
  * | Property::SHADOW                 | shadow              |  STRING      | O      | X        |
  * | Property::UNDERLINE              | underline           |  STRING      | O      | X        |
+ * | Property::ASYNC_LAYOUT           | asyncLayout         |  BOOLEAN     | O      | X        |
  *
  * @SINCE_1_0.0
  */
@@ -252,6 +253,13 @@ public:
        * @SINCE_1_1.37
        */
       OUTLINE,
+
+      /**
+       * @brief Whether the text is shaped and laid-out in a later frame.
+       * @details name "asyncLayout", type BOOLEAN, default false. An estimation of the natural size is used until then.
+       * @SINCE_1_1.46
+       */
+      ASYNC_LAYOUT,
     };
   };
 
@@ -34,6 +34,29 @@
 #include <stdlib.h>
 #include <math.h>
 
+/**
+ * In the original software, the spans are composited one pixel at a time.
+ * We composite them with SSE2 or NEON when they are available. The result is the same as the scalar path.
+ * Define NSVG_NO_SIMD to build the scalar path only, or disable it at runtime with nsvgSetRasterizerSimd().
+ */
+#if !defined(NSVG_NO_SIMD)
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#define NSVG__SSE2
+#elif defined(__ARM_NEON__) || defined(__ARM_NEON)
+#include <arm_neon.h>
+#define NSVG__NEON
+#endif
+#endif
+
+#if defined(NSVG__SSE2) || defined(NSVG__NEON)
+#define NSVG__SIMD 1
+#else
+#define NSVG__SIMD 0
+#endif
+
+#define NSVG__SPAN_CHUNK    64
+
 #define NSVG__SUBSAMPLES    5
 #define NSVG__FIXSHIFT      10
 #define NSVG__FIX           (1 << NSVG__FIXSHIFT)
@@ -107,6 +130,8 @@ struct NSVGrasterizer
 
     unsigned char* bitmap;
     int width, height, stride;
+
+    int simd;
 };
 
 NSVGrasterizer* nsvgCreateRasterizer()
@@ -117,6 +142,7 @@ NSVGrasterizer* nsvgCreateRasterizer()
 
     r->tessTol = 0.25f;
     r->distTol = 0.01f;
+    r->simd = NSVG__SIMD;
 
     return r;
 
@@ -125,6 +151,12 @@ error:
     return NULL;
 }
 
+int nsvgSetRasterizerSimd(NSVGrasterizer* r, int enable)
+{
+    r->simd = enable && NSVG__SIMD;
+    return r->simd;
+}
+
 void nsvgDeleteRasterizer(NSVGrasterizer* r)
 {
     if (r == NULL) return;
@@ -1078,6 +1110,221 @@ static void nsvg__scanlineSolid(unsigned char* dst, int count, unsigned char* co
     }
 }
 
+#if NSVG__SIMD
+
+// Composites one pixel exactly as nsvg__scanlineSolid() does. Used for the pixels left over by the vectorised loops.
+static inline void nsvg__blendPixel(unsigned char* dst, unsigned char cover, unsigned int c)
+{
+    int cr = c & 0xff;
+    int cg = (c >> 8) & 0xff;
+    int cb = (c >> 16) & 0xff;
+    int ca = (c >> 24) & 0xff;
+
+    int a = nsvg__div255((int)cover * ca);
+    int ia = 255 - a;
+
+    dst[0] = (unsigned char)(nsvg__div255(cr * a) + nsvg__div255(ia * (int)dst[0]));
+    dst[1] = (unsigned char)(nsvg__div255(cg * a) + nsvg__div255(ia * (int)dst[1]));
+    dst[2] = (unsigned char)(nsvg__div255(cb * a) + nsvg__div255(ia * (int)dst[2]));
+    dst[3] = (unsigned char)(a + nsvg__div255(ia * (int)dst[3]));
+}
+
+#if defined(NSVG__SSE2)
+
+// nsvg__div255() in 16 bit lanes. x+1 fits in 16 bits as x <= 255*255.
+static inline __m128i nsvg__div255Sse2(__m128i x)
+{
+    return _mm_mulhi_epu16(_mm_add_epi16(x, _mm_set1_epi16(1)), _mm_set1_epi16(257));
+}
+
+// Composites two pixels unpacked to 16 bit lanes. The cover of each pixel is repeated in its four lanes.
+static inline __m128i nsvg__blend2Sse2(__m128i c, __m128i cover, __m128i dst)
+{
+    const __m128i alphaMask = _mm_set_epi16(-1, 0, 0, 0, -1, 0, 0, 0);
+    __m128i ca = _mm_shufflehi_epi16(_mm_shufflelo_epi16(c, 0xff), 0xff);
+    __m128i a = nsvg__div255Sse2(_mm_mullo_epi16(cover, ca));
+    __m128i ia = _mm_sub_epi16(_mm_set1_epi16(255), a);
+
+    // Premultiply. The alpha lanes keep the alpha.
+    __m128i src = nsvg__div255Sse2(_mm_mullo_epi16(c, a));
+    src = _mm_or_si128(_mm_and_si128(alphaMask, a), _mm_andnot_si128(alphaMask, src));
+
+    // Blend over. Truncate to 8 bits as the scalar path does.
+    src = _mm_add_epi16(src, nsvg__div255Sse2(_mm_mullo_epi16(dst, ia)));
+    return _mm_and_si128(src, _mm_set1_epi16(0xff));
+}
+
+// Composites the colors over the span. If colorStep is 0 all the pixels use colors[0].
+static void nsvg__blendSpan(unsigned char* dst, int count, const unsigned char* cover, const unsigned int* colors, int colorStep)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i solid = _mm_set1_epi32((int)colors[0]);
+    const int opaque = (colors[0] >> 24) == 0xff;
+    int i;
+
+    for (i = 0; i + 4 <= count; i += 4) {
+        unsigned int cover4;
+        __m128i c, cv, d, lo, hi;
+
+        memcpy(&cover4, cover + i, 4);
+        if (cover4 == 0) // Nothing to composite.
+            continue;
+
+        c = colorStep ? _mm_loadu_si128((const __m128i*)(colors + i)) : solid;
+        if (cover4 == 0xffffffff && !colorStep && opaque) { // The color replaces the pixels.
+            _mm_storeu_si128((__m128i*)(dst + i*4), c);
+            continue;
+        }
+
+        cv = _mm_unpacklo_epi8(_mm_cvtsi32_si128((int)cover4), zero);
+        cv = _mm_unpacklo_epi16(cv, cv);
+        d = _mm_loadu_si128((const __m128i*)(dst + i*4));
+
+        lo = nsvg__blend2Sse2(_mm_unpacklo_epi8(c, zero), _mm_unpacklo_epi32(cv, cv), _mm_unpacklo_epi8(d, zero));
+        hi = nsvg__blend2Sse2(_mm_unpackhi_epi8(c, zero), _mm_unpackhi_epi32(cv, cv), _mm_unpackhi_epi8(d, zero));
+        _mm_storeu_si128((__m128i*)(dst + i*4), _mm_packus_epi16(lo, hi));
+    }
+
+    for (; i < count; i++)
+        nsvg__blendPixel(dst + i*4, cover[i], colors[i * colorStep]);
+}
+
+#elif defined(NSVG__NEON)
+
+// nsvg__div255() in 16 bit lanes. ((x+1)*257)>>16 is computed as (y+(y>>8))>>8 with y=x+1, which doesn't overflow.
+static inline uint16x8_t nsvg__div255Neon(uint16x8_t x)
+{
+    x = vaddq_u16(x, vdupq_n_u16(1));
+    return vshrq_n_u16(vaddq_u16(x, vshrq_n_u16(x, 8)), 8);
+}
+
+// Composites the colors over the span. If colorStep is 0 all the pixels use colors[0].
+static void nsvg__blendSpan(unsigned char* dst, int count, const unsigned char* cover, const unsigned int* colors, int colorStep)
+{
+    uint8x8x4_t solid;
+    int i;
+
+    solid.val[0] = vdup_n_u8(colors[0] & 0xff);
+    solid.val[1] = vdup_n_u8((colors[0] >> 8) & 0xff);
+    solid.val[2] = vdup_n_u8((colors[0] >> 16) & 0xff);
+    solid.val[3] = vdup_n_u8((colors[0] >> 24) & 0xff);
+
+    for (i = 0; i + 8 <= count; i += 8) {
+        uint8x8x4_t c, d;
+        uint8x8_t cv, a, ia;
+        uint16x8_t a16;
+
+        cv = vld1_u8(cover + i);
+        if (vget_lane_u64(vreinterpret_u64_u8(cv), 0) == 0) // Nothing to composite.
+            continue;
+
+        c = colorStep ? vld4_u8((const unsigned char*)(colors + i)) : solid;
+        d = vld4_u8(dst + i*4);
+
+        a16 = nsvg__div255Neon(vmull_u8(cv, c.val[3]));
+        a = vmovn_u16(a16);
+        ia = vsub_u8(vdup_n_u8(255), a);
+
+        // Premultiply and blend over. Truncate to 8 bits as the scalar path does.
+        d.val[0] = vmovn_u16(vaddq_u16(nsvg__div255Neon(vmull_u8(c.val[0], a)), nsvg__div255Neon(vmull_u8(d.val[0], ia))));
+        d.val[1] = vmovn_u16(vaddq_u16(nsvg__div255Neon(vmull_u8(c.val[1], a)), nsvg__div255Neon(vmull_u8(d.val[1], ia))));
+        d.val[2] = vmovn_u16(vaddq_u16(nsvg__div255Neon(vmull_u8(c.val[2], a)), nsvg__div255Neon(vmull_u8(d.val[2], ia))));
+        d.val[3] = vmovn_u16(vaddq_u16(a16, nsvg__div255Neon(vmull_u8(d.val[3], ia))));
+
+        vst4_u8(dst + i*4, d);
+    }
+
+    for (; i < count; i++)
+        nsvg__blendPixel(dst + i*4, cover[i], colors[i * colorStep]);
+}
+
+#endif
+
+// Looks up the gradient colors of count pixels starting at (fx,fy) in gradient space.
+// The coordinates are computed as in nsvg__scanlineSolid(), so the colors are the same. Returns fx of the next pixel.
+static float nsvg__gradientColors(unsigned int* colors, int count, float fx, float fy, float dx, NSVGcachedPaint* cache)
+{
+    float* t = cache->xform;
+    int i = 0;
+
+    // With fused multiply-add the scalar expressions may be contracted, so only the scalar lookup is exact then.
+#if defined(NSVG__SSE2) && !defined(__FP_FAST_FMAF)
+    const __m128 t0 = _mm_set1_ps(t[0]), t1 = _mm_set1_ps(t[1]);
+    const __m128 fyt2 = _mm_set1_ps(fy*t[2]), fyt3 = _mm_set1_ps(fy*t[3]);
+    const __m128 t4 = _mm_set1_ps(t[4]), t5 = _mm_set1_ps(t[5]);
+    const __m128 zero = _mm_setzero_ps(), max = _mm_set1_ps(255.0f);
+    int radial = cache->type == NSVG_PAINT_RADIAL_GRADIENT;
+
+    for (; i + 4 <= count; i += 4) {
+        float fx4[4];
+        int index[4];
+        __m128 vfx, gy, gd;
+
+        // Accumulated one pixel at a time as in the scalar path.
+        fx4[0] = fx; fx += dx;
+        fx4[1] = fx; fx += dx;
+        fx4[2] = fx; fx += dx;
+        fx4[3] = fx; fx += dx;
+        vfx = _mm_loadu_ps(fx4);
+
+        gy = _mm_add_ps(_mm_add_ps(_mm_mul_ps(vfx, t1), fyt3), t5);
+        if (radial) {
+            __m128 gx = _mm_add_ps(_mm_add_ps(_mm_mul_ps(vfx, t0), fyt2), t4);
+            gd = _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(gx, gx), _mm_mul_ps(gy, gy)));
+        } else {
+            gd = gy;
+        }
+
+        _mm_storeu_si128((__m128i*)index, _mm_cvttps_epi32(_mm_min_ps(_mm_max_ps(_mm_mul_ps(gd, max), zero), max)));
+        colors[i] = cache->colors[index[0]];
+        colors[i+1] = cache->colors[index[1]];
+        colors[i+2] = cache->colors[index[2]];
+        colors[i+3] = cache->colors[index[3]];
+    }
+#endif
+
+    if (cache->type == NSVG_PAINT_LINEAR_GRADIENT) {
+        for (; i < count; i++) {
+            float gy = fx*t[1] + fy*t[3] + t[5];
+            colors[i] = cache->colors[(int)nsvg__clampf(gy*255.0f, 0, 255.0f)];
+            fx += dx;
+        }
+    } else {
+        for (; i < count; i++) {
+            float gx = fx*t[0] + fy*t[2] + t[4];
+            float gy = fx*t[1] + fy*t[3] + t[5];
+            float gd = sqrtf(gx*gx + gy*gy);
+            colors[i] = cache->colors[(int)nsvg__clampf(gd*255.0f, 0, 255.0f)];
+            fx += dx;
+        }
+    }
+
+    return fx;
+}
+
+// The vectorised version of nsvg__scanlineSolid(). The gradient colors are looked up in chunks and composited with the coverage.
+static void nsvg__scanlineSimd(unsigned char* dst, int count, unsigned char* cover, int x, int y,
+                               float tx, float ty, float scale, NSVGcachedPaint* cache)
+{
+    if (cache->type == NSVG_PAINT_COLOR) {
+        nsvg__blendSpan(dst, count, cover, cache->colors, 0);
+    } else if (cache->type == NSVG_PAINT_LINEAR_GRADIENT || cache->type == NSVG_PAINT_RADIAL_GRADIENT) {
+        unsigned int colors[NSVG__SPAN_CHUNK];
+        float fx = (x - tx) / scale;
+        float fy = (y - ty) / scale;
+        float dx = 1.0f / scale;
+        int i, n;
+
+        for (i = 0; i < count; i += n) {
+            n = count - i < NSVG__SPAN_CHUNK ? count - i : NSVG__SPAN_CHUNK;
+            fx = nsvg__gradientColors(colors, n, fx, fy, dx, cache);
+            nsvg__blendSpan(dst + i*4, n, cover + i, colors, 1);
+        }
+    }
+}
+
+#endif // NSVG__SIMD
+
 static void nsvg__rasterizeSortedEdges(NSVGrasterizer *r, float tx, float ty, float scale, NSVGcachedPaint* cache, char fillRule)
 {
     NSVGactiveEdge *active = NULL;
@@ -1160,6 +1407,11 @@ static void nsvg__rasterizeSortedEdges(NSVGrasterizer *r, float tx, float ty, fl
         if (xmin < 0) xmin = 0;
         if (xmax > r->width-1) xmax = r->width-1;
         if (xmin <= xmax) {
+#if NSVG__SIMD
+            if (r->simd)
+                nsvg__scanlineSimd(&r->bitmap[y * r->stride] + xmin*4, xmax-xmin+1, &r->scanline[xmin], xmin, y, tx,ty, scale, cache);
+            else
+#endif
             nsvg__scanlineSolid(&r->bitmap[y * r->stride] + xmin*4, xmax-xmin+1, &r->scanline[xmin], xmin, y, tx,ty, scale, cache);
         }
     }
@@ -57,6 +57,13 @@ void nsvgRasterize(NSVGrasterizer* r,
 				   NSVGimage* image, float tx, float ty, float scale,
 				   unsigned char* dst, int w, int h, int stride);
 
+// Enables or disables the vectorised span compositing. It's enabled by default when the rasterizer is built with SSE2 or NEON.
+// The result is the same as the scalar path.
+//   r - pointer to rasterizer context
+//   enable - non-zero to use the vectorised path
+// Returns non-zero if the vectorised path is used.
+int nsvgSetRasterizerSimd(NSVGrasterizer* r, int enable);
+
 // Deletes rasterizer context.
 void nsvgDeleteRasterizer(NSVGrasterizer*);
 
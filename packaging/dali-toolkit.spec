@@ -112,6 +112,9 @@ DALI_DATA_RO_DIR="%{dali_data_ro_dir}" ; export DALI_DATA_RO_DIR
            --with-style=%{dali_style_folder} \
 %if 0%{?enable_debug}
            --enable-debug \
+%endif
+%if 0%{?enable_neon}
+           --enable-neon \
 %endif
            --enable-i18n=yes
 